@@ -0,0 +1,150 @@
+#include "TurboStructLiteBPLibrary.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurboStructLiteAesGcmTest, "TurboStructLite.Security.AesGcmKnownVectors", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTurboStructLiteAesGcmTest::RunTest(const FString& Parameters)
+{
+	struct FGcmTestVector
+	{
+		const TCHAR* Key;
+		const TCHAR* IV;
+		const TCHAR* Plaintext;
+		const TCHAR* Ciphertext;
+		const TCHAR* Tag;
+	};
+
+	// NIST GCM specification test cases 13-15 (AES-256, no AAD).
+	const FGcmTestVector Vectors[] =
+	{
+		{
+			TEXT("0000000000000000000000000000000000000000000000000000000000000000"),
+			TEXT("000000000000000000000000"),
+			TEXT(""),
+			TEXT(""),
+			TEXT("530f8afbc74536b9a963b4f1c4cb738b")
+		},
+		{
+			TEXT("0000000000000000000000000000000000000000000000000000000000000000"),
+			TEXT("000000000000000000000000"),
+			TEXT("00000000000000000000000000000000"),
+			TEXT("cea7403d4d606b6e074ec5d3baf39d18"),
+			TEXT("d0d1c8a799996bf0265b98b5d48ab919")
+		},
+		{
+			TEXT("feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308"),
+			TEXT("cafebabefacedbaddecaf888"),
+			TEXT("d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255"),
+			TEXT("522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662898015ad"),
+			TEXT("b094dac5d93471bdec1a502270e3cc6c")
+		}
+	};
+
+	auto FromHex = [](const TCHAR* Hex)
+	{
+		const FString Str(Hex);
+		TArray<uint8> Bytes;
+		Bytes.SetNumUninitialized(Str.Len() / 2);
+		HexToBytes(Str, Bytes.GetData());
+		return Bytes;
+	};
+
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Vectors); ++Index)
+	{
+		const FGcmTestVector& Vector = Vectors[Index];
+		const TArray<uint8> Key = FromHex(Vector.Key);
+		const TArray<uint8> IV = FromHex(Vector.IV);
+		const TArray<uint8> Plaintext = FromHex(Vector.Plaintext);
+		const TArray<uint8> ExpectedCiphertext = FromHex(Vector.Ciphertext);
+		const TArray<uint8> ExpectedTag = FromHex(Vector.Tag);
+
+		TArray<uint8> Ciphertext;
+		TArray<uint8> Tag;
+		TestTrue(FString::Printf(TEXT("Fallback encrypt %d"), Index), UTurboStructLiteBPLibrary::EncryptAesGcmFallback(Key.GetData(), IV.GetData(), IV.Num(), Plaintext.GetData(), Plaintext.Num(), Ciphertext, Tag));
+		TestTrue(FString::Printf(TEXT("Fallback ciphertext %d"), Index), Ciphertext == ExpectedCiphertext);
+		TestTrue(FString::Printf(TEXT("Fallback tag %d"), Index), Tag == ExpectedTag);
+
+		TArray<uint8> Decrypted;
+		TestTrue(FString::Printf(TEXT("Fallback decrypt %d"), Index), UTurboStructLiteBPLibrary::DecryptAesGcmFallback(Key.GetData(), IV.GetData(), IV.Num(), ExpectedCiphertext.GetData(), ExpectedCiphertext.Num(), ExpectedTag.GetData(), ExpectedTag.Num(), Decrypted));
+		TestTrue(FString::Printf(TEXT("Fallback round trip %d"), Index), Decrypted == Plaintext);
+
+		TArray<uint8> PlatformCiphertext;
+		uint8 PlatformTag[16];
+		TestTrue(FString::Printf(TEXT("Platform encrypt %d"), Index), UTurboStructLiteBPLibrary::EncryptAesGcm(Key.GetData(), IV.GetData(), IV.Num(), Plaintext.GetData(), Plaintext.Num(), PlatformCiphertext, PlatformTag));
+		TestTrue(FString::Printf(TEXT("Platform ciphertext %d"), Index), PlatformCiphertext == ExpectedCiphertext);
+		TestTrue(FString::Printf(TEXT("Platform tag %d"), Index), FMemory::Memcmp(PlatformTag, ExpectedTag.GetData(), 16) == 0);
+
+		TArray<uint8> Tampered = ExpectedTag;
+		Tampered[0] ^= 0x01;
+		TArray<uint8> Rejected;
+		TestFalse(FString::Printf(TEXT("Fallback rejects tampered tag %d"), Index), UTurboStructLiteBPLibrary::DecryptAesGcmFallback(Key.GetData(), IV.GetData(), IV.Num(), ExpectedCiphertext.GetData(), ExpectedCiphertext.Num(), Tampered.GetData(), Tampered.Num(), Rejected));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurboStructLiteAesGcmPerfTest, "TurboStructLite.Security.AesGcmThroughput", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FTurboStructLiteAesGcmPerfTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 BufferSize = 4 * 1024 * 1024;
+	constexpr int32 Iterations = 8;
+	constexpr int32 IVSize = 12;
+	uint8 Key[32];
+	uint8 IV[IVSize];
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Key); ++Index)
+	{
+		Key[Index] = static_cast<uint8>(Index * 7 + 1);
+	}
+	for (int32 Index = 0; Index < IVSize; ++Index)
+	{
+		IV[Index] = static_cast<uint8>(Index * 13 + 5);
+	}
+	TArray<uint8> Plaintext;
+	Plaintext.SetNumUninitialized(BufferSize);
+	for (int32 Index = 0; Index < BufferSize; ++Index)
+	{
+		Plaintext[Index] = static_cast<uint8>((Index * 31) ^ (Index >> 8));
+	}
+
+	TArray<uint8> PlatformCiphertext;
+	uint8 PlatformTag[16];
+	const double PlatformStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		if (!TestTrue(TEXT("Platform encrypt"), UTurboStructLiteBPLibrary::EncryptAesGcm(Key, IV, IVSize, Plaintext.GetData(), Plaintext.Num(), PlatformCiphertext, PlatformTag)))
+		{
+			return false;
+		}
+	}
+	const double PlatformSeconds = FPlatformTime::Seconds() - PlatformStart;
+
+	TArray<uint8> FallbackCiphertext;
+	TArray<uint8> FallbackTag;
+	const double FallbackStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		if (!TestTrue(TEXT("Fallback encrypt"), UTurboStructLiteBPLibrary::EncryptAesGcmFallback(Key, IV, IVSize, Plaintext.GetData(), Plaintext.Num(), FallbackCiphertext, FallbackTag)))
+		{
+			return false;
+		}
+	}
+	const double FallbackSeconds = FPlatformTime::Seconds() - FallbackStart;
+
+	TestTrue(TEXT("Platform and fallback ciphertext match"), PlatformCiphertext == FallbackCiphertext);
+	TestTrue(TEXT("Platform and fallback tag match"), FallbackTag.Num() == 16 && FMemory::Memcmp(PlatformTag, FallbackTag.GetData(), 16) == 0);
+
+	const double TotalMiB = static_cast<double>(BufferSize) * Iterations / (1024.0 * 1024.0);
+#if TURBOSTRUCTLITE_USE_OPENSSL
+	const TCHAR* PlatformName = TEXT("OpenSSL");
+#else
+	const TCHAR* PlatformName = TEXT("PlatformCrypto");
+#endif
+	AddInfo(FString::Printf(TEXT("AES-256-GCM %s: %.1f MiB/s"), PlatformName, TotalMiB / FMath::Max(PlatformSeconds, 1e-6)));
+	AddInfo(FString::Printf(TEXT("AES-256-GCM fallback: %.1f MiB/s"), TotalMiB / FMath::Max(FallbackSeconds, 1e-6)));
+	return true;
+}
+
+#endif
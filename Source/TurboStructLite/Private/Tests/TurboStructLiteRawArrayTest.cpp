@@ -0,0 +1,56 @@
+#include "TurboStructLiteBPLibrary.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/StructuredArchive.h"
+#if __has_include("Serialization/StructuredArchiveAdapters.h")
+#include "Serialization/StructuredArchiveAdapters.h"
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurboStructLiteRawArrayEligibilityTest, "TurboStructLite.Serialization.RawArrayEligibility", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTurboStructLiteRawArrayEligibilityTest::RunTest(const FString& Parameters)
+{
+	// Every element of an eligible type must serialize to its memory, whatever its value; the raw path never probes instances.
+	auto CheckMixedArray = [this](const UScriptStruct* Struct, const void* Elements, int32 Num, const TCHAR* Label)
+	{
+		if (!TestTrue(FString::Printf(TEXT("%s is raw eligible"), Label), UTurboStructLiteBPLibrary::IsRawSerializableStruct(Struct)))
+		{
+			return;
+		}
+		const int32 ElementSize = Struct->GetStructureSize();
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			void* ElemPtr = const_cast<uint8*>(static_cast<const uint8*>(Elements) + static_cast<SIZE_T>(Index) * ElementSize);
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes, true);
+			FObjectAndNameAsStringProxyArchive Ar(Writer, true);
+			Ar.ArNoDelta = true;
+			FStructuredArchiveFromArchive Structured(Ar);
+			const_cast<UScriptStruct*>(Struct)->SerializeItem(Structured.GetSlot(), ElemPtr, nullptr);
+			TestTrue(FString::Printf(TEXT("%s element %d serializes to its memory"), Label, Index), Bytes.Num() == ElementSize && FMemory::Memcmp(Bytes.GetData(), ElemPtr, ElementSize) == 0);
+		}
+	};
+
+	const TArray<FVector> Vectors = { FVector::ZeroVector, FVector(1.5, -2.25, 3.0e10), FVector(-0.0, TNumericLimits<double>::Max(), TNumericLimits<double>::Lowest()), FVector(UE_SMALL_NUMBER, 7.0, -UE_BIG_NUMBER) };
+	CheckMixedArray(TBaseStructure<FVector>::Get(), Vectors.GetData(), Vectors.Num(), TEXT("FVector"));
+
+	const TArray<FIntPoint> Points = { FIntPoint::ZeroValue, FIntPoint(MIN_int32, MAX_int32), FIntPoint(-1, 1), FIntPoint(123456, -654321) };
+	CheckMixedArray(TBaseStructure<FIntPoint>::Get(), Points.GetData(), Points.Num(), TEXT("FIntPoint"));
+
+	const TArray<FColor> Colors = { FColor::Black, FColor(1, 2, 3, 4), FColor::White, FColor(255, 0, 128, 0) };
+	CheckMixedArray(TBaseStructure<FColor>::Get(), Colors.GetData(), Colors.Num(), TEXT("FColor"));
+
+	const TArray<FGuid> Guids = { FGuid(), FGuid(1, 2, 3, 4), FGuid(MAX_uint32, 0, MAX_uint32, 0), FGuid::NewGuid() };
+	CheckMixedArray(TBaseStructure<FGuid>::Get(), Guids.GetData(), Guids.Num(), TEXT("FGuid"));
+
+	// Padded or non-POD types stay on the per-element path no matter what the array holds.
+	TestFalse(TEXT("FBox is not raw eligible"), UTurboStructLiteBPLibrary::IsRawSerializableStruct(TBaseStructure<FBox>::Get()));
+	TestFalse(TEXT("FTransform is not raw eligible"), UTurboStructLiteBPLibrary::IsRawSerializableStruct(TBaseStructure<FTransform>::Get()));
+	TestFalse(TEXT("Null struct is not raw eligible"), UTurboStructLiteBPLibrary::IsRawSerializableStruct(nullptr));
+	return true;
+}
+
+#endif
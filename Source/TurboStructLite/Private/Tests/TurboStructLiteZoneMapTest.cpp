@@ -0,0 +1,54 @@
+#include "TurboStructLiteBPLibrary.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurboStructLiteZoneMapEncryptionTest, "TurboStructLite.Query.ZoneMapSkipsEncryptedEntries", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTurboStructLiteZoneMapEncryptionTest::RunTest(const FString& Parameters)
+{
+	TSharedPtr<TArray<FTurboStructLiteZoneRange>> Ranges = MakeShared<TArray<FTurboStructLiteZoneRange>>();
+	FTurboStructLiteZoneRange& Range = Ranges->AddDefaulted_GetRef();
+	Range.FieldName = TEXT("Health");
+	Range.FieldType = TEXT("int32");
+	Range.Min = 42.0;
+	Range.Max = 42.0;
+
+	auto BuildIndex = [&Ranges](ETurboStructLiteEncryption Encryption)
+	{
+		FTurboStructLiteSlotIndex Index;
+		Index.FooterOffset = 128;
+		FTurboStructLiteCachedEntry Entry;
+		Entry.Encryption = Encryption;
+		Entry.ZoneMap = Ranges;
+		Index.Entries.Add(0, Entry);
+		Index.OrderedSubSlots.Add(0);
+		return Index;
+	};
+
+	auto WriteBlock = [](const FTurboStructLiteSlotIndex& Index)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes, true);
+		UTurboStructLiteBPLibrary::WriteZoneMapBlock(Writer, Index);
+		return Bytes;
+	};
+
+	const TArray<uint8> PlainBlock = WriteBlock(BuildIndex(ETurboStructLiteEncryption::None));
+	TestTrue(TEXT("Unencrypted slot writes a zone map block"), PlainBlock.Num() > static_cast<int32>(sizeof(int32)) && FMemory::Memcmp(PlainBlock.GetData(), &TurboStructLiteZoneMapMagic, sizeof(int32)) == 0);
+
+	const TArray<uint8> AesBlock = WriteBlock(BuildIndex(ETurboStructLiteEncryption::AES));
+	TestEqual(TEXT("AES slot writes no zone map block"), AesBlock.Num(), 0);
+
+	FTurboStructLiteSlotIndex MixedIndex = BuildIndex(ETurboStructLiteEncryption::AES);
+	FTurboStructLiteCachedEntry PlainEntry;
+	PlainEntry.Encryption = ETurboStructLiteEncryption::None;
+	PlainEntry.ZoneMap = Ranges;
+	MixedIndex.Entries.Add(1, PlainEntry);
+	MixedIndex.OrderedSubSlots.Add(1);
+	TestEqual(TEXT("Mixed slot only summarizes the unencrypted entry"), WriteBlock(MixedIndex).Num(), PlainBlock.Num());
+	return true;
+}
+
+#endif
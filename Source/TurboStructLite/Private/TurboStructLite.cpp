@@ -10,6 +10,8 @@ void FTurboStructLiteModule::StartupModule()
 
 void FTurboStructLiteModule::ShutdownModule()
 {
+	UTurboStructLiteBPLibrary::ClearDerivedKeyCache();
+	UTurboStructLiteBPLibrary::ClearLoadPlanCache();
 }
 	
 IMPLEMENT_MODULE(FTurboStructLiteModule, TurboStructLite)
@@ -1,8 +1,12 @@
 #include "TurboStructLiteBPLibrary.h"
+#include "TurboStructLiteConstants.h"
 #include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
 #include "Async/ParallelFor.h"
 #include "Misc/Paths.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
 #include "Misc/ConfigCacheIni.h"
 #include "HAL/CriticalSection.h"
 #include "UObject/Stack.h"
@@ -103,7 +107,82 @@ void UTurboStructLiteBPLibrary::HandleWildcardLoad(FProperty* DataProp, void* Da
 	EnqueueLoadRequest(MoveTemp(Request));
 }
 
-void UTurboStructLiteBPLibrary::HandleWildcardSave(FProperty* DataProp, void* DataPtr, const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FTurboStructLiteSaveComplete& SaveDelegate, bool bUseWriteAheadLog, bool bSaveOnlyMarked, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption, ETurboStructLiteCompression Compression, ETurboStructLiteBatchingSetting CompressionBatching, const TCHAR* OperationName, const TCHAR* WildcardLabelLower, const TCHAR* WildcardLabelUpper, const TCHAR* SaveLabel, bool bEmitDebugPropInfo)
+void UTurboStructLiteBPLibrary::CaptureArraySnapshotTimeSliced(FArrayProperty* ArrayProp, void* DataPtr, TWeakObjectPtr<UObject> Owner, float BudgetMs, TFunction<void(bool, TArray<uint8>&&)> OnCaptured)
+{
+	TArray<uint8> Snapshot;
+	Snapshot.SetNumUninitialized(ArrayProp->GetSize());
+	ArrayProp->InitializeValue(Snapshot.GetData());
+	int32 Copied = 0;
+
+	// Copies whole elements until the frame budget is spent; the owner keeps DataPtr alive between ticks.
+	// The snapshot is taken over several frames: elements copied on an earlier tick are not re-read, so edits the
+	// caller makes mid-capture may or may not be included.
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([ArrayProp, DataPtr, Owner, BudgetMs, OnCaptured = MoveTemp(OnCaptured), Snapshot = MoveTemp(Snapshot), Copied](float) mutable -> bool
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveWildcard_SnapshotSlice"));
+		if (!Owner.IsValid())
+		{
+			ArrayProp->DestroyValue(Snapshot.GetData());
+			OnCaptured(false, TArray<uint8>());
+			return false;
+		}
+		FScriptArrayHelper Source(ArrayProp, DataPtr);
+		FScriptArrayHelper Dest(ArrayProp, Snapshot.GetData());
+		const int32 SourceNum = Source.Num();
+		if (SourceNum < Copied)
+		{
+			// The live array shrank below what was already copied; keep the snapshot no longer than the source.
+			Dest.RemoveValues(SourceNum, Copied - SourceNum);
+			Copied = SourceNum;
+		}
+
+		FProperty* Inner = ArrayProp->Inner;
+		const bool bPlainOldData = Inner->HasAnyPropertyFlags(CPF_IsPlainOldData);
+		const int32 ElementSize = Inner->GetSize();
+		const double Deadline = FPlatformTime::Seconds() + BudgetMs / 1000.0;
+		while (Copied < SourceNum)
+		{
+			const int32 Count = FMath::Min(TurboStructLiteSnapshotSliceElements, SourceNum - Copied);
+			const int32 Start = Dest.AddUninitializedValues(Count);
+			if (bPlainOldData)
+			{
+				FMemory::Memcpy(Dest.GetRawPtr(Start), Source.GetRawPtr(Copied), static_cast<SIZE_T>(Count) * ElementSize);
+			}
+			else
+			{
+				for (int32 Index = 0; Index < Count; ++Index)
+				{
+					Inner->InitializeValue(Dest.GetRawPtr(Start + Index));
+					Inner->CopyCompleteValue(Dest.GetRawPtr(Start + Index), Source.GetRawPtr(Copied + Index));
+				}
+			}
+			Copied += Count;
+			if (FPlatformTime::Seconds() >= Deadline)
+			{
+				break;
+			}
+		}
+		if (Copied < SourceNum)
+		{
+			return true;
+		}
+		OnCaptured(true, MoveTemp(Snapshot));
+		return false;
+	}));
+}
+
+bool UTurboStructLiteBPLibrary::IsValueOwnedByObject(const FProperty* Property, const void* ValuePtr, const UObject* OwnerObject)
+{
+	if (!Property || !ValuePtr || !OwnerObject)
+	{
+		return false;
+	}
+	const uint8* ObjectStart = reinterpret_cast<const uint8*>(OwnerObject);
+	const uint8* ValueStart = static_cast<const uint8*>(ValuePtr);
+	return ValueStart >= ObjectStart && ValueStart + Property->GetSize() <= ObjectStart + OwnerObject->GetClass()->GetStructureSize();
+}
+
+void UTurboStructLiteBPLibrary::HandleWildcardSave(FProperty* DataProp, void* DataPtr, const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FTurboStructLiteSaveComplete& SaveDelegate, bool bUseWriteAheadLog, bool bSaveOnlyMarked, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption, ETurboStructLiteCompression Compression, ETurboStructLiteBatchingSetting CompressionBatching, const TCHAR* OperationName, const TCHAR* WildcardLabelLower, const TCHAR* WildcardLabelUpper, const TCHAR* SaveLabel, bool bEmitDebugPropInfo, UObject* OwnerObject)
 {
 	if (!DataProp || !DataPtr)
 	{
@@ -140,20 +219,6 @@ void UTurboStructLiteBPLibrary::HandleWildcardSave(FProperty* DataProp, void* Da
 	if (bAsync)
 	{
 		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveWildcard_CaptureSnapshot"));
-		if (bUseWriteAheadLog)
-		{
-			WriteWALEntry(WALPath, TEXT("Serialize snapshot start"));
-		}
-		TArray<uint8> Snapshot;
-		const int32 ValueSize = DataProp->GetSize();
-		if (ValueSize > 0)
-		{
-			Snapshot.SetNumUninitialized(ValueSize);
-			DataProp->InitializeValue(Snapshot.GetData());
-			DataProp->CopyCompleteValue(Snapshot.GetData(), DataPtr);
-		}
-		const bool bHasSnapshot = Snapshot.Num() > 0;
-
 		if (ResolvedEncryption == ETurboStructLiteEncryption::AES && ResolvedKey.IsEmpty())
 		{
 			if (bUseWriteAheadLog)
@@ -172,79 +237,119 @@ void UTurboStructLiteBPLibrary::HandleWildcardSave(FProperty* DataProp, void* Da
 		const bool bUseLog = bUseWriteAheadLog;
 		const FString WALPathCopy = WALPath;
 
-		Async(EAsyncExecution::ThreadPool, [DataProp, Snapshot = MoveTemp(Snapshot), SaveDelegate, SlotCopy, SubSlotCopy, FilePath, ResolvedCompression, ResolvedEncryption, ResolvedKey, PriorityCopy, bHasSnapshot, ClampedParallel, ResolvedBatchingSetting, bUseLog, WALPathCopy, bSaveOnlyMarked]() mutable
+		auto StartSerialize = [DataProp, SaveDelegate, SlotCopy, SubSlotCopy, FilePath, ResolvedCompression, ResolvedEncryption, ResolvedKey, PriorityCopy, ClampedParallel, ResolvedBatchingSetting, bUseLog, WALPathCopy, bSaveOnlyMarked](TArray<uint8>&& CapturedSnapshot)
 		{
-			TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveWildcard_AsyncTask"));
-			int64 EstimatedBytes = 0;
-			if (EstimateWildcardSize(DataProp, Snapshot.GetData(), EstimatedBytes))
+			const bool bHasSnapshot = CapturedSnapshot.Num() > 0;
+			Async(EAsyncExecution::ThreadPool, [DataProp, Snapshot = MoveTemp(CapturedSnapshot), SaveDelegate, SlotCopy, SubSlotCopy, FilePath, ResolvedCompression, ResolvedEncryption, ResolvedKey, PriorityCopy, bHasSnapshot, ClampedParallel, ResolvedBatchingSetting, bUseLog, WALPathCopy, bSaveOnlyMarked]() mutable
 			{
-				UpdateMemoryPressureWarning(SlotCopy, SubSlotCopy, EstimatedBytes, true, false);
-			}
-			if (bUseLog)
-			{
-				WriteWALEntry(WALPathCopy, TEXT("Serialize start"));
-			}
-			TArray<uint8> RawBytes;
-			{
-				FScopedParallelLimitLite ThreadGuard(ClampedParallel);
-				if (!SerializeWildcard(DataProp, Snapshot.GetData(), RawBytes, bSaveOnlyMarked))
+				TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveWildcard_AsyncTask"));
+				int64 EstimatedBytes = 0;
+				if (EstimateWildcardSize(DataProp, Snapshot.GetData(), EstimatedBytes))
+				{
+					UpdateMemoryPressureWarning(SlotCopy, SubSlotCopy, EstimatedBytes, true, false);
+				}
+				if (bUseLog)
+				{
+					WriteWALEntry(WALPathCopy, TEXT("Serialize start"));
+				}
+				TArray<uint8> RawBytes;
 				{
-					if (bHasSnapshot)
+					FScopedParallelLimitLite ThreadGuard(ClampedParallel);
+					if (!SerializeWildcard(DataProp, Snapshot.GetData(), RawBytes, bSaveOnlyMarked, ResolvedEncryption != ETurboStructLiteEncryption::AES))
 					{
-						DataProp->DestroyValue(Snapshot.GetData());
+						if (bHasSnapshot)
+						{
+							DataProp->DestroyValue(Snapshot.GetData());
+						}
+						if (bUseLog)
+						{
+							WriteWALEntry(WALPathCopy, TEXT("Serialize failed"));
+						}
+						EndMemoryOpMessage(SlotCopy, SubSlotCopy, true, false);
+						AsyncTask(ENamedThreads::GameThread, [SaveDelegate, FilePath, SubSlotCopy]()
+						{
+							FTurboStructLiteSaveComplete Local = SaveDelegate;
+							Local.ExecuteIfBound(false, FilePath, SubSlotCopy);
+						});
+						return;
 					}
+				}
+				if (bHasSnapshot)
+				{
+					DataProp->DestroyValue(Snapshot.GetData());
+				}
+				if (bUseLog)
+				{
+					WriteWALEntry(WALPathCopy, FString::Printf(TEXT("Serialize success Bytes=%d"), RawBytes.Num()));
+				}
+				UpdateMemoryPressureWarning(SlotCopy, SubSlotCopy, RawBytes.Num(), true, false);
+
+				FTurboStructLiteSaveRequest Request;
+				Request.SlotName = SlotCopy;
+				Request.SubSlotIndex = SubSlotCopy;
+				Request.Compression = ResolvedCompression;
+				Request.Encryption = ResolvedEncryption;
+				Request.EncryptionKey = ResolvedKey;
+				Request.bAsync = true;
+				Request.QueuePriority = PriorityCopy;
+				Request.MaxParallelThreads = ClampedParallel;
+				Request.CompressionBatching = ResolvedBatchingSetting;
+				Request.bUseWriteAheadLog = bUseLog;
+				Request.WALPath = WALPathCopy;
+				Request.bSaveOnlyMarked = bSaveOnlyMarked;
+				Request.RawBytes = MoveTemp(RawBytes);
+				if (!BuildDebugMetadataFromBytes(Request.RawBytes, Request.DebugMetadata))
+				{
+					Request.DebugMetadata = BuildDebugMetadata(DataProp);
+				}
+				Request.Callback = [SaveDelegate](bool bSaved, FString CallbackFilePath, int32 CallbackSubSlot) mutable
+				{
+					FTurboStructLiteSaveComplete Local = SaveDelegate;
+					Local.ExecuteIfBound(bSaved, CallbackFilePath, CallbackSubSlot);
+				};
+
+				AsyncTask(ENamedThreads::GameThread, [Request = MoveTemp(Request)]() mutable
+				{
+					EnqueueSaveRequest(MoveTemp(Request));
+				});
+			});
+		};
+
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Serialize snapshot start"));
+		}
+		// Arrays owned by a UObject can be captured over several frames instead of one full copy.
+		FArrayProperty* ArrayProp = CastField<FArrayProperty>(DataProp);
+		const float SnapshotBudgetMs = GetAsyncSnapshotBudgetMs();
+		if (ArrayProp && SnapshotBudgetMs > 0.0f && IsValueOwnedByObject(ArrayProp, DataPtr, OwnerObject))
+		{
+			CaptureArraySnapshotTimeSliced(ArrayProp, DataPtr, OwnerObject, SnapshotBudgetMs, [StartSerialize, SaveDelegate, SlotCopy, SubSlotCopy, FilePath, bUseLog, WALPathCopy](bool bCaptured, TArray<uint8>&& CapturedSnapshot) mutable
+			{
+				if (!bCaptured)
+				{
 					if (bUseLog)
 					{
-						WriteWALEntry(WALPathCopy, TEXT("Serialize failed"));
+						WriteWALEntry(WALPathCopy, TEXT("Serialize snapshot aborted"));
 					}
 					EndMemoryOpMessage(SlotCopy, SubSlotCopy, true, false);
-					AsyncTask(ENamedThreads::GameThread, [SaveDelegate, FilePath, SubSlotCopy]()
-					{
-						FTurboStructLiteSaveComplete Local = SaveDelegate;
-						Local.ExecuteIfBound(false, FilePath, SubSlotCopy);
-					});
+					SaveDelegate.ExecuteIfBound(false, FilePath, SubSlotCopy);
 					return;
 				}
-			}
-			if (bHasSnapshot)
-			{
-				DataProp->DestroyValue(Snapshot.GetData());
-			}
-			if (bUseLog)
-			{
-				WriteWALEntry(WALPathCopy, FString::Printf(TEXT("Serialize success Bytes=%d"), RawBytes.Num()));
-			}
-			UpdateMemoryPressureWarning(SlotCopy, SubSlotCopy, RawBytes.Num(), true, false);
-
-			FTurboStructLiteSaveRequest Request;
-			Request.SlotName = SlotCopy;
-			Request.SubSlotIndex = SubSlotCopy;
-			Request.Compression = ResolvedCompression;
-			Request.Encryption = ResolvedEncryption;
-			Request.EncryptionKey = ResolvedKey;
-			Request.bAsync = true;
-			Request.QueuePriority = PriorityCopy;
-			Request.MaxParallelThreads = ClampedParallel;
-			Request.CompressionBatching = ResolvedBatchingSetting;
-			Request.bUseWriteAheadLog = bUseLog;
-			Request.WALPath = WALPathCopy;
-			Request.bSaveOnlyMarked = bSaveOnlyMarked;
-			Request.RawBytes = MoveTemp(RawBytes);
-			if (!BuildDebugMetadataFromBytes(Request.RawBytes, Request.DebugMetadata))
-			{
-				Request.DebugMetadata = BuildDebugMetadata(DataProp);
-			}
-			Request.Callback = [SaveDelegate](bool bSaved, FString CallbackFilePath, int32 CallbackSubSlot) mutable
-			{
-				FTurboStructLiteSaveComplete Local = SaveDelegate;
-				Local.ExecuteIfBound(bSaved, CallbackFilePath, CallbackSubSlot);
-			};
-
-			AsyncTask(ENamedThreads::GameThread, [Request = MoveTemp(Request)]() mutable
-			{
-				EnqueueSaveRequest(MoveTemp(Request));
+				StartSerialize(MoveTemp(CapturedSnapshot));
 			});
-		});
+			return;
+		}
+
+		TArray<uint8> Snapshot;
+		const int32 ValueSize = DataProp->GetSize();
+		if (ValueSize > 0)
+		{
+			Snapshot.SetNumUninitialized(ValueSize);
+			DataProp->InitializeValue(Snapshot.GetData());
+			DataProp->CopyCompleteValue(Snapshot.GetData(), DataPtr);
+		}
+		StartSerialize(MoveTemp(Snapshot));
 		return;
 	}
 
@@ -261,7 +366,8 @@ void UTurboStructLiteBPLibrary::HandleWildcardSave(FProperty* DataProp, void* Da
 		{
 			WriteWALEntry(WALPath, TEXT("Serialize start"));
 		}
-		if (!SerializeWildcard(DataProp, DataPtr, RawBytes, bSaveOnlyMarked))
+		// AES slots keep the metadata inside the sealed payload instead of the plain schema table.
+		if (!SerializeWildcard(DataProp, DataPtr, RawBytes, bSaveOnlyMarked, ResolvedEncryption != ETurboStructLiteEncryption::AES))
 		{
 			if (bUseWriteAheadLog)
 			{
@@ -322,6 +428,271 @@ void UTurboStructLiteBPLibrary::HandleWildcardSave(FProperty* DataProp, void* Da
 	EnqueueSaveRequest(MoveTemp(Request));
 }
 
+bool UTurboStructLiteBPLibrary::IsValidBatchSubSlots(const FString& MainSlotName, const TArray<int32>& SubSlotIndices)
+{
+	if (MainSlotName.IsEmpty() || SubSlotIndices.Num() == 0)
+	{
+		return false;
+	}
+	TSet<int32> Seen;
+	Seen.Reserve(SubSlotIndices.Num());
+	for (const int32 SubSlotIndex : SubSlotIndices)
+	{
+		bool bAlreadySeen = false;
+		Seen.Add(SubSlotIndex, &bAlreadySeen);
+		if (SubSlotIndex < 0 || bAlreadySeen)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+TArray<FTurboStructLiteSaveRequest> UTurboStructLiteBPLibrary::BuildSaveBatchRequests(FArrayProperty* ValuesProp, void* ValuesPtr, const TArray<int32>& SubSlotIndices, const TArray<FString>& WALPaths, const FTurboStructLiteSaveRequest& Template, const TSharedRef<FTurboStructLiteBatchProgress>& Progress)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveBatch_Serialize"));
+	FScriptArrayHelper Helper(ValuesProp, ValuesPtr);
+	FProperty* Inner = ValuesProp->Inner;
+	const int32 NumEntries = FMath::Min(Helper.Num(), SubSlotIndices.Num());
+	TArray<TArray<uint8>> RawBytes;
+	RawBytes.SetNum(NumEntries);
+	TArray<FString> DebugMetadata;
+	DebugMetadata.SetNum(NumEntries);
+	TArray<bool> Serialized;
+	Serialized.Init(false, NumEntries);
+	// One element per worker; each element serializes single-threaded so the pool is not oversubscribed.
+	ParallelFor(NumEntries, [&](int32 EntryIndex)
+	{
+		FScopedParallelLimitLite ThreadGuard(1);
+		Serialized[EntryIndex] = SerializeWildcard(Inner, Helper.GetRawPtr(EntryIndex), RawBytes[EntryIndex], Template.bSaveOnlyMarked, Template.Encryption != ETurboStructLiteEncryption::AES);
+		if (Serialized[EntryIndex] && !BuildDebugMetadataFromBytes(RawBytes[EntryIndex], DebugMetadata[EntryIndex]))
+		{
+			DebugMetadata[EntryIndex] = BuildDebugMetadata(Inner);
+		}
+	}, EParallelForFlags::Unbalanced);
+
+	TArray<FTurboStructLiteSaveRequest> Requests;
+	Requests.Reserve(NumEntries);
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		const FString WALPath = WALPaths.IsValidIndex(EntryIndex) ? WALPaths[EntryIndex] : FString();
+		if (!Serialized[EntryIndex])
+		{
+			if (Template.bUseWriteAheadLog)
+			{
+				WriteWALEntry(WALPath, TEXT("Serialize failed"));
+			}
+			EndMemoryOpMessage(Template.SlotName, SubSlotIndices[EntryIndex], true, false);
+			continue;
+		}
+		if (Template.bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, FString::Printf(TEXT("Serialize success Bytes=%d"), RawBytes[EntryIndex].Num()));
+		}
+		FTurboStructLiteSaveRequest& Request = Requests.AddDefaulted_GetRef();
+		Request.SlotName = Template.SlotName;
+		Request.SubSlotIndex = SubSlotIndices[EntryIndex];
+		Request.Compression = Template.Compression;
+		Request.Encryption = Template.Encryption;
+		Request.EncryptionKey = Template.EncryptionKey;
+		Request.bAsync = Template.bAsync;
+		Request.QueuePriority = Template.QueuePriority;
+		Request.MaxParallelThreads = Template.MaxParallelThreads;
+		Request.CompressionBatching = Template.CompressionBatching;
+		Request.bUseWriteAheadLog = Template.bUseWriteAheadLog;
+		Request.WALPath = WALPath;
+		Request.bSaveOnlyMarked = Template.bSaveOnlyMarked;
+		Request.RawBytes = MoveTemp(RawBytes[EntryIndex]);
+		Request.DebugMetadata = MoveTemp(DebugMetadata[EntryIndex]);
+		Request.Callback = [Progress, EntryIndex](bool bSaved, FString CallbackFilePath, int32 CallbackSubSlot)
+		{
+			Progress->Results[EntryIndex] = bSaved;
+			if (--Progress->Remaining == 0)
+			{
+				CompleteBatchProgress(*Progress);
+			}
+		};
+	}
+	Progress->Remaining = Requests.Num();
+	return Requests;
+}
+
+void UTurboStructLiteBPLibrary::HandleWildcardSaveBatch(FArrayProperty* ValuesProp, void* ValuesPtr, const FString& MainSlotName, const TArray<int32>& SubSlotIndices, bool bAsync, TFunction<void(bool, const TArray<bool>&)> OnComplete, bool bUseWriteAheadLog, bool bSaveOnlyMarked, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption, ETurboStructLiteCompression Compression, ETurboStructLiteBatchingSetting CompressionBatching, UObject* OwnerObject)
+{
+	TSharedRef<FTurboStructLiteBatchProgress> Progress = MakeShared<FTurboStructLiteBatchProgress>();
+	Progress->Results.Init(false, SubSlotIndices.Num());
+	Progress->OnComplete = MoveTemp(OnComplete);
+	if (!ValuesProp || !ValuesPtr)
+	{
+		ensureMsgf(false, TEXT("TurboStructSaveLiteBatch: invalid wildcard array"));
+		FFrame::KismetExecutionMessage(TEXT("TurboStructSaveLiteBatch: Failed to resolve Wildcard Array"), ELogVerbosity::Error);
+		CompleteBatchProgress(*Progress);
+		return;
+	}
+	if (!IsValidBatchSubSlots(MainSlotName, SubSlotIndices) || FScriptArrayHelper(ValuesProp, ValuesPtr).Num() != SubSlotIndices.Num())
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructSaveLiteBatch: Invalid slot parameters (subslots must be unique, non-negative and match the value count)"), ELogVerbosity::Error);
+		CompleteBatchProgress(*Progress);
+		return;
+	}
+
+	FTurboStructLiteSaveRequest Template;
+	Template.SlotName = MainSlotName;
+	Template.Compression = ResolveCompression(Compression);
+	Template.Encryption = Encryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : Encryption;
+	Template.EncryptionKey = EncryptionKey.IsEmpty() ? GetActiveEncryptionKey() : EncryptionKey;
+	Template.bAsync = bAsync;
+	Template.QueuePriority = FMath::Clamp(QueuePriority, 0, 100);
+	Template.MaxParallelThreads = FMath::Clamp(MaxParallelThreads, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Template.CompressionBatching = CompressionBatching;
+	Template.bUseWriteAheadLog = bUseWriteAheadLog;
+	Template.bSaveOnlyMarked = bSaveOnlyMarked;
+	if (Template.Encryption == ETurboStructLiteEncryption::AES && Template.EncryptionKey.IsEmpty())
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructSaveLiteBatch: AES selected but EncryptionKey is empty"), ELogVerbosity::Error);
+		CompleteBatchProgress(*Progress);
+		return;
+	}
+
+	TArray<FString> WALPaths;
+	if (bUseWriteAheadLog)
+	{
+		const FString SaveOpLabel = FString::Printf(TEXT("SaveBatch_Comp%d_Enc%d"), static_cast<int32>(Template.Compression), static_cast<int32>(Template.Encryption));
+		for (const int32 SubSlotIndex : SubSlotIndices)
+		{
+			const FString& WALPath = WALPaths.Add_GetRef(GenerateWALPath(MainSlotName, SubSlotIndex, SaveOpLabel));
+			WriteWALEntry(WALPath, FString::Printf(TEXT("Queued SaveBatch Slot=%s SubSlot=%d Count=%d Async=%s"), *MainSlotName, SubSlotIndex, SubSlotIndices.Num(), bAsync ? TEXT("true") : TEXT("false")));
+		}
+	}
+	for (const int32 SubSlotIndex : SubSlotIndices)
+	{
+		BeginMemoryOpMessage(MainSlotName, SubSlotIndex, true, false);
+	}
+
+	if (!bAsync)
+	{
+		TArray<FTurboStructLiteSaveRequest> Requests = BuildSaveBatchRequests(ValuesProp, ValuesPtr, SubSlotIndices, WALPaths, Template, Progress);
+		if (Requests.Num() == 0)
+		{
+			CompleteBatchProgress(*Progress);
+			return;
+		}
+		EnqueueSaveBatchRequest(MoveTemp(Requests), Template.QueuePriority);
+		return;
+	}
+
+	// Serialization runs on the pool from a snapshot of the values array.
+	auto StartSerialize = [ValuesProp, SubSlotIndices, WALPaths, Template, Progress](TArray<uint8>&& Snapshot) mutable
+	{
+		Async(EAsyncExecution::ThreadPool, [ValuesProp, Snapshot = MoveTemp(Snapshot), SubSlotIndices = MoveTemp(SubSlotIndices), WALPaths = MoveTemp(WALPaths), Template = MoveTemp(Template), Progress]() mutable
+		{
+			TArray<FTurboStructLiteSaveRequest> Requests = BuildSaveBatchRequests(ValuesProp, Snapshot.GetData(), SubSlotIndices, WALPaths, Template, Progress);
+			ValuesProp->DestroyValue(Snapshot.GetData());
+			AsyncTask(ENamedThreads::GameThread, [Requests = MoveTemp(Requests), Progress, Priority = Template.QueuePriority]() mutable
+			{
+				if (Requests.Num() == 0)
+				{
+					CompleteBatchProgress(*Progress);
+					return;
+				}
+				EnqueueSaveBatchRequest(MoveTemp(Requests), Priority);
+			});
+		});
+	};
+
+	// Arrays owned by a UObject are captured over several frames, like single array saves.
+	const float SnapshotBudgetMs = GetAsyncSnapshotBudgetMs();
+	if (SnapshotBudgetMs > 0.0f && IsValueOwnedByObject(ValuesProp, ValuesPtr, OwnerObject))
+	{
+		CaptureArraySnapshotTimeSliced(ValuesProp, ValuesPtr, OwnerObject, SnapshotBudgetMs, [StartSerialize, SlotName = MainSlotName, SubSlotIndices, WALPaths, Progress](bool bCaptured, TArray<uint8>&& CapturedSnapshot) mutable
+		{
+			if (!bCaptured)
+			{
+				for (int32 EntryIndex = 0; EntryIndex < SubSlotIndices.Num(); ++EntryIndex)
+				{
+					if (WALPaths.IsValidIndex(EntryIndex))
+					{
+						WriteWALEntry(WALPaths[EntryIndex], TEXT("Serialize snapshot aborted"));
+					}
+					EndMemoryOpMessage(SlotName, SubSlotIndices[EntryIndex], true, false);
+				}
+				CompleteBatchProgress(*Progress);
+				return;
+			}
+			StartSerialize(MoveTemp(CapturedSnapshot));
+		});
+		return;
+	}
+
+	TArray<uint8> Snapshot;
+	Snapshot.SetNumUninitialized(ValuesProp->GetSize());
+	ValuesProp->InitializeValue(Snapshot.GetData());
+	ValuesProp->CopyCompleteValue(Snapshot.GetData(), ValuesPtr);
+	StartSerialize(MoveTemp(Snapshot));
+}
+
+void UTurboStructLiteBPLibrary::HandleWildcardLoadBatch(FArrayProperty* ValuesProp, void* ValuesPtr, const FString& MainSlotName, const TArray<int32>& SubSlotIndices, bool bAsync, TFunction<void(bool, const TArray<bool>&)> OnComplete, bool bUseWriteAheadLog, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption)
+{
+	auto Fail = [&OnComplete, &SubSlotIndices]()
+	{
+		if (OnComplete)
+		{
+			TArray<bool> Results;
+			Results.Init(false, SubSlotIndices.Num());
+			OnComplete(false, Results);
+		}
+	};
+	if (!ValuesProp || !ValuesPtr)
+	{
+		ensureMsgf(false, TEXT("TurboStructLoadLiteBatch: invalid wildcard array"));
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadLiteBatch: Failed to resolve Wildcard Array"), ELogVerbosity::Error);
+		Fail();
+		return;
+	}
+	if (MainSlotName.IsEmpty() || SubSlotIndices.Num() == 0 || SubSlotIndices.ContainsByPredicate([](int32 SubSlotIndex) { return SubSlotIndex < 0; }))
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadLiteBatch: Invalid slot parameters"), ELogVerbosity::Error);
+		Fail();
+		return;
+	}
+
+	const ETurboStructLiteEncryption ResolvedEncryption = Encryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : Encryption;
+	FString ResolvedKey = EncryptionKey;
+	if (ResolvedEncryption == ETurboStructLiteEncryption::AES && ResolvedKey.IsEmpty())
+	{
+		ResolvedKey = GetActiveEncryptionKey();
+		if (ResolvedKey.IsEmpty())
+		{
+			FFrame::KismetExecutionMessage(TEXT("TurboStructLoadLiteBatch: AES selected but EncryptionKey is empty"), ELogVerbosity::Error);
+			Fail();
+			return;
+		}
+	}
+	for (const int32 SubSlotIndex : SubSlotIndices)
+	{
+		BeginMemoryOpMessage(MainSlotName, SubSlotIndex, false, false);
+	}
+
+	FTurboStructLiteLoadBatchRequest Request;
+	Request.SlotName = MainSlotName;
+	Request.SubSlotIndices = SubSlotIndices;
+	Request.bAsync = bAsync;
+	Request.DefaultEncryption = ResolvedEncryption;
+	Request.EncryptionKey = ResolvedKey;
+	Request.ValuesProp = ValuesProp;
+	Request.ValuesPtr = ValuesPtr;
+	Request.QueuePriority = FMath::Clamp(QueuePriority, 0, 100);
+	Request.MaxParallelThreads = FMath::Clamp(MaxParallelThreads, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Request.bUseWriteAheadLog = bUseWriteAheadLog;
+	if (bUseWriteAheadLog)
+	{
+		Request.WALPath = GenerateWALPath(MainSlotName, SubSlotIndices[0], FString::Printf(TEXT("LoadBatch_Enc%d"), static_cast<int32>(ResolvedEncryption)));
+		WriteWALEntry(Request.WALPath, FString::Printf(TEXT("Queued LoadBatch Slot=%s Count=%d Async=%s Encryption=%d"), *MainSlotName, SubSlotIndices.Num(), bAsync ? TEXT("true") : TEXT("false"), static_cast<int32>(ResolvedEncryption)));
+	}
+	Request.Callback = MoveTemp(OnComplete);
+	EnqueueLoadBatchRequest(MoveTemp(Request));
+}
+
 void UTurboStructLiteBPLibrary::TurboStructDeleteLite(const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FTurboStructLiteDeleteComplete& OnComplete, int32 QueuePriority)
 {
 	FTurboStructLiteDeleteComplete DelegateCopy = OnComplete;
@@ -339,10 +710,10 @@ void UTurboStructLiteBPLibrary::TurboStructDeleteLite(const FString& MainSlotNam
 		auto Work = [Slot, SubSlotIndex]() -> bool
 		{
 			BeginSlotOperation(Slot);
-			TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(Slot);
+			TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(Slot);
 			bool bRemoved = false;
 			{
-				FScopeLock Lock(OpLock.Get());
+				FWriteScopeLock Lock(*OpLock);
 				bRemoved = UTurboStructLiteBPLibrary::RemoveEntry(Slot, SubSlotIndex);
 			}
 			EndSlotOperation(Slot);
@@ -404,10 +775,10 @@ void UTurboStructLiteBPLibrary::TurboStructExistLite(const FString& MainSlotName
 		auto Work = [Slot, SubSlotIndex, bCheckFileOnly]() -> bool
 		{
 			BeginSlotOperation(Slot);
-			TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(Slot);
+			TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(Slot);
 			bool bExists = false;
 			{
-				FScopeLock Lock(OpLock.Get());
+				FReadScopeLock Lock(*OpLock);
 				if (bCheckFileOnly)
 				{
 					const FString FilePath = BuildSavePath(Slot);
@@ -457,7 +828,7 @@ void UTurboStructLiteBPLibrary::TurboStructExistLite(const FString& MainSlotName
 		FTurboStructLiteExistComplete Local = DelegateCopy;
 		Local.ExecuteIfBound(false);
 	};
-	EnqueueTask(MainSlotName, MoveTemp(Task), ClampedPriority, MoveTemp(CancelCallback));
+	EnqueueTask(MainSlotName, MoveTemp(Task), ClampedPriority, MoveTemp(CancelCallback), true);
 }
 
 void UTurboStructLiteBPLibrary::TurboStructLiteDeleteSlot(const FString& MainSlotName, bool bAsync, const FTurboStructLiteDeleteComplete& OnComplete, int32 QueuePriority)
@@ -477,15 +848,16 @@ void UTurboStructLiteBPLibrary::TurboStructLiteDeleteSlot(const FString& MainSlo
 		auto Work = [Slot]() -> bool
 		{
 			BeginSlotOperation(Slot);
-			TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(Slot);
+			TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(Slot);
 			bool bDeleted = false;
 			{
-				FScopeLock Lock(OpLock.Get());
+				FWriteScopeLock Lock(*OpLock);
 				const FString FilePath = BuildSavePath(Slot);
 				bDeleted = IFileManager::Get().Delete(*FilePath, false, true);
 				if (bDeleted)
 				{
 					InvalidateSlotIndex(Slot);
+					IFileManager::Get().Delete(*BuildIndexPath(Slot), false, true, true);
 				}
 			}
 			EndSlotOperation(Slot);
@@ -556,23 +928,31 @@ void UTurboStructLiteBPLibrary::TurboStructLiteCopySlot(const FString& SourceSlo
 			}
 			const FString FirstName = SourceSanitized < TargetSanitized ? SourceSanitized : TargetSanitized;
 			const FString SecondName = SourceSanitized < TargetSanitized ? TargetSanitized : SourceSanitized;
-			TSharedPtr<FCriticalSection> FirstLock = GetSlotOperationLock(FirstName);
-			TSharedPtr<FCriticalSection> SecondLock = GetSlotOperationLock(SecondName);
+			TSharedPtr<FRWLock> FirstLock = GetSlotOperationLock(FirstName);
+			TSharedPtr<FRWLock> SecondLock = GetSlotOperationLock(SecondName);
 			bool bCopied = false;
 			if (bSameSlot)
 			{
-				FScopeLock LockA(FirstLock.Get());
+				FWriteScopeLock LockA(*FirstLock);
 				const FString SourcePath = BuildSavePath(Source);
 				const FString TargetPath = BuildSavePath(Target);
 				bCopied = IFileManager::Get().Copy(*TargetPath, *SourcePath, true, true) == COPY_OK;
+				if (bCopied)
+				{
+					TransferSecondaryIndexes(Source, Target, false);
+				}
 			}
 			else
 			{
-				FScopeLock LockA(FirstLock.Get());
-				FScopeLock LockB(SecondLock.Get());
+				FWriteScopeLock LockA(*FirstLock);
+				FWriteScopeLock LockB(*SecondLock);
 				const FString SourcePath = BuildSavePath(Source);
 				const FString TargetPath = BuildSavePath(Target);
 				bCopied = IFileManager::Get().Copy(*TargetPath, *SourcePath, true, true) == COPY_OK;
+				if (bCopied)
+				{
+					TransferSecondaryIndexes(Source, Target, false);
+				}
 			}
 			if (bCopied)
 			{
@@ -650,23 +1030,31 @@ void UTurboStructLiteBPLibrary::TurboStructLiteRenameSlot(const FString& SourceS
 			}
 			const FString FirstName = SourceSanitized < TargetSanitized ? SourceSanitized : TargetSanitized;
 			const FString SecondName = SourceSanitized < TargetSanitized ? TargetSanitized : SourceSanitized;
-			TSharedPtr<FCriticalSection> FirstLock = GetSlotOperationLock(FirstName);
-			TSharedPtr<FCriticalSection> SecondLock = GetSlotOperationLock(SecondName);
+			TSharedPtr<FRWLock> FirstLock = GetSlotOperationLock(FirstName);
+			TSharedPtr<FRWLock> SecondLock = GetSlotOperationLock(SecondName);
 			bool bMoved = false;
 			if (bSameSlot)
 			{
-				FScopeLock LockA(FirstLock.Get());
+				FWriteScopeLock LockA(*FirstLock);
 				const FString SourcePath = BuildSavePath(Source);
 				const FString TargetPath = BuildSavePath(Target);
 				bMoved = IFileManager::Get().Move(*TargetPath, *SourcePath, true, true, false, true);
+				if (bMoved)
+				{
+					TransferSecondaryIndexes(Source, Target, true);
+				}
 			}
 			else
 			{
-				FScopeLock LockA(FirstLock.Get());
-				FScopeLock LockB(SecondLock.Get());
+				FWriteScopeLock LockA(*FirstLock);
+				FWriteScopeLock LockB(*SecondLock);
 				const FString SourcePath = BuildSavePath(Source);
 				const FString TargetPath = BuildSavePath(Target);
 				bMoved = IFileManager::Get().Move(*TargetPath, *SourcePath, true, true, false, true);
+				if (bMoved)
+				{
+					TransferSecondaryIndexes(Source, Target, true);
+				}
 			}
 			if (bMoved)
 			{
@@ -778,7 +1166,7 @@ DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructSaveLite)
 	{
 		SaveDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
 	}
-	HandleWildcardSave(DataProp, DataPtr, MainSlotName, SubSlotIndex, bAsync, SaveDelegate, bUseWriteAheadLog, bSaveOnlyMarked, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteCompression>(Compression), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), TEXT("TurboStructSaveLite"), TEXT("data"), TEXT("Data"), TEXT("Save"), true);
+	HandleWildcardSave(DataProp, DataPtr, MainSlotName, SubSlotIndex, bAsync, SaveDelegate, bUseWriteAheadLog, bSaveOnlyMarked, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteCompression>(Compression), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), TEXT("TurboStructSaveLite"), TEXT("data"), TEXT("Data"), TEXT("Save"), true, Stack.Object);
 }
 
 DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructSaveLiteArray)
@@ -810,7 +1198,7 @@ DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructSaveLiteArray)
 	{
 		SaveDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
 	}
-	HandleWildcardSave(ArrayProp, ArrayPtr, MainSlotName, SubSlotIndex, bAsync, SaveDelegate, bUseWriteAheadLog, bSaveOnlyMarked, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteCompression>(Compression), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), TEXT("TurboStructSaveLiteArray"), TEXT("array"), TEXT("Array"), TEXT("SaveArray"), false);
+	HandleWildcardSave(ArrayProp, ArrayPtr, MainSlotName, SubSlotIndex, bAsync, SaveDelegate, bUseWriteAheadLog, bSaveOnlyMarked, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteCompression>(Compression), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), TEXT("TurboStructSaveLiteArray"), TEXT("array"), TEXT("Array"), TEXT("SaveArray"), false, Stack.Object);
 }
 
 DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructLoadLiteArray)
@@ -872,7 +1260,7 @@ DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructSaveLiteMap)
 	{
 		SaveDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
 	}
-	HandleWildcardSave(MapProp, MapPtr, MainSlotName, SubSlotIndex, bAsync, SaveDelegate, bUseWriteAheadLog, bSaveOnlyMarked, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteCompression>(Compression), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), TEXT("TurboStructSaveLiteMap"), TEXT("map"), TEXT("Map"), TEXT("SaveMap"), false);
+	HandleWildcardSave(MapProp, MapPtr, MainSlotName, SubSlotIndex, bAsync, SaveDelegate, bUseWriteAheadLog, bSaveOnlyMarked, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteCompression>(Compression), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), TEXT("TurboStructSaveLiteMap"), TEXT("map"), TEXT("Map"), TEXT("SaveMap"), false, Stack.Object);
 }
 
 DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructLoadLiteMap)
@@ -967,7 +1355,71 @@ DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructLoadLiteSet)
 	HandleWildcardLoad(SetProp, SetPtr, MainSlotName, SubSlotIndex, bAsync, LoadDelegate, bUseWriteAheadLog, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), TEXT("TurboStructLoadLiteSet"), TEXT("set"), TEXT("Set"), TEXT("LoadSet"));
 }
 
+DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructSaveLiteBatch)
+{
+	P_GET_PROPERTY(FStrProperty, MainSlotName);
+	P_GET_TARRAY_REF(int32, SubSlotIndices);
+	P_GET_UBOOL(bAsync);
+
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FArrayProperty>(nullptr);
+	FArrayProperty* ValuesProp = CastField<FArrayProperty>(Stack.MostRecentProperty);
+	void* ValuesPtr = Stack.MostRecentPropertyAddress;
+
+	P_GET_PROPERTY(FDelegateProperty, OnComplete);
+	P_GET_UBOOL(bUseWriteAheadLog);
+	P_GET_UBOOL(bSaveOnlyMarked);
+	P_GET_PROPERTY(FIntProperty, QueuePriority);
+	P_GET_PROPERTY(FIntProperty, MaxParallelThreads);
+	P_GET_PROPERTY(FStrProperty, EncryptionKey);
+	P_GET_ENUM(ETurboStructLiteEncryption, Encryption);
+	P_GET_ENUM(ETurboStructLiteCompression, Compression);
+	P_GET_ENUM(ETurboStructLiteBatchingSetting, CompressionBatching);
+
+	P_FINISH;
+
+	FTurboStructLiteBatchComplete BatchDelegate;
+	if (OnComplete.IsBound())
+	{
+		BatchDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
+	}
+	HandleWildcardSaveBatch(ValuesProp, ValuesPtr, MainSlotName, SubSlotIndices, bAsync, [BatchDelegate](bool bAllSucceeded, const TArray<bool>& EntryResults)
+	{
+		FTurboStructLiteBatchComplete Local = BatchDelegate;
+		Local.ExecuteIfBound(bAllSucceeded, EntryResults);
+	}, bUseWriteAheadLog, bSaveOnlyMarked, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), static_cast<ETurboStructLiteCompression>(Compression), static_cast<ETurboStructLiteBatchingSetting>(CompressionBatching), Stack.Object);
+}
+
+DEFINE_FUNCTION(UTurboStructLiteBPLibrary::execTurboStructLoadLiteBatch)
+{
+	P_GET_PROPERTY(FStrProperty, MainSlotName);
+	P_GET_TARRAY_REF(int32, SubSlotIndices);
+	P_GET_UBOOL(bAsync);
 
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FArrayProperty>(nullptr);
+	FArrayProperty* ValuesProp = CastField<FArrayProperty>(Stack.MostRecentProperty);
+	void* ValuesPtr = Stack.MostRecentPropertyAddress;
 
+	P_GET_PROPERTY(FDelegateProperty, OnComplete);
+	P_GET_UBOOL(bUseWriteAheadLog);
+	P_GET_PROPERTY(FIntProperty, QueuePriority);
+	P_GET_PROPERTY(FIntProperty, MaxParallelThreads);
+	P_GET_PROPERTY(FStrProperty, EncryptionKey);
+	P_GET_ENUM(ETurboStructLiteEncryption, Encryption);
 
+	P_FINISH;
 
+	FTurboStructLiteBatchComplete BatchDelegate;
+	if (OnComplete.IsBound())
+	{
+		BatchDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
+	}
+	HandleWildcardLoadBatch(ValuesProp, ValuesPtr, MainSlotName, SubSlotIndices, bAsync, [BatchDelegate](bool bAllSucceeded, const TArray<bool>& EntryResults)
+	{
+		FTurboStructLiteBatchComplete Local = BatchDelegate;
+		Local.ExecuteIfBound(bAllSucceeded, EntryResults);
+	}, bUseWriteAheadLog, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption));
+}
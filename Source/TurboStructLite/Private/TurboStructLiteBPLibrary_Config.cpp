@@ -138,6 +138,11 @@ void UTurboStructLiteBPLibrary::EnsureSettingsLoaded()
 				ConfigDefaultBatchingMB = FMath::Clamp(RawMB, 2, 32);
 			}
 		}
+		float SnapshotBudgetMs = 0.0f;
+		if (GConfig->GetFloat(TurboStructLiteSettingsSection, TEXT("AsyncSnapshotBudgetMs"), SnapshotBudgetMs, GGameIni))
+		{
+			ConfigAsyncSnapshotBudgetMs = FMath::Max(0.0f, SnapshotBudgetMs);
+		}
 	}
 	ActiveEncryptionMode = ConfigEncryptionMode;
 	if (ActiveEncryptionKey.IsEmpty())
@@ -146,6 +151,7 @@ void UTurboStructLiteBPLibrary::EnsureSettingsLoaded()
 	}
 	ActiveDefaultCompression = ConfigDefaultCompression;
 	ActiveDefaultBatchingMB = ConfigDefaultBatchingMB;
+	ActiveAsyncSnapshotBudgetMs = ConfigAsyncSnapshotBudgetMs;
 	bTurboStructLiteSettingsLoaded = true;
 }
 
@@ -183,6 +189,44 @@ bool UTurboStructLiteBPLibrary::LoadLegacyRedirects(TMap<FString, FString>& OutR
 	return OutRedirects.Num() > 0;
 }
 
+TSharedPtr<const TMap<FString, FString>> UTurboStructLiteBPLibrary::GetLegacyRedirects()
+{
+	FScopeLock Lock(&LegacyRedirectsMutex);
+	if (!bLegacyRedirectsLoaded)
+	{
+		TMap<FString, FString> Redirects;
+		if (LoadLegacyRedirects(Redirects))
+		{
+			CachedLegacyRedirects = MakeShared<TMap<FString, FString>>(MoveTemp(Redirects));
+		}
+		bLegacyRedirectsLoaded = true;
+	}
+	return CachedLegacyRedirects;
+}
+
+void UTurboStructLiteBPLibrary::SetLegacyRedirects(const TMap<FString, FString>& Redirects)
+{
+	TMap<FString, FString> Filtered;
+	Filtered.Reserve(Redirects.Num());
+	for (const TPair<FString, FString>& Pair : Redirects)
+	{
+		if (!Pair.Key.IsEmpty())
+		{
+			Filtered.Add(Pair.Key, Pair.Value);
+		}
+	}
+	{
+		FScopeLock Lock(&LegacyRedirectsMutex);
+		CachedLegacyRedirects.Reset();
+		if (Filtered.Num() > 0)
+		{
+			CachedLegacyRedirects = MakeShared<TMap<FString, FString>>(MoveTemp(Filtered));
+		}
+		bLegacyRedirectsLoaded = true;
+	}
+	ClearLoadPlanCache();
+}
+
 ETurboStructLiteCompression UTurboStructLiteBPLibrary::ResolveCompression(ETurboStructLiteCompression Method)
 {
 	if (Method == ETurboStructLiteCompression::ProjectDefault)
@@ -211,6 +255,12 @@ int32 UTurboStructLiteBPLibrary::ResolveBatchingMB(ETurboStructLiteBatchingSetti
 return FMath::Clamp(Value, 2, 32);
 }
 
+float UTurboStructLiteBPLibrary::GetAsyncSnapshotBudgetMs()
+{
+	EnsureSettingsLoaded();
+	return ActiveAsyncSnapshotBudgetMs;
+}
+
 EAsyncExecution UTurboStructLiteBPLibrary::ResolveAsyncExecution(ETurboStructLiteAsyncExecution Execution)
 {
 	switch (Execution)
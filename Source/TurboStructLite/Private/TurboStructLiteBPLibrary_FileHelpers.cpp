@@ -1,15 +1,20 @@
 #include "TurboStructLiteBPLibrary.h"
 #include "TurboStructLite.h"
+#include "TurboStructLiteConstants.h"
 
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
 #include "HAL/FileManager.h"
 #include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/ThreadSafeBool.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Misc/DateTime.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/AES.h"
+#include "Misc/Compression.h"
 #include "Misc/SecureHash.h"
 #include "HAL/PlatformMisc.h"
 #include "Misc/Guid.h"
@@ -28,6 +33,7 @@
 #define UI UI_ST
 THIRD_PARTY_INCLUDES_START
 #include <openssl/evp.h>
+#include <openssl/hmac.h>
 #include <openssl/rand.h>
 #include <openssl/err.h>
 THIRD_PARTY_INCLUDES_END
@@ -240,101 +246,6 @@ bool UTurboStructLiteBPLibrary::DeriveAESKeyFromString(const FString& Key, const
 	{
 		return false;
 	}
-	TUniquePtr<FEncryptionContext> Context = IPlatformCrypto::Get().CreateContext();
-	if (!Context)
-	{
-		return false;
-	}
-	auto HmacSha256 = [&Context](const uint8* HmacKey, int32 HmacKeyLen, const uint8* Data, int32 DataLen, uint8 OutHash[32]) -> bool
-	{
-		uint8 KeyBlock[64];
-		if (HmacKeyLen > 64)
-		{
-			uint8 KeyHash[32];
-			FSHA256Hasher KeyHasher = Context->CreateSHA256Hasher();
-			if (KeyHasher.Init() != EPlatformCryptoResult::Success)
-			{
-				return false;
-			}
-			if (KeyHasher.Update(TArrayView<const uint8>(HmacKey, HmacKeyLen)) != EPlatformCryptoResult::Success)
-			{
-				return false;
-			}
-			if (KeyHasher.Finalize(TArrayView<uint8>(KeyHash, 32)) != EPlatformCryptoResult::Success)
-			{
-				return false;
-			}
-			FMemory::Memcpy(KeyBlock, KeyHash, 32);
-			FMemory::Memzero(KeyBlock + 32, 32);
-			FMemory::Memzero(KeyHash, sizeof(KeyHash));
-		}
-		else
-		{
-			if (HmacKeyLen > 0)
-			{
-				FMemory::Memcpy(KeyBlock, HmacKey, HmacKeyLen);
-			}
-			if (HmacKeyLen < 64)
-			{
-				FMemory::Memzero(KeyBlock + HmacKeyLen, 64 - HmacKeyLen);
-			}
-		}
-
-		uint8 Ipad[64];
-		uint8 Opad[64];
-		for (int32 Index = 0; Index < 64; ++Index)
-		{
-			Ipad[Index] = KeyBlock[Index] ^ 0x36;
-			Opad[Index] = KeyBlock[Index] ^ 0x5c;
-		}
-
-		uint8 InnerHash[32];
-		FSHA256Hasher InnerHasher = Context->CreateSHA256Hasher();
-		if (InnerHasher.Init() != EPlatformCryptoResult::Success)
-		{
-			return false;
-		}
-		if (InnerHasher.Update(TArrayView<const uint8>(Ipad, 64)) != EPlatformCryptoResult::Success)
-		{
-			return false;
-		}
-		if (DataLen > 0)
-		{
-			if (InnerHasher.Update(TArrayView<const uint8>(Data, DataLen)) != EPlatformCryptoResult::Success)
-			{
-				return false;
-			}
-		}
-		if (InnerHasher.Finalize(TArrayView<uint8>(InnerHash, 32)) != EPlatformCryptoResult::Success)
-		{
-			return false;
-		}
-
-		FSHA256Hasher OuterHasher = Context->CreateSHA256Hasher();
-		if (OuterHasher.Init() != EPlatformCryptoResult::Success)
-		{
-			return false;
-		}
-		if (OuterHasher.Update(TArrayView<const uint8>(Opad, 64)) != EPlatformCryptoResult::Success)
-		{
-			return false;
-		}
-		if (OuterHasher.Update(TArrayView<const uint8>(InnerHash, 32)) != EPlatformCryptoResult::Success)
-		{
-			return false;
-		}
-		if (OuterHasher.Finalize(TArrayView<uint8>(OutHash, 32)) != EPlatformCryptoResult::Success)
-		{
-			return false;
-		}
-
-		FMemory::Memzero(KeyBlock, sizeof(KeyBlock));
-		FMemory::Memzero(Ipad, sizeof(Ipad));
-		FMemory::Memzero(Opad, sizeof(Opad));
-		FMemory::Memzero(InnerHash, sizeof(InnerHash));
-		return true;
-	};
-
 	const int32 HashLen = 32;
 	const int32 DerivedLen = 64;
 	const int32 BlockCount = (DerivedLen + HashLen - 1) / HashLen;
@@ -383,269 +294,642 @@ bool UTurboStructLiteBPLibrary::DeriveAESKeyFromString(const FString& Key, const
 #endif
 }
 
-void UTurboStructLiteBPLibrary::EncryptAesBlock(const uint8* Key, const uint8 InBlock[16], uint8 OutBlock[16])
-{
-	uint8 Block[16];
-	FMemory::Memcpy(Block, InBlock, 16);
-	FAES::EncryptData(Block, FAES::AESBlockSize, Key, 32);
-	FMemory::Memcpy(OutBlock, Block, 16);
-	FMemory::Memzero(Block, 16);
-}
-
-void UTurboStructLiteBPLibrary::GcmIncrement32(uint8 Counter[16])
+bool UTurboStructLiteBPLibrary::GetCachedDerivedKey(const FString& Key, const TArray<uint8>& Salt, uint8 OutKey[32])
 {
-	for (int32 Index = 15; Index >= 12; --Index)
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_GetCachedDerivedKey"));
+	FMemory::Memzero(OutKey, 32);
+	if (Key.IsEmpty() || Salt.Num() <= 0)
 	{
-		uint8 Value = Counter[Index];
-		Counter[Index] = static_cast<uint8>(Value + 1);
-		if (Counter[Index] != 0)
-		{
-			break;
+		return false;
+	}
+	// The cache is keyed by a hash of (key, salt) so key strings are never stored.
+	const FTCHARToUTF8 KeyUtf8(*Key);
+	const int32 KeyLen = KeyUtf8.Length();
+	TArray<uint8> Input;
+	Input.Reserve(4 + KeyLen + Salt.Num());
+	Input.Add(static_cast<uint8>((KeyLen >> 24) & 0xFF));
+	Input.Add(static_cast<uint8>((KeyLen >> 16) & 0xFF));
+	Input.Add(static_cast<uint8>((KeyLen >> 8) & 0xFF));
+	Input.Add(static_cast<uint8>(KeyLen & 0xFF));
+	Input.Append(reinterpret_cast<const uint8*>(KeyUtf8.Get()), KeyLen);
+	Input.Append(Salt);
+	uint8 InputHash[32];
+	CalculateTurboHash(Input.GetData(), Input.Num(), InputHash);
+	FMemory::Memzero(Input.GetData(), Input.Num());
+
+	{
+		FScopeLock Lock(&DerivedKeyCacheMutex);
+		for (FTurboStructLiteDerivedKey& Cached : DerivedKeyCache)
+		{
+			if (FMemory::Memcmp(Cached.InputHash, InputHash, 32) == 0)
+			{
+				Cached.LastUse = ++DerivedKeyCacheTick;
+				FMemory::Memcpy(OutKey, Cached.Key, 32);
+				FMemory::Memzero(InputHash, sizeof(InputHash));
+				return true;
+			}
 		}
 	}
-}
 
-void UTurboStructLiteBPLibrary::GcmRightShift(uint8 Block[16])
-{
-	uint8 Carry = 0;
-	for (int32 Index = 0; Index < 16; ++Index)
+	// Derive outside the lock so independent keys can be stretched in parallel.
+	uint8 Derived[64];
+	if (!DeriveAESKeyFromString(Key, Salt, Derived))
 	{
-		const uint8 NewCarry = static_cast<uint8>(Block[Index] & 0x01);
-		Block[Index] = static_cast<uint8>((Block[Index] >> 1) | (Carry ? 0x80 : 0x00));
-		Carry = NewCarry;
+		FMemory::Memzero(InputHash, sizeof(InputHash));
+		return false;
 	}
-}
-
-void UTurboStructLiteBPLibrary::GcmMultiply(const uint8 X[16], const uint8 Y[16], uint8 Out[16])
-{
-	uint8 Z[16];
-	uint8 V[16];
-	FMemory::Memzero(Z, 16);
-	FMemory::Memcpy(V, Y, 16);
+	FMemory::Memcpy(OutKey, Derived, 32);
+	FMemory::Memzero(Derived, sizeof(Derived));
 
-	for (int32 ByteIndex = 0; ByteIndex < 16; ++ByteIndex)
 	{
-		const uint8 XByte = X[ByteIndex];
-		for (int32 Bit = 7; Bit >= 0; --Bit)
+		FScopeLock Lock(&DerivedKeyCacheMutex);
+		bool bAlreadyCached = false;
+		for (const FTurboStructLiteDerivedKey& Cached : DerivedKeyCache)
 		{
-			if (XByte & (1 << Bit))
+			if (FMemory::Memcmp(Cached.InputHash, InputHash, 32) == 0)
 			{
-				for (int32 Index = 0; Index < 16; ++Index)
-				{
-					Z[Index] ^= V[Index];
-				}
+				bAlreadyCached = true;
+				break;
 			}
-			const bool bLsb = (V[15] & 0x01) != 0;
-			GcmRightShift(V);
-			if (bLsb)
+		}
+		if (!bAlreadyCached)
+		{
+			if (DerivedKeyCache.Num() >= TurboStructLiteDerivedKeyCacheSize)
 			{
-				V[0] ^= 0xe1;
+				int32 OldestIndex = 0;
+				for (int32 Index = 1; Index < DerivedKeyCache.Num(); ++Index)
+				{
+					if (DerivedKeyCache[Index].LastUse < DerivedKeyCache[OldestIndex].LastUse)
+					{
+						OldestIndex = Index;
+					}
+				}
+				FMemory::Memzero(&DerivedKeyCache[OldestIndex], sizeof(FTurboStructLiteDerivedKey));
+				DerivedKeyCache.RemoveAtSwap(OldestIndex);
 			}
+			FTurboStructLiteDerivedKey& NewCached = DerivedKeyCache.AddDefaulted_GetRef();
+			FMemory::Memcpy(NewCached.InputHash, InputHash, 32);
+			FMemory::Memcpy(NewCached.Key, OutKey, 32);
+			NewCached.LastUse = ++DerivedKeyCacheTick;
 		}
 	}
-
-	FMemory::Memcpy(Out, Z, 16);
-	FMemory::Memzero(Z, 16);
-	FMemory::Memzero(V, 16);
+	FMemory::Memzero(InputHash, sizeof(InputHash));
+	return true;
 }
 
-void UTurboStructLiteBPLibrary::GcmUpdate(uint8 Xi[16], const uint8* Data, int32 DataLen, const uint8 H[16])
+bool UTurboStructLiteBPLibrary::GetSessionMasterSalt(uint8 OutSalt[16])
 {
-	int32 Offset = 0;
-	while (Offset < DataLen)
+	FScopeLock Lock(&MasterSaltMutex);
+	if (SessionMasterSalt.Num() != TurboStructLiteMasterSaltSize)
 	{
-		uint8 Block[16];
-		FMemory::Memzero(Block, 16);
-		const int32 BlockSize = FMath::Min(16, DataLen - Offset);
-		if (BlockSize > 0)
-		{
-			FMemory::Memcpy(Block, Data + Offset, BlockSize);
-		}
-		for (int32 Index = 0; Index < 16; ++Index)
+		uint8 NewSalt[TurboStructLiteMasterSaltSize];
+		if (!FillRandomBytes(NewSalt, TurboStructLiteMasterSaltSize))
 		{
-			Xi[Index] ^= Block[Index];
+			return false;
 		}
-		uint8 Product[16];
-		GcmMultiply(Xi, H, Product);
-		FMemory::Memcpy(Xi, Product, 16);
-		FMemory::Memzero(Block, 16);
-		FMemory::Memzero(Product, 16);
-		Offset += BlockSize;
+		SessionMasterSalt.Reset();
+		SessionMasterSalt.Append(NewSalt, TurboStructLiteMasterSaltSize);
 	}
+	FMemory::Memcpy(OutSalt, SessionMasterSalt.GetData(), TurboStructLiteMasterSaltSize);
+	return true;
 }
 
-void UTurboStructLiteBPLibrary::GcmFinalize(uint8 Xi[16], uint64 AadBits, uint64 CipherBits, const uint8 H[16])
+bool UTurboStructLiteBPLibrary::DeriveEntryAESKey(const FString& Key, const uint8* MasterSalt, const uint8* Salt, int32 SaltLen, uint8 OutKey[32])
 {
-	uint8 LenBlock[16];
-	FMemory::Memzero(LenBlock, 16);
-	for (int32 Index = 0; Index < 8; ++Index)
+	FMemory::Memzero(OutKey, 32);
+	if (!Salt || SaltLen <= 0)
 	{
-		LenBlock[Index] = static_cast<uint8>((AadBits >> (56 - (Index * 8))) & 0xFF);
+		return false;
 	}
-	for (int32 Index = 0; Index < 8; ++Index)
+	// The expensive PBKDF2 stretch runs once per (key, master salt); entries only pay for HKDF.
+	// Payloads written before master salts were stored all share the fixed legacy salt.
+	static const ANSICHAR LegacyMasterSaltText[] = "TurboStructLite.MasterKey.v1";
+	TArray<uint8> MasterSaltBytes;
+	if (MasterSalt)
 	{
-		LenBlock[8 + Index] = static_cast<uint8>((CipherBits >> (56 - (Index * 8))) & 0xFF);
+		MasterSaltBytes.Append(MasterSalt, TurboStructLiteMasterSaltSize);
 	}
-	for (int32 Index = 0; Index < 16; ++Index)
+	else
 	{
-		Xi[Index] ^= LenBlock[Index];
+		MasterSaltBytes.Append(reinterpret_cast<const uint8*>(LegacyMasterSaltText), sizeof(LegacyMasterSaltText) - 1);
 	}
-	uint8 Product[16];
-	GcmMultiply(Xi, H, Product);
-	FMemory::Memcpy(Xi, Product, 16);
-	FMemory::Memzero(LenBlock, 16);
-	FMemory::Memzero(Product, 16);
-}
-
-void UTurboStructLiteBPLibrary::GcmBuildJ0(const uint8* IV, int32 IVLen, const uint8 H[16], uint8 OutJ0[16])
-{
-	FMemory::Memzero(OutJ0, 16);
-	if (IV && IVLen == 12)
+	uint8 MasterKey[32];
+	if (!GetCachedDerivedKey(Key, MasterSaltBytes, MasterKey))
 	{
-		FMemory::Memcpy(OutJ0, IV, 12);
-		OutJ0[15] = 1;
-		return;
+		return false;
 	}
 
-	uint8 Xi[16];
-	FMemory::Memzero(Xi, 16);
-	if (IV && IVLen > 0)
+	// HKDF-SHA256: PRK = HMAC(Salt, MasterKey), OKM = HMAC(PRK, Info || 0x01).
+	static const ANSICHAR InfoText[] = "TurboStructLite AES-256-GCM entry";
+	uint8 Info[sizeof(InfoText)];
+	FMemory::Memcpy(Info, InfoText, sizeof(InfoText) - 1);
+	Info[sizeof(InfoText) - 1] = 0x01;
+	uint8 Prk[32];
+	const bool bSuccess = HmacSha256(Salt, SaltLen, MasterKey, 32, Prk)
+		&& HmacSha256(Prk, 32, Info, sizeof(Info), OutKey);
+	FMemory::Memzero(MasterKey, sizeof(MasterKey));
+	FMemory::Memzero(Prk, sizeof(Prk));
+	if (!bSuccess)
 	{
-		GcmUpdate(Xi, IV, IVLen, H);
+		FMemory::Memzero(OutKey, 32);
 	}
-	GcmFinalize(Xi, 0, static_cast<uint64>(IVLen) * 8, H);
-	FMemory::Memcpy(OutJ0, Xi, 16);
-	FMemory::Memzero(Xi, 16);
+	return bSuccess;
 }
 
-void UTurboStructLiteBPLibrary::GcmCtrCrypt(const uint8* Key, const uint8 J0[16], const uint8* In, int32 InLen, TArray<uint8>& Out)
+void UTurboStructLiteBPLibrary::ClearDerivedKeyCache()
 {
-	Out.SetNum(InLen);
-	if (InLen <= 0)
+	FScopeLock Lock(&DerivedKeyCacheMutex);
+	if (DerivedKeyCache.Num() > 0)
 	{
-		return;
+		FMemory::Memzero(DerivedKeyCache.GetData(), DerivedKeyCache.Num() * sizeof(FTurboStructLiteDerivedKey));
 	}
+	DerivedKeyCache.Empty();
+}
 
-	uint8 Counter[16];
-	FMemory::Memcpy(Counter, J0, 16);
-	GcmIncrement32(Counter);
-
-	int32 Offset = 0;
-	while (Offset < InLen)
+bool UTurboStructLiteBPLibrary::HmacSha256(const uint8* Key, int32 KeyLen, const uint8* Data, int32 DataLen, uint8 OutHash[32])
+{
+#if TURBOSTRUCTLITE_USE_OPENSSL
+	unsigned int OutLen = 0;
+	if (!HMAC(EVP_sha256(), Key, KeyLen, Data, DataLen, OutHash, &OutLen) || OutLen != 32)
+	{
+		FMemory::Memzero(OutHash, 32);
+		return false;
+	}
+	return true;
+#else
+	TUniquePtr<FEncryptionContext> Context = IPlatformCrypto::Get().CreateContext();
+	if (!Context)
+	{
+		return false;
+	}
+	uint8 KeyBlock[64];
+	FMemory::Memzero(KeyBlock, sizeof(KeyBlock));
+	if (KeyLen > 64)
 	{
-		uint8 Stream[16];
-		EncryptAesBlock(Key, Counter, Stream);
-		const int32 BlockSize = FMath::Min(16, InLen - Offset);
-		for (int32 Index = 0; Index < BlockSize; ++Index)
+		FSHA256Hasher KeyHasher = Context->CreateSHA256Hasher();
+		if (KeyHasher.Init() != EPlatformCryptoResult::Success
+			|| KeyHasher.Update(TArrayView<const uint8>(Key, KeyLen)) != EPlatformCryptoResult::Success
+			|| KeyHasher.Finalize(TArrayView<uint8>(KeyBlock, 32)) != EPlatformCryptoResult::Success)
 		{
-			Out[Offset + Index] = In[Offset + Index] ^ Stream[Index];
+			return false;
 		}
-		GcmIncrement32(Counter);
-		FMemory::Memzero(Stream, 16);
-		Offset += BlockSize;
 	}
-	FMemory::Memzero(Counter, 16);
+	else if (KeyLen > 0)
+	{
+		FMemory::Memcpy(KeyBlock, Key, KeyLen);
+	}
+	uint8 Ipad[64];
+	uint8 Opad[64];
+	for (int32 Index = 0; Index < 64; ++Index)
+	{
+		Ipad[Index] = KeyBlock[Index] ^ 0x36;
+		Opad[Index] = KeyBlock[Index] ^ 0x5c;
+	}
+	uint8 InnerHash[32];
+	FSHA256Hasher InnerHasher = Context->CreateSHA256Hasher();
+	FSHA256Hasher OuterHasher = Context->CreateSHA256Hasher();
+	const bool bSuccess = InnerHasher.Init() == EPlatformCryptoResult::Success
+		&& InnerHasher.Update(TArrayView<const uint8>(Ipad, 64)) == EPlatformCryptoResult::Success
+		&& (DataLen <= 0 || InnerHasher.Update(TArrayView<const uint8>(Data, DataLen)) == EPlatformCryptoResult::Success)
+		&& InnerHasher.Finalize(TArrayView<uint8>(InnerHash, 32)) == EPlatformCryptoResult::Success
+		&& OuterHasher.Init() == EPlatformCryptoResult::Success
+		&& OuterHasher.Update(TArrayView<const uint8>(Opad, 64)) == EPlatformCryptoResult::Success
+		&& OuterHasher.Update(TArrayView<const uint8>(InnerHash, 32)) == EPlatformCryptoResult::Success
+		&& OuterHasher.Finalize(TArrayView<uint8>(OutHash, 32)) == EPlatformCryptoResult::Success;
+	FMemory::Memzero(KeyBlock, sizeof(KeyBlock));
+	FMemory::Memzero(Ipad, sizeof(Ipad));
+	FMemory::Memzero(Opad, sizeof(Opad));
+	FMemory::Memzero(InnerHash, sizeof(InnerHash));
+	return bSuccess;
+#endif
 }
 
-bool UTurboStructLiteBPLibrary::GcmConstantTimeEqual(const uint8* A, const uint8* B, int32 Len)
+bool UTurboStructLiteBPLibrary::FillRandomBytes(uint8* Out, int32 Len)
 {
-	uint8 Diff = 0;
-	for (int32 Index = 0; Index < Len; ++Index)
+#if TURBOSTRUCTLITE_USE_OPENSSL
+	return RAND_bytes(Out, Len) == 1;
+#else
+	TUniquePtr<FEncryptionContext> Context = IPlatformCrypto::Get().CreateContext();
+	if (!Context)
 	{
-		Diff |= static_cast<uint8>(A[Index] ^ B[Index]);
+		return false;
 	}
-	return Diff == 0;
+	return Context->CreateRandomBytes(TArrayView<uint8>(Out, Len)) == EPlatformCryptoResult::Success;
+#endif
 }
 
-bool UTurboStructLiteBPLibrary::EncryptAesGcmFallback(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Plaintext, int32 PlaintextLen, TArray<uint8>& OutCiphertext, TArray<uint8>& OutTag)
+bool UTurboStructLiteBPLibrary::EncryptAesGcm(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Plaintext, int32 PlaintextLen, TArray<uint8>& OutCiphertext, uint8 OutTag[16])
 {
-	if (!Key || !IV || IVLen <= 0)
+#if TURBOSTRUCTLITE_USE_OPENSSL
+	bool bSuccess = false;
+	int32 Len = 0;
+	int32 CiphertextLen = 0;
+	EVP_CIPHER_CTX* Ctx = EVP_CIPHER_CTX_new();
+	if (!Ctx)
 	{
 		return false;
 	}
-	if (PlaintextLen < 0 || (PlaintextLen > 0 && !Plaintext))
+	if (1 != EVP_EncryptInit_ex(Ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr))
 	{
-		return false;
+		goto Cleanup;
 	}
-
-	uint8 Zero[16];
-	FMemory::Memzero(Zero, 16);
-	uint8 H[16];
-	EncryptAesBlock(Key, Zero, H);
-
-	uint8 J0[16];
-	GcmBuildJ0(IV, IVLen, H, J0);
-
-	GcmCtrCrypt(Key, J0, Plaintext, PlaintextLen, OutCiphertext);
-
-	uint8 Xi[16];
-	FMemory::Memzero(Xi, 16);
-	if (OutCiphertext.Num() > 0)
+	if (1 != EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_SET_IVLEN, IVLen, nullptr))
 	{
-		GcmUpdate(Xi, OutCiphertext.GetData(), OutCiphertext.Num(), H);
+		goto Cleanup;
 	}
-	GcmFinalize(Xi, 0, static_cast<uint64>(OutCiphertext.Num()) * 8, H);
-
-	uint8 TagBlock[16];
-	EncryptAesBlock(Key, J0, TagBlock);
-	OutTag.SetNum(16);
-	for (int32 Index = 0; Index < 16; ++Index)
+	if (1 != EVP_EncryptInit_ex(Ctx, nullptr, nullptr, Key, IV))
 	{
-		OutTag[Index] = static_cast<uint8>(TagBlock[Index] ^ Xi[Index]);
+		goto Cleanup;
 	}
-
-	FMemory::Memzero(Zero, 16);
-	FMemory::Memzero(H, 16);
-	FMemory::Memzero(J0, 16);
-	FMemory::Memzero(Xi, 16);
-	FMemory::Memzero(TagBlock, 16);
-	return true;
-}
-
-bool UTurboStructLiteBPLibrary::DecryptAesGcmFallback(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Ciphertext, int32 CiphertextLen, const uint8* Tag, int32 TagLen, TArray<uint8>& OutPlaintext)
-{
-	if (!Key || !IV || !Tag || IVLen <= 0 || TagLen != 16)
+	OutCiphertext.SetNumUninitialized(PlaintextLen + 16);
+	if (1 != EVP_EncryptUpdate(Ctx, OutCiphertext.GetData(), &Len, Plaintext, PlaintextLen))
 	{
-		return false;
+		goto Cleanup;
 	}
-	if (CiphertextLen < 0 || (CiphertextLen > 0 && !Ciphertext))
+	CiphertextLen = Len;
+	if (1 != EVP_EncryptFinal_ex(Ctx, OutCiphertext.GetData() + Len, &Len))
 	{
-		return false;
+		goto Cleanup;
 	}
-
-	uint8 Zero[16];
-	FMemory::Memzero(Zero, 16);
-	uint8 H[16];
-	EncryptAesBlock(Key, Zero, H);
-
-	uint8 J0[16];
-	GcmBuildJ0(IV, IVLen, H, J0);
-
-	uint8 Xi[16];
-	FMemory::Memzero(Xi, 16);
-	if (CiphertextLen > 0)
+	CiphertextLen += Len;
+	OutCiphertext.SetNum(CiphertextLen);
+	if (1 != EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_GET_TAG, 16, OutTag))
 	{
-		GcmUpdate(Xi, Ciphertext, CiphertextLen, H);
+		goto Cleanup;
 	}
-	GcmFinalize(Xi, 0, static_cast<uint64>(CiphertextLen) * 8, H);
+	bSuccess = true;
 
-	uint8 TagBlock[16];
-	uint8 Expected[16];
-	EncryptAesBlock(Key, J0, TagBlock);
-	for (int32 Index = 0; Index < 16; ++Index)
+Cleanup:
+	EVP_CIPHER_CTX_free(Ctx);
+	if (!bSuccess)
 	{
-		Expected[Index] = static_cast<uint8>(TagBlock[Index] ^ Xi[Index]);
+		OutCiphertext.Reset();
 	}
-
-	const bool bMatch = GcmConstantTimeEqual(Tag, Expected, 16);
-	if (!bMatch)
+	return bSuccess;
+#else
+	TArray<uint8> Tag;
+	if (!EncryptAesGcmFallback(Key, IV, IVLen, Plaintext, PlaintextLen, OutCiphertext, Tag) || Tag.Num() != 16)
 	{
-		FMemory::Memzero(Zero, 16);
-		FMemory::Memzero(H, 16);
-		FMemory::Memzero(J0, 16);
-		FMemory::Memzero(Xi, 16);
-		FMemory::Memzero(TagBlock, 16);
-		FMemory::Memzero(Expected, 16);
+		OutCiphertext.Reset();
+		return false;
+	}
+	FMemory::Memcpy(OutTag, Tag.GetData(), 16);
+	return true;
+#endif
+}
+
+bool UTurboStructLiteBPLibrary::DecryptAesGcm(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Ciphertext, int32 CiphertextLen, const uint8* Tag, TArray<uint8>& OutPlaintext)
+{
+#if TURBOSTRUCTLITE_USE_OPENSSL
+	bool bSuccess = false;
+	int32 Len = 0;
+	int32 PlaintextLen = 0;
+	EVP_CIPHER_CTX* Ctx = EVP_CIPHER_CTX_new();
+	if (!Ctx)
+	{
+		return false;
+	}
+	if (1 != EVP_DecryptInit_ex(Ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr))
+	{
+		goto Cleanup;
+	}
+	if (1 != EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_SET_IVLEN, IVLen, nullptr))
+	{
+		goto Cleanup;
+	}
+	if (1 != EVP_DecryptInit_ex(Ctx, nullptr, nullptr, Key, IV))
+	{
+		goto Cleanup;
+	}
+	OutPlaintext.SetNumUninitialized(CiphertextLen + 16);
+	if (1 != EVP_DecryptUpdate(Ctx, OutPlaintext.GetData(), &Len, Ciphertext, CiphertextLen))
+	{
+		goto Cleanup;
+	}
+	PlaintextLen = Len;
+	if (1 != EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_SET_TAG, 16, const_cast<uint8*>(Tag)))
+	{
+		goto Cleanup;
+	}
+	if (EVP_DecryptFinal_ex(Ctx, OutPlaintext.GetData() + Len, &Len) <= 0)
+	{
+		goto Cleanup;
+	}
+	PlaintextLen += Len;
+	OutPlaintext.SetNum(PlaintextLen);
+	bSuccess = true;
+
+Cleanup:
+	EVP_CIPHER_CTX_free(Ctx);
+	if (!bSuccess && OutPlaintext.Num() > 0)
+	{
+		FMemory::Memzero(OutPlaintext.GetData(), OutPlaintext.Num());
+		OutPlaintext.Reset();
+	}
+	return bSuccess;
+#else
+	return DecryptAesGcmFallback(Key, IV, IVLen, Ciphertext, CiphertextLen, Tag, 16, OutPlaintext);
+#endif
+}
+
+void UTurboStructLiteBPLibrary::EncryptAesBlock(const uint8* Key, const uint8 InBlock[16], uint8 OutBlock[16])
+{
+	uint8 Block[16];
+	FMemory::Memcpy(Block, InBlock, 16);
+	FAES::EncryptData(Block, FAES::AESBlockSize, Key, 32);
+	FMemory::Memcpy(OutBlock, Block, 16);
+	FMemory::Memzero(Block, 16);
+}
+
+void UTurboStructLiteBPLibrary::GcmIncrement32(uint8 Counter[16])
+{
+	for (int32 Index = 15; Index >= 12; --Index)
+	{
+		uint8 Value = Counter[Index];
+		Counter[Index] = static_cast<uint8>(Value + 1);
+		if (Counter[Index] != 0)
+		{
+			break;
+		}
+	}
+}
+
+void UTurboStructLiteBPLibrary::GcmInitTable(const uint8 H[16], FTurboStructLiteGhashTable& OutTable)
+{
+	uint64 VHigh = 0;
+	uint64 VLow = 0;
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		VHigh = (VHigh << 8) | H[Index];
+		VLow = (VLow << 8) | H[8 + Index];
+	}
+	// Shoup's 4-bit table: entry i holds i*H for the nibble i (bit-reflected GCM order).
+	OutTable.High[0] = 0;
+	OutTable.Low[0] = 0;
+	OutTable.High[8] = VHigh;
+	OutTable.Low[8] = VLow;
+	for (int32 Index = 4; Index > 0; Index >>= 1)
+	{
+		const uint64 Reduce = (VLow & 1) ? 0xe100000000000000ull : 0ull;
+		VLow = (VHigh << 63) | (VLow >> 1);
+		VHigh = (VHigh >> 1) ^ Reduce;
+		OutTable.High[Index] = VHigh;
+		OutTable.Low[Index] = VLow;
+	}
+	for (int32 Index = 2; Index <= 8; Index <<= 1)
+	{
+		for (int32 Sub = 1; Sub < Index; ++Sub)
+		{
+			OutTable.High[Index + Sub] = OutTable.High[Index] ^ OutTable.High[Sub];
+			OutTable.Low[Index + Sub] = OutTable.Low[Index] ^ OutTable.Low[Sub];
+		}
+	}
+}
+
+void UTurboStructLiteBPLibrary::GcmMultiply(uint8 Xi[16], const FTurboStructLiteGhashTable& Table)
+{
+	static const uint64 Last4[16] =
+	{
+		0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+		0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+	};
+
+	uint8 Nibble = static_cast<uint8>(Xi[15] & 0x0f);
+	uint64 ZHigh = Table.High[Nibble];
+	uint64 ZLow = Table.Low[Nibble];
+	for (int32 Index = 15; Index >= 0; --Index)
+	{
+		const uint8 LowNibble = static_cast<uint8>(Xi[Index] & 0x0f);
+		const uint8 HighNibble = static_cast<uint8>(Xi[Index] >> 4);
+		if (Index != 15)
+		{
+			const uint8 Rem = static_cast<uint8>(ZLow & 0x0f);
+			ZLow = (ZHigh << 60) | (ZLow >> 4);
+			ZHigh = (ZHigh >> 4) ^ (Last4[Rem] << 48);
+			ZHigh ^= Table.High[LowNibble];
+			ZLow ^= Table.Low[LowNibble];
+		}
+		const uint8 Rem = static_cast<uint8>(ZLow & 0x0f);
+		ZLow = (ZHigh << 60) | (ZLow >> 4);
+		ZHigh = (ZHigh >> 4) ^ (Last4[Rem] << 48);
+		ZHigh ^= Table.High[HighNibble];
+		ZLow ^= Table.Low[HighNibble];
+	}
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		Xi[Index] = static_cast<uint8>((ZHigh >> (56 - (Index * 8))) & 0xFF);
+		Xi[8 + Index] = static_cast<uint8>((ZLow >> (56 - (Index * 8))) & 0xFF);
+	}
+}
+
+void UTurboStructLiteBPLibrary::GcmUpdate(uint8 Xi[16], const uint8* Data, int32 DataLen, const FTurboStructLiteGhashTable& Table)
+{
+	int32 Offset = 0;
+	while (DataLen - Offset >= 16)
+	{
+		for (int32 Index = 0; Index < 16; ++Index)
+		{
+			Xi[Index] ^= Data[Offset + Index];
+		}
+		GcmMultiply(Xi, Table);
+		Offset += 16;
+	}
+	if (Offset < DataLen)
+	{
+		const int32 Tail = DataLen - Offset;
+		for (int32 Index = 0; Index < Tail; ++Index)
+		{
+			Xi[Index] ^= Data[Offset + Index];
+		}
+		GcmMultiply(Xi, Table);
+	}
+}
+
+void UTurboStructLiteBPLibrary::GcmFinalize(uint8 Xi[16], uint64 AadBits, uint64 CipherBits, const FTurboStructLiteGhashTable& Table)
+{
+	uint8 LenBlock[16];
+	FMemory::Memzero(LenBlock, 16);
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		LenBlock[Index] = static_cast<uint8>((AadBits >> (56 - (Index * 8))) & 0xFF);
+	}
+	for (int32 Index = 0; Index < 8; ++Index)
+	{
+		LenBlock[8 + Index] = static_cast<uint8>((CipherBits >> (56 - (Index * 8))) & 0xFF);
+	}
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		Xi[Index] ^= LenBlock[Index];
+	}
+	GcmMultiply(Xi, Table);
+	FMemory::Memzero(LenBlock, 16);
+}
+
+void UTurboStructLiteBPLibrary::GcmBuildJ0(const uint8* IV, int32 IVLen, const FTurboStructLiteGhashTable& Table, uint8 OutJ0[16])
+{
+	FMemory::Memzero(OutJ0, 16);
+	if (IV && IVLen == 12)
+	{
+		FMemory::Memcpy(OutJ0, IV, 12);
+		OutJ0[15] = 1;
+		return;
+	}
+
+	uint8 Xi[16];
+	FMemory::Memzero(Xi, 16);
+	if (IV && IVLen > 0)
+	{
+		GcmUpdate(Xi, IV, IVLen, Table);
+	}
+	GcmFinalize(Xi, 0, static_cast<uint64>(IVLen) * 8, Table);
+	FMemory::Memcpy(OutJ0, Xi, 16);
+	FMemory::Memzero(Xi, 16);
+}
+
+void UTurboStructLiteBPLibrary::GcmCtrCrypt(const uint8* Key, const uint8 J0[16], const uint8* In, int32 InLen, TArray<uint8>& Out)
+{
+	Out.SetNumUninitialized(InLen);
+	if (InLen <= 0)
+	{
+		return;
+	}
+
+	uint8 Counter[16];
+	FMemory::Memcpy(Counter, J0, 16);
+	GcmIncrement32(Counter);
+
+	// Build a batch of counter blocks and encrypt them in one FAES call so the key
+	// schedule is expanded once per batch instead of once per block.
+	TArray<uint8> Stream;
+	Stream.SetNumUninitialized(FMath::Min(InLen + 15, TurboStructLiteGcmCtrBatchBlocks * 16) & ~15);
+	uint8* Output = Out.GetData();
+	int32 Offset = 0;
+	while (Offset < InLen)
+	{
+		const int32 BatchBytes = FMath::Min(Stream.Num(), (InLen - Offset + 15) & ~15);
+		for (int32 BlockOffset = 0; BlockOffset < BatchBytes; BlockOffset += 16)
+		{
+			FMemory::Memcpy(Stream.GetData() + BlockOffset, Counter, 16);
+			GcmIncrement32(Counter);
+		}
+		FAES::EncryptData(Stream.GetData(), BatchBytes, Key, 32);
+		const int32 ProcessBytes = FMath::Min(BatchBytes, InLen - Offset);
+		const uint8* StreamData = Stream.GetData();
+		for (int32 Index = 0; Index < ProcessBytes; ++Index)
+		{
+			Output[Offset + Index] = In[Offset + Index] ^ StreamData[Index];
+		}
+		Offset += ProcessBytes;
+	}
+	FMemory::Memzero(Stream.GetData(), Stream.Num());
+	FMemory::Memzero(Counter, 16);
+}
+
+bool UTurboStructLiteBPLibrary::GcmConstantTimeEqual(const uint8* A, const uint8* B, int32 Len)
+{
+	uint8 Diff = 0;
+	for (int32 Index = 0; Index < Len; ++Index)
+	{
+		Diff |= static_cast<uint8>(A[Index] ^ B[Index]);
+	}
+	return Diff == 0;
+}
+
+bool UTurboStructLiteBPLibrary::EncryptAesGcmFallback(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Plaintext, int32 PlaintextLen, TArray<uint8>& OutCiphertext, TArray<uint8>& OutTag)
+{
+	if (!Key || !IV || IVLen <= 0)
+	{
+		return false;
+	}
+	if (PlaintextLen < 0 || (PlaintextLen > 0 && !Plaintext))
+	{
+		return false;
+	}
+
+	uint8 Zero[16];
+	FMemory::Memzero(Zero, 16);
+	uint8 H[16];
+	EncryptAesBlock(Key, Zero, H);
+	FTurboStructLiteGhashTable Table;
+	GcmInitTable(H, Table);
+
+	uint8 J0[16];
+	GcmBuildJ0(IV, IVLen, Table, J0);
+
+	GcmCtrCrypt(Key, J0, Plaintext, PlaintextLen, OutCiphertext);
+
+	uint8 Xi[16];
+	FMemory::Memzero(Xi, 16);
+	if (OutCiphertext.Num() > 0)
+	{
+		GcmUpdate(Xi, OutCiphertext.GetData(), OutCiphertext.Num(), Table);
+	}
+	GcmFinalize(Xi, 0, static_cast<uint64>(OutCiphertext.Num()) * 8, Table);
+
+	uint8 TagBlock[16];
+	EncryptAesBlock(Key, J0, TagBlock);
+	OutTag.SetNum(16);
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		OutTag[Index] = static_cast<uint8>(TagBlock[Index] ^ Xi[Index]);
+	}
+
+	FMemory::Memzero(Zero, 16);
+	FMemory::Memzero(H, 16);
+	FMemory::Memzero(&Table, sizeof(Table));
+	FMemory::Memzero(J0, 16);
+	FMemory::Memzero(Xi, 16);
+	FMemory::Memzero(TagBlock, 16);
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::DecryptAesGcmFallback(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Ciphertext, int32 CiphertextLen, const uint8* Tag, int32 TagLen, TArray<uint8>& OutPlaintext)
+{
+	if (!Key || !IV || !Tag || IVLen <= 0 || TagLen != 16)
+	{
+		return false;
+	}
+	if (CiphertextLen < 0 || (CiphertextLen > 0 && !Ciphertext))
+	{
+		return false;
+	}
+
+	uint8 Zero[16];
+	FMemory::Memzero(Zero, 16);
+	uint8 H[16];
+	EncryptAesBlock(Key, Zero, H);
+	FTurboStructLiteGhashTable Table;
+	GcmInitTable(H, Table);
+
+	uint8 J0[16];
+	GcmBuildJ0(IV, IVLen, Table, J0);
+
+	uint8 Xi[16];
+	FMemory::Memzero(Xi, 16);
+	if (CiphertextLen > 0)
+	{
+		GcmUpdate(Xi, Ciphertext, CiphertextLen, Table);
+	}
+	GcmFinalize(Xi, 0, static_cast<uint64>(CiphertextLen) * 8, Table);
+
+	uint8 TagBlock[16];
+	uint8 Expected[16];
+	EncryptAesBlock(Key, J0, TagBlock);
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		Expected[Index] = static_cast<uint8>(TagBlock[Index] ^ Xi[Index]);
+	}
+
+	const bool bMatch = GcmConstantTimeEqual(Tag, Expected, 16);
+	if (!bMatch)
+	{
+		FMemory::Memzero(Zero, 16);
+		FMemory::Memzero(H, 16);
+		FMemory::Memzero(&Table, sizeof(Table));
+		FMemory::Memzero(J0, 16);
+		FMemory::Memzero(Xi, 16);
+		FMemory::Memzero(TagBlock, 16);
+		FMemory::Memzero(Expected, 16);
 		return false;
 	}
 
@@ -653,6 +937,7 @@ bool UTurboStructLiteBPLibrary::DecryptAesGcmFallback(const uint8* Key, const ui
 
 	FMemory::Memzero(Zero, 16);
 	FMemory::Memzero(H, 16);
+	FMemory::Memzero(&Table, sizeof(Table));
 	FMemory::Memzero(J0, 16);
 	FMemory::Memzero(Xi, 16);
 	FMemory::Memzero(TagBlock, 16);
@@ -671,7 +956,7 @@ bool UTurboStructLiteBPLibrary::ReadHeaderAndEntryCount(FArchive& Reader, int32
 	int32 Version = 0;
 	Reader << Version;
 	OutVersion = Version;
-	if (Version != GetVersion() && Version != 1 && Version != 2 && Version != 3)
+	if (Version != GetVersion() && Version != 1 && Version != 2 && Version != 3 && Version != 4)
 	{
 		return false;
 	}
@@ -902,62 +1187,32 @@ bool UTurboStructLiteBPLibrary::ReadTurboStructLiteFile(const FString& FilePath,
 		return false;
 	}
 	FMemoryReader Reader(FileBytes, true);
-	int32 Version = 1;
-	int32 EntryCount = 0;
-	if (!ReadHeaderAndEntryCount(Reader, GetMagic(), Version, EntryCount))
+	FTurboStructLiteSlotIndex Index;
+	if (!ReadSlotIndexFromArchive(Reader, Index))
 	{
 		return false;
 	}
-	for (int32 Index = 0; Index < EntryCount; ++Index)
+	for (int32 SubSlot : Index.OrderedSubSlots)
 	{
-		if (Reader.AtEnd())
+		const FTurboStructLiteCachedEntry* Cached = Index.Entries.Find(SubSlot);
+		if (!Cached)
 		{
 			return false;
 		}
-		int32 SubSlot = 0;
-		Reader << SubSlot;
-		uint8 CompressionByte = 0;
-		Reader << CompressionByte;
-		uint8 EncryptionByte = 0;
-		if (Version >= 3)
-		{
-			Reader << EncryptionByte;
-		}
-		int32 UncompressedSize = 0;
-		Reader << UncompressedSize;
-		int32 DataSize = 0;
-		Reader << DataSize;
-		int32 MetaSize = 0;
-		if (Version >= 2)
-		{
-			Reader << MetaSize;
-			if (MetaSize < 0)
-			{
-				return false;
-			}
-		}
-		if (DataSize < 0 || Reader.AtEnd())
+		Reader.Seek(Cached->DataOffset);
+		if (!IsValidBufferSize(Reader, Cached->DataSize))
 		{
 			return false;
 		}
-		TArray<uint8> Data;
-		Data.SetNum(DataSize);
-		if (DataSize > 0)
-		{
-			Reader.Serialize(Data.GetData(), DataSize);
-		}
-		if (Version >= 2 && MetaSize > 0)
+		FTurboStructLiteEntry Entry;
+		Entry.Compression = Cached->Compression;
+		Entry.Encryption = Cached->Encryption;
+		Entry.UncompressedSize = Cached->UncompressedSize;
+		Entry.Data.SetNum(Cached->DataSize);
+		if (Cached->DataSize > 0)
 		{
-			if (!SkipData(Reader, MetaSize))
-			{
-				return false;
-			}
+			Reader.Serialize(Entry.Data.GetData(), Cached->DataSize);
 		}
-		FTurboStructLiteEntry Entry;
-		Entry.Compression = static_cast<ETurboStructLiteCompression>(CompressionByte);
-		Entry.Encryption = static_cast<ETurboStructLiteEncryption>(EncryptionByte);
-		Entry.UncompressedSize = UncompressedSize;
-		Entry.Data = MoveTemp(Data);
 		OutEntries.Add(SubSlot, MoveTemp(Entry));
 	}
 	return true;
@@ -975,64 +1230,122 @@ bool UTurboStructLiteBPLibrary::WriteTurboStructLiteFile(const FString& FilePath
 	Writer << Timestamp;
 	int32 EntryCount = Entries.Num();
 	Writer << EntryCount;
+	const int64 FooterOffsetPos = Writer.Tell();
+	int64 FooterOffset = 0;
+	Writer << FooterOffset;
+	FTurboStructLiteSlotIndex Index;
+	Index.Version = Version;
 	for (const auto& Pair : Entries)
 	{
-		int32 SubSlot = Pair.Key;
-		Writer << SubSlot;
-		uint8 CompressionByte = static_cast<uint8>(Pair.Value.Compression);
-		Writer << CompressionByte;
-		uint8 EncryptionByte = static_cast<uint8>(Pair.Value.Encryption);
-		Writer << EncryptionByte;
-		int32 UncompressedSize = Pair.Value.UncompressedSize;
-		Writer << UncompressedSize;
-		int32 DataSize = Pair.Value.Data.Num();
-		Writer << DataSize;
-		int32 MetaSize = 0;
-		Writer << MetaSize;
-		if (DataSize > 0)
-		{
-			Writer.Serialize(const_cast<uint8*>(Pair.Value.Data.GetData()), DataSize);
-		}
+		WriteEntry(Writer, Pair.Key, Pair.Value);
+		FTurboStructLiteCachedEntry Cached;
+		Cached.Compression = Pair.Value.Compression;
+		Cached.Encryption = Pair.Value.Encryption;
+		Cached.UncompressedSize = Pair.Value.UncompressedSize;
+		Cached.DataSize = Pair.Value.Data.Num();
+		Cached.DataOffset = Writer.Tell() - Cached.DataSize;
+		Cached.MetaOffset = Writer.Tell();
+		Index.Entries.Add(Pair.Key, Cached);
+		Index.OrderedSubSlots.Add(Pair.Key);
+	}
+	Index.EntryCount = Index.OrderedSubSlots.Num();
+	if (Index.EntryCount > 0)
+	{
+		FooterOffset = Writer.Tell();
+		Index.FooterOffset = FooterOffset;
+		WriteSlotFooter(Writer, Index);
+		Writer.Seek(FooterOffsetPos);
+		Writer << FooterOffset;
 	}
 
-return FFileHelper::SaveArrayToFile(FileBytes, *FilePath);
-}
-
-void UTurboStructLiteBPLibrary::InvalidateSlotIndex(const FString& SlotName)
-{
-	FScopeLock Lock(&SlotIndexMutex);
-	const FString SanitizedName = SanitizeSlotName(SlotName);
-	CachedSlotIndexes.Remove(SanitizedName);
-}
-
-void UTurboStructLiteBPLibrary::InvalidateAllSlotIndexes()
-{
-	FScopeLock Lock(&SlotIndexMutex);
-	CachedSlotIndexes.Reset();
+	return FFileHelper::SaveArrayToFile(FileBytes, *FilePath);
 }
 
-bool UTurboStructLiteBPLibrary::BuildSlotIndex(const FString& SlotName, FTurboStructLiteSlotIndex& OutIndex)
+bool UTurboStructLiteBPLibrary::ReadSlotIndexFromArchive(FArchive& Reader, FTurboStructLiteSlotIndex& OutIndex)
 {
-	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_BuildSlotIndex"));
-	OutIndex = FTurboStructLiteSlotIndex();
-	const FString FilePath = BuildSavePath(SlotName);
-	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
-	if (!Reader)
-	{
-		return false;
-	}
 	int32 EntryCount = 0;
 	int32 Version = 1;
-	if (!ReadHeaderAndEntryCount(*Reader, GetMagic(), Version, EntryCount))
+	if (!ReadHeaderAndEntryCount(Reader, GetMagic(), Version, EntryCount))
 	{
 		return false;
 	}
-	OutIndex.FileSizeBytes = IFileManager::Get().FileSize(*FilePath);
-	OutIndex.Timestamp = IFileManager::Get().GetTimeStamp(*FilePath);
+	OutIndex.Version = Version;
 	OutIndex.EntryCount = EntryCount;
+	if (Version >= TurboStructLiteAppendOnlyVersion)
+	{
+		int64 FooterOffset = 0;
+		Reader << FooterOffset;
+		OutIndex.FooterOffset = FooterOffset;
+		if (EntryCount == 0)
+		{
+			return true;
+		}
+		if (FooterOffset < TurboStructLiteAppendHeaderSize || FooterOffset > Reader.TotalSize())
+		{
+			return false;
+		}
+		Reader.Seek(FooterOffset);
+		int32 FooterMagic = 0;
+		int32 FooterCount = 0;
+		Reader << FooterMagic;
+		Reader << FooterCount;
+		if (FooterMagic != TurboStructLiteFooterMagic || FooterCount != EntryCount)
+		{
+			return false;
+		}
+		if (Reader.Tell() + static_cast<int64>(FooterCount) * TurboStructLiteFooterEntrySize > Reader.TotalSize())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < FooterCount; ++Index)
+		{
+			int32 FoundSubSlot = 0;
+			uint8 CompressionByte = 0;
+			uint8 EncryptionByte = 0;
+			int32 UncompressedSize = 0;
+			int32 DataSize = 0;
+			int32 MetaSize = 0;
+			int64 DataOffset = 0;
+			Reader << FoundSubSlot;
+			Reader << CompressionByte;
+			Reader << EncryptionByte;
+			Reader << UncompressedSize;
+			Reader << DataSize;
+			Reader << MetaSize;
+			Reader << DataOffset;
+			if (DataSize < 0 || MetaSize < 0 || DataOffset < TurboStructLiteAppendHeaderSize + TurboStructLiteEntryRecordHeaderSize)
+			{
+				return false;
+			}
+			if (DataOffset + DataSize + MetaSize > FooterOffset)
+			{
+				return false;
+			}
+			FTurboStructLiteCachedEntry Entry;
+			Entry.Compression = static_cast<ETurboStructLiteCompression>(CompressionByte);
+			Entry.Encryption = static_cast<ETurboStructLiteEncryption>(EncryptionByte);
+			Entry.UncompressedSize = UncompressedSize;
+			Entry.DataSize = DataSize;
+			Entry.MetaSize = MetaSize;
+			Entry.DataOffset = DataOffset;
+			Entry.MetaOffset = DataOffset + DataSize;
+			if (!OutIndex.Entries.Contains(FoundSubSlot))
+			{
+				OutIndex.OrderedSubSlots.Add(FoundSubSlot);
+			}
+			OutIndex.Entries.Add(FoundSubSlot, Entry);
+		}
+		if (Reader.IsError())
+		{
+			return false;
+		}
+		ReadSchemaBlock(Reader, OutIndex);
+		ReadZoneMapBlock(Reader, OutIndex);
+		return true;
+	}
 	for (int32 Index = 0; Index < EntryCount; ++Index)
 	{
-		if (Reader->AtEnd())
+		if (Reader.AtEnd())
 		{
 			return false;
 		}
@@ -1041,23 +1354,23 @@ bool UTurboStructLiteBPLibrary::BuildSlotIndex(const FString& SlotName, FTurboSt
 		uint8 EncryptionByte = 0;
 		int32 UncompressedSize = 0;
 		int32 DataSize = 0;
-		*Reader << FoundSubSlot;
-		*Reader << CompressionByte;
+		Reader << FoundSubSlot;
+		Reader << CompressionByte;
 		if (Version >= 3)
 		{
-			*Reader << EncryptionByte;
+			Reader << EncryptionByte;
 		}
-		*Reader << UncompressedSize;
-		*Reader << DataSize;
-		if (!IsValidBufferSize(*Reader, DataSize))
+		Reader << UncompressedSize;
+		Reader << DataSize;
+		if (!IsValidBufferSize(Reader, DataSize))
 		{
 			return false;
 		}
 		int32 MetaSize = 0;
 		if (Version >= 2)
 		{
-			*Reader << MetaSize;
-			if (!IsValidBufferSize(*Reader, MetaSize))
+			Reader << MetaSize;
+			if (!IsValidBufferSize(Reader, MetaSize))
 			{
 				return false;
 			}
@@ -1068,15 +1381,15 @@ bool UTurboStructLiteBPLibrary::BuildSlotIndex(const FString& SlotName, FTurboSt
 		Entry.UncompressedSize = UncompressedSize;
 		Entry.DataSize = DataSize;
 		Entry.MetaSize = MetaSize;
-		Entry.DataOffset = Reader->Tell();
-		if (!SkipData(*Reader, DataSize))
+		Entry.DataOffset = Reader.Tell();
+		if (!SkipData(Reader, DataSize))
 		{
 			return false;
 		}
-		Entry.MetaOffset = Reader->Tell();
+		Entry.MetaOffset = Reader.Tell();
 		if (Version >= 2 && MetaSize > 0)
 		{
-			if (!SkipData(*Reader, MetaSize))
+			if (!SkipData(Reader, MetaSize))
 			{
 				return false;
 			}
@@ -1087,236 +1400,651 @@ bool UTurboStructLiteBPLibrary::BuildSlotIndex(const FString& SlotName, FTurboSt
 	return true;
 }
 
-bool UTurboStructLiteBPLibrary::GetSlotIndex(const FString& SlotName, FTurboStructLiteSlotIndex& OutIndex)
+void UTurboStructLiteBPLibrary::WriteSlotFooter(FArchive& Writer, const FTurboStructLiteSlotIndex& Index)
 {
-	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_GetSlotIndex"));
-	const FString SanitizedName = SanitizeSlotName(SlotName);
-	const FString FilePath = BuildSavePath(SlotName);
-	if (!FPaths::FileExists(FilePath))
+	int32 FooterMagic = TurboStructLiteFooterMagic;
+	Writer << FooterMagic;
+	int32 FooterCount = Index.OrderedSubSlots.Num();
+	Writer << FooterCount;
+	for (int32 SubSlot : Index.OrderedSubSlots)
 	{
-		return false;
+		const FTurboStructLiteCachedEntry& Cached = Index.Entries.FindChecked(SubSlot);
+		uint8 CompressionByte = static_cast<uint8>(Cached.Compression);
+		uint8 EncryptionByte = static_cast<uint8>(Cached.Encryption);
+		int32 UncompressedSize = Cached.UncompressedSize;
+		int32 DataSize = Cached.DataSize;
+		int32 MetaSize = Cached.MetaSize;
+		int64 DataOffset = Cached.DataOffset;
+		Writer << SubSlot;
+		Writer << CompressionByte;
+		Writer << EncryptionByte;
+		Writer << UncompressedSize;
+		Writer << DataSize;
+		Writer << MetaSize;
+		Writer << DataOffset;
 	}
-	const int64 CurrentSize = IFileManager::Get().FileSize(*FilePath);
-	const FDateTime CurrentTime = IFileManager::Get().GetTimeStamp(*FilePath);
+	WriteSchemaBlock(Writer, Index);
+	WriteZoneMapBlock(Writer, Index);
+}
+
+void UTurboStructLiteBPLibrary::WriteSchemaBlock(FArchive& Writer, const FTurboStructLiteSlotIndex& Index)
+{
+	TArray<TSharedPtr<const FTurboStructLiteSchema>> Schemas;
+	for (const uint64 SchemaHash : Index.SchemaHashes)
 	{
-		FScopeLock Lock(&SlotIndexMutex);
-		if (FTurboStructLiteSlotIndex* Found = CachedSlotIndexes.Find(SanitizedName))
+		if (TSharedPtr<const FTurboStructLiteSchema> Schema = FindSchema(SchemaHash))
 		{
-			if (Found->FileSizeBytes == CurrentSize && Found->Timestamp == CurrentTime)
-			{
-				OutIndex = *Found;
-				return true;
-			}
+			Schemas.Add(MoveTemp(Schema));
 		}
 	}
-	FTurboStructLiteSlotIndex BuiltIndex;
-	if (!BuildSlotIndex(SlotName, BuiltIndex))
+	if (Schemas.Num() == 0)
 	{
-		return false;
+		return;
 	}
+	TArray<uint8> BlockBytes;
+	FMemoryWriter BlockWriter(BlockBytes, true);
+	int32 SchemaCount = Schemas.Num();
+	BlockWriter << SchemaCount;
+	for (const TSharedPtr<const FTurboStructLiteSchema>& Schema : Schemas)
+	{
+		uint64 SchemaHash = Schema->Hash;
+		int32 SchemaSize = Schema->Bytes.Num();
+		BlockWriter << SchemaHash;
+		BlockWriter << SchemaSize;
+		BlockWriter.Serialize(const_cast<uint8*>(Schema->Bytes.GetData()), SchemaSize);
+	}
+	int32 SchemaMagic = TurboStructLiteSchemaBlockMagic;
+	int64 FooterOffset = Index.FooterOffset;
+	int32 BlockSize = BlockBytes.Num();
+	Writer << SchemaMagic;
+	Writer << FooterOffset;
+	Writer << BlockSize;
+	Writer.Serialize(BlockBytes.GetData(), BlockSize);
+}
+
+void UTurboStructLiteBPLibrary::ReadSchemaBlock(FArchive& Reader, FTurboStructLiteSlotIndex& OutIndex)
+{
+	const int64 BlockStart = Reader.Tell();
+	const int64 BlockHeaderSize = sizeof(int32) + sizeof(int64) + sizeof(int32);
+	if (Reader.TotalSize() - BlockStart < BlockHeaderSize)
 	{
-		FScopeLock Lock(&SlotIndexMutex);
-		CachedSlotIndexes.Add(SanitizedName, BuiltIndex);
+		return;
+	}
+	int32 SchemaMagic = 0;
+	int64 FooterOffset = 0;
+	int32 BlockSize = 0;
+	Reader << SchemaMagic;
+	Reader << FooterOffset;
+	Reader << BlockSize;
+	if (Reader.IsError() || SchemaMagic != TurboStructLiteSchemaBlockMagic || FooterOffset != OutIndex.FooterOffset || BlockSize <= 0 || BlockSize > Reader.TotalSize() - Reader.Tell())
+	{
+		// Slots without shared schemas go straight to the zone map block.
+		Reader.Seek(BlockStart);
+		return;
+	}
+	TArray<uint8> BlockBytes;
+	BlockBytes.SetNumUninitialized(BlockSize);
+	Reader.Serialize(BlockBytes.GetData(), BlockSize);
+	if (Reader.IsError())
+	{
+		return;
+	}
+
+	FMemoryReader BlockReader(BlockBytes, true);
+	int32 SchemaCount = 0;
+	BlockReader << SchemaCount;
+	for (int32 SchemaIndex = 0; SchemaIndex < SchemaCount && !BlockReader.IsError(); ++SchemaIndex)
+	{
+		uint64 SchemaHash = 0;
+		int32 SchemaSize = 0;
+		BlockReader << SchemaHash;
+		BlockReader << SchemaSize;
+		if (SchemaSize <= 0 || SchemaSize > BlockReader.TotalSize() - BlockReader.Tell())
+		{
+			return;
+		}
+		TArray<uint8> SchemaBytes;
+		SchemaBytes.SetNumUninitialized(SchemaSize);
+		BlockReader.Serialize(SchemaBytes.GetData(), SchemaSize);
+		// A schema whose bytes no longer hash to its id is damaged; entries using it fail to load on their own.
+		const TSharedPtr<const FTurboStructLiteSchema> Schema = RegisterSchema(SchemaBytes);
+		if (Schema.IsValid() && Schema->Hash == SchemaHash)
+		{
+			OutIndex.SchemaHashes.AddUnique(SchemaHash);
+		}
 	}
-	OutIndex = BuiltIndex;
-	return true;
 }
 
-bool UTurboStructLiteBPLibrary::GetCachedEntry(const FString& SlotName, int32 SubSlotIndex, FTurboStructLiteCachedEntry& OutEntry)
+void UTurboStructLiteBPLibrary::WriteZoneMapBlock(FArchive& Writer, const FTurboStructLiteSlotIndex& Index)
 {
-	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_Load_GetCachedEntry"));
-	FTurboStructLiteSlotIndex Index;
-	if (!GetSlotIndex(SlotName, Index))
+	TArray<uint8> BlockBytes;
+	FMemoryWriter BlockWriter(BlockBytes, true);
+	// The block is stored in plaintext, so encrypted entries never publish their field ranges.
+	const ETurboStructLiteEncryption DefaultEncryption = GetActiveEncryptionMode();
+	auto HasPlainZoneMap = [DefaultEncryption](const FTurboStructLiteCachedEntry& Cached)
+	{
+		const ETurboStructLiteEncryption Resolved = Cached.Encryption == ETurboStructLiteEncryption::ProjectDefault ? DefaultEncryption : Cached.Encryption;
+		return Cached.ZoneMap.IsValid() && Resolved != ETurboStructLiteEncryption::AES;
+	};
+	int32 ZoneCount = 0;
+	for (int32 SubSlot : Index.OrderedSubSlots)
 	{
-		return false;
+		ZoneCount += HasPlainZoneMap(Index.Entries.FindChecked(SubSlot)) ? 1 : 0;
 	}
-	if (const FTurboStructLiteCachedEntry* Found = Index.Entries.Find(SubSlotIndex))
+	if (ZoneCount == 0)
 	{
-		OutEntry = *Found;
-		return true;
+		return;
 	}
-	return false;
+	BlockWriter << ZoneCount;
+	for (int32 SubSlot : Index.OrderedSubSlots)
+	{
+		const FTurboStructLiteCachedEntry& Cached = Index.Entries.FindChecked(SubSlot);
+		if (!HasPlainZoneMap(Cached))
+		{
+			continue;
+		}
+		int32 SubSlotToWrite = SubSlot;
+		int32 RangeCount = Cached.ZoneMap->Num();
+		BlockWriter << SubSlotToWrite;
+		BlockWriter << RangeCount;
+		for (const FTurboStructLiteZoneRange& Range : *Cached.ZoneMap)
+		{
+			FString FieldName = Range.FieldName;
+			FString FieldType = Range.FieldType;
+			double Min = Range.Min;
+			double Max = Range.Max;
+			BlockWriter << FieldName;
+			BlockWriter << FieldType;
+			BlockWriter << Min;
+			BlockWriter << Max;
+		}
+	}
+	// The footer offset ties the block to its footer so a later record is never mistaken for it.
+	int32 ZoneMagic = TurboStructLiteZoneMapMagic;
+	int64 FooterOffset = Index.FooterOffset;
+	int32 BlockSize = BlockBytes.Num();
+	Writer << ZoneMagic;
+	Writer << FooterOffset;
+	Writer << BlockSize;
+	Writer.Serialize(BlockBytes.GetData(), BlockSize);
 }
 
-bool UTurboStructLiteBPLibrary::EncryptDataBuffer(ETurboStructLiteEncryption Method, const FString& Key, TArray<uint8>& InOutData)
+void UTurboStructLiteBPLibrary::ReadZoneMapBlock(FArchive& Reader, FTurboStructLiteSlotIndex& OutIndex)
 {
-	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_EncryptDataBuffer"));
-	if (Method == ETurboStructLiteEncryption::None)
+	const int64 BlockHeaderSize = sizeof(int32) + sizeof(int64) + sizeof(int32);
+	if (Reader.TotalSize() - Reader.Tell() < BlockHeaderSize)
 	{
-		return true;
+		return;
 	}
-	if (Method == ETurboStructLiteEncryption::ProjectDefault)
+	int32 ZoneMagic = 0;
+	int64 FooterOffset = 0;
+	int32 BlockSize = 0;
+	Reader << ZoneMagic;
+	Reader << FooterOffset;
+	Reader << BlockSize;
+	if (Reader.IsError() || ZoneMagic != TurboStructLiteZoneMapMagic || FooterOffset != OutIndex.FooterOffset || BlockSize <= 0 || BlockSize > Reader.TotalSize() - Reader.Tell())
 	{
-		Method = UTurboStructLiteBPLibrary::GetActiveEncryptionMode();
+		return;
 	}
-	if (Method != ETurboStructLiteEncryption::AES)
+	TArray<uint8> BlockBytes;
+	BlockBytes.SetNumUninitialized(BlockSize);
+	Reader.Serialize(BlockBytes.GetData(), BlockSize);
+	if (Reader.IsError())
 	{
-		return true;
+		return;
 	}
-	if (Key.IsEmpty())
+
+	FMemoryReader BlockReader(BlockBytes, true);
+	TMap<int32, TSharedPtr<const TArray<FTurboStructLiteZoneRange>>> ZoneMaps;
+	int32 ZoneCount = 0;
+	BlockReader << ZoneCount;
+	for (int32 ZoneIndex = 0; ZoneIndex < ZoneCount && !BlockReader.IsError(); ++ZoneIndex)
 	{
-		return false;
+		int32 SubSlot = 0;
+		int32 RangeCount = 0;
+		BlockReader << SubSlot;
+		BlockReader << RangeCount;
+		if (RangeCount < 0 || RangeCount > TurboStructLiteZoneMapMaxFields)
+		{
+			return;
+		}
+		TSharedPtr<TArray<FTurboStructLiteZoneRange>> Ranges = MakeShared<TArray<FTurboStructLiteZoneRange>>();
+		Ranges->SetNum(RangeCount);
+		for (FTurboStructLiteZoneRange& Range : *Ranges)
+		{
+			BlockReader << Range.FieldName;
+			BlockReader << Range.FieldType;
+			BlockReader << Range.Min;
+			BlockReader << Range.Max;
+		}
+		ZoneMaps.Add(SubSlot, Ranges);
 	}
-	const int32 SaltSize = 16;
-#if !TURBOSTRUCTLITE_USE_OPENSSL
-	TUniquePtr<FEncryptionContext> Context = IPlatformCrypto::Get().CreateContext();
-	if (!Context)
+	if (BlockReader.IsError())
 	{
-		return false;
+		return;
 	}
-#endif
-	TArray<uint8> Salt;
-	Salt.SetNum(SaltSize);
-#if TURBOSTRUCTLITE_USE_OPENSSL
-	if (RAND_bytes(Salt.GetData(), SaltSize) != 1)
+	for (TPair<int32, TSharedPtr<const TArray<FTurboStructLiteZoneRange>>>& Pair : ZoneMaps)
+	{
+		if (FTurboStructLiteCachedEntry* Cached = OutIndex.Entries.Find(Pair.Key))
+		{
+			Cached->ZoneMap = Pair.Value;
+		}
+	}
+}
+
+TSharedPtr<const TArray<FTurboStructLiteZoneRange>> UTurboStructLiteBPLibrary::BuildZoneMap(const TArray<uint8>& RawBytes)
+{
+	TArray<FTurboStructLiteFieldMeta> Fields;
+	const uint8* DataPtr = nullptr;
+	int32 DataLen = 0;
+	FString ErrorMessage;
+	FTurboStructLiteNameTable NameTable;
+	if (!ReadMetaFromBytes(RawBytes, Fields, DataPtr, DataLen, ErrorMessage, &NameTable) || Fields.Num() != 1 || Fields[0].Children.Num() == 0)
+	{
+		return nullptr;
+	}
+	FMemoryReader VersionSource(RawBytes, true);
+	// Enum fields are stored by name and may reference the entry's name table.
+	FScopedNameTableLite NameGuard(NameTable.Names.Num() > 0 ? &NameTable : nullptr);
+	TSharedPtr<TArray<FTurboStructLiteZoneRange>> Ranges = MakeShared<TArray<FTurboStructLiteZoneRange>>();
+	int32 Offset = 0;
+	for (const FTurboStructLiteFieldMeta& Meta : Fields[0].Children)
+	{
+		const int32 FieldOffset = Offset;
+		Offset += Meta.Size;
+		if (Ranges->Num() >= TurboStructLiteZoneMapMaxFields)
+		{
+			break;
+		}
+		if (Meta.Children.Num() > 0 || Meta.Size <= 0 || FieldOffset < 0 || static_cast<int64>(FieldOffset) + Meta.Size > DataLen)
+		{
+			continue;
+		}
+		const FString NormalType = NormalizeTypeName(Meta.Type);
+		if (NormalType == TEXT("fstring") || NormalType == TEXT("fname") || NormalType == TEXT("ftext"))
+		{
+			continue;
+		}
+		FTurboStructLiteVariant Variant;
+		bool bReaderError = false;
+		if (!TryReadVariantFromMeta(Meta, DataPtr + FieldOffset, Meta.Size, false, VersionSource, Variant, bReaderError))
+		{
+			continue;
+		}
+		if (Variant.Type != ETurboStructLiteVariantType::Int && Variant.Type != ETurboStructLiteVariantType::Float && Variant.Type != ETurboStructLiteVariantType::Bool)
+		{
+			continue;
+		}
+		const double Value = Variant.Type == ETurboStructLiteVariantType::Int ? static_cast<double>(Variant.IntValue) : Variant.FloatValue;
+		if (FMath::IsNaN(Value))
+		{
+			continue;
+		}
+		FTurboStructLiteZoneRange& Range = Ranges->AddDefaulted_GetRef();
+		Range.FieldName = Meta.Name;
+		Range.FieldType = NormalType;
+		Range.Min = Value;
+		Range.Max = Value;
+	}
+	if (Ranges->Num() == 0)
+	{
+		return nullptr;
+	}
+	return Ranges;
+}
+
+bool UTurboStructLiteBPLibrary::CommitSlotFooter(IFileHandle& Handle, FTurboStructLiteSlotIndex& Index)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_CommitSlotFooter"));
+	Index.EntryCount = Index.OrderedSubSlots.Num();
+	if (!Handle.SeekFromEnd(0))
 	{
 		return false;
 	}
-#else
-	if (Context->CreateRandomBytes(TArrayView<uint8>(Salt.GetData(), Salt.Num())) != EPlatformCryptoResult::Success)
+	Index.FooterOffset = Handle.Tell();
+	TArray<uint8> FooterBytes;
+	FMemoryWriter FooterWriter(FooterBytes, true);
+	WriteSlotFooter(FooterWriter, Index);
+	if (!Handle.Write(FooterBytes.GetData(), FooterBytes.Num()))
 	{
 		return false;
 	}
-#endif
-	uint8 Derived[64];
-	if (!DeriveAESKeyFromString(Key, Salt, Derived))
+	// The footer must be durable before the header points at it.
+	if (!Handle.Flush(true))
 	{
 		return false;
 	}
-	bool bSuccess = false;
-	const int32 IVSize = 12;
-	TArray<uint8> IV;
-	IV.SetNum(IVSize);
-	TArray<uint8> Payload;
 
-#if TURBOSTRUCTLITE_USE_OPENSSL
-	EVP_CIPHER_CTX* Ctx = nullptr;
-	TArray<uint8> Ciphertext;
-	int32 Len = 0;
-	int32 CiphertextLen = 0;
-	const int32 TagSize = 16;
-	TArray<uint8> Tag;
+	TArray<uint8> CommitBytes;
+	FMemoryWriter CommitWriter(CommitBytes, true);
+	int64 Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+	int32 EntryCount = Index.EntryCount;
+	int64 FooterOffset = Index.FooterOffset;
+	CommitWriter << Timestamp;
+	CommitWriter << EntryCount;
+	CommitWriter << FooterOffset;
+	if (!Handle.Seek(TurboStructLiteAppendHeaderCommitOffset) || !Handle.Write(CommitBytes.GetData(), CommitBytes.Num()))
+	{
+		return false;
+	}
+	return Handle.Flush(true);
+}
 
-	if (RAND_bytes(IV.GetData(), IVSize) != 1)
+int64 UTurboStructLiteBPLibrary::CalcLiveSlotBytes(const FTurboStructLiteSlotIndex& Index)
+{
+	int64 LiveBytes = TurboStructLiteAppendHeaderSize + 2 * sizeof(int32);
+	bool bHasZoneMaps = false;
+	for (const TPair<int32, FTurboStructLiteCachedEntry>& Pair : Index.Entries)
 	{
-		goto Cleanup;
+		LiveBytes += TurboStructLiteEntryRecordHeaderSize + Pair.Value.DataSize + Pair.Value.MetaSize + TurboStructLiteFooterEntrySize;
+		if (Pair.Value.ZoneMap.IsValid())
+		{
+			bHasZoneMaps = true;
+			LiveBytes += 2 * sizeof(int32);
+			for (const FTurboStructLiteZoneRange& Range : *Pair.Value.ZoneMap)
+			{
+				LiveBytes += 2 * sizeof(int32) + Range.FieldName.Len() + Range.FieldType.Len() + 2 + 2 * sizeof(double);
+			}
+		}
 	}
-	Ctx = EVP_CIPHER_CTX_new();
-	if (!Ctx)
+	if (bHasZoneMaps)
 	{
-		goto Cleanup;
+		LiveBytes += 3 * sizeof(int32) + sizeof(int64);
 	}
-	if (1 != EVP_EncryptInit_ex(Ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr))
+	if (Index.SchemaHashes.Num() > 0)
 	{
-		goto Cleanup;
+		LiveBytes += 3 * sizeof(int32) + sizeof(int64);
+		for (const uint64 SchemaHash : Index.SchemaHashes)
+		{
+			const TSharedPtr<const FTurboStructLiteSchema> Schema = FindSchema(SchemaHash);
+			LiveBytes += sizeof(uint64) + sizeof(int32) + (Schema.IsValid() ? Schema->Bytes.Num() : 0);
+		}
 	}
-	if (1 != EVP_EncryptInit_ex(Ctx, nullptr, nullptr, Derived, IV.GetData()))
+	return LiveBytes;
+}
+
+bool UTurboStructLiteBPLibrary::CompactSlotFile(const FString& SlotName, int32 ExcludeSubSlot, bool bUseWriteAheadLog, const FString& WALPath)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_CompactSlotFile"));
+	const FString FilePath = BuildSavePath(SlotName);
+	const FString TempPath = FilePath + TEXT(".tmp");
+	FTurboStructLiteSlotIndex Index;
+	if (!BuildSlotIndex(SlotName, Index))
 	{
-		goto Cleanup;
+		return false;
 	}
-	Ciphertext.SetNum(InOutData.Num() + 16);
-	if (1 != EVP_EncryptUpdate(Ctx, Ciphertext.GetData(), &Len, InOutData.GetData(), InOutData.Num()))
+	if (bUseWriteAheadLog)
 	{
-		goto Cleanup;
+		WriteWALEntry(WALPath, FString::Printf(TEXT("Compact start Entries=%d Size=%lld"), Index.EntryCount, Index.FileSizeBytes));
 	}
-	CiphertextLen = Len;
-	if (1 != EVP_EncryptFinal_ex(Ctx, Ciphertext.GetData() + Len, &Len))
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
 	{
-		goto Cleanup;
+		return false;
 	}
-	CiphertextLen += Len;
-	Ciphertext.SetNum(CiphertextLen);
-	Tag.SetNum(TagSize);
-	if (1 != EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_GET_TAG, TagSize, Tag.GetData()))
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
+	if (!Writer)
 	{
-		goto Cleanup;
+		return false;
 	}
 
-	Payload.Reserve(SaltSize + IVSize + TagSize + Ciphertext.Num());
-	Payload.Append(Salt);
-	Payload.Append(IV);
-	Payload.Append(Tag);
-	Payload.Append(Ciphertext);
-	InOutData = MoveTemp(Payload);
-	bSuccess = true;
+	auto FailAndCleanup = [&]() -> bool
+	{
+		Writer.Reset();
+		Reader.Reset();
+		IFileManager::Get().Delete(*TempPath);
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Compact failed"));
+		}
+		return false;
+	};
 
-Cleanup:
-	if (Ctx)
+	int32 Magic = GetMagic();
+	*Writer << Magic;
+	int32 Version = GetVersion();
+	*Writer << Version;
+	int64 Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+	*Writer << Timestamp;
+	const int64 EntryCountOffset = Writer->Tell();
+	int32 EntryCount = 0;
+	*Writer << EntryCount;
+	int64 FooterOffset = 0;
+	*Writer << FooterOffset;
+
+	const int32 BufferSize = CalcStreamingBufferSize(Index.FileSizeBytes);
+	TArray<uint8> Buffer;
+	Buffer.SetNum(BufferSize);
+	auto CopyRange = [&](int64 SourceOffset, int32 Size) -> bool
+	{
+		Reader->Seek(SourceOffset);
+		if (!IsValidBufferSize(*Reader, Size))
+		{
+			return false;
+		}
+		int32 Remaining = Size;
+		while (Remaining > 0)
+		{
+			const int32 ChunkSize = FMath::Min(Remaining, Buffer.Num());
+			Reader->Serialize(Buffer.GetData(), ChunkSize);
+			if (Reader->IsError())
+			{
+				return false;
+			}
+			Writer->Serialize(Buffer.GetData(), ChunkSize);
+			if (Writer->IsError())
+			{
+				return false;
+			}
+			Remaining -= ChunkSize;
+		}
+		return true;
+	};
+
+	FTurboStructLiteSlotIndex NewIndex;
+	NewIndex.Version = Version;
+	NewIndex.SchemaHashes = Index.SchemaHashes;
+	for (int32 SubSlot : Index.OrderedSubSlots)
 	{
-		EVP_CIPHER_CTX_free(Ctx);
+		if (SubSlot == ExcludeSubSlot)
+		{
+			continue;
+		}
+		const FTurboStructLiteCachedEntry* Cached = Index.Entries.Find(SubSlot);
+		if (!Cached)
+		{
+			return FailAndCleanup();
+		}
+		FTurboStructLiteCachedEntry NewEntry = *Cached;
+		if (Index.Version < 3)
+		{
+			NewEntry.Encryption = ETurboStructLiteEncryption::None;
+		}
+		int32 SubSlotToWrite = SubSlot;
+		uint8 CompressionByte = static_cast<uint8>(NewEntry.Compression);
+		uint8 EncryptionByte = static_cast<uint8>(NewEntry.Encryption);
+		int32 UncompressedSize = NewEntry.UncompressedSize;
+		int32 DataSize = NewEntry.DataSize;
+		int32 MetaSize = NewEntry.MetaSize;
+		*Writer << SubSlotToWrite;
+		*Writer << CompressionByte;
+		*Writer << EncryptionByte;
+		*Writer << UncompressedSize;
+		*Writer << DataSize;
+		*Writer << MetaSize;
+		NewEntry.DataOffset = Writer->Tell();
+		if (!CopyRange(Cached->DataOffset, Cached->DataSize))
+		{
+			return FailAndCleanup();
+		}
+		NewEntry.MetaOffset = Writer->Tell();
+		if (Cached->MetaSize > 0 && !CopyRange(Cached->MetaOffset, Cached->MetaSize))
+		{
+			return FailAndCleanup();
+		}
+		NewIndex.OrderedSubSlots.Add(SubSlot);
+		NewIndex.Entries.Add(SubSlot, NewEntry);
 	}
-	if (Salt.Num() > 0)
+	Reader.Reset();
+
+	if (NewIndex.OrderedSubSlots.Num() == 0)
 	{
-		FMemory::Memzero(Salt.GetData(), Salt.Num());
+		Writer.Reset();
+		IFileManager::Get().Delete(*TempPath);
+		const bool bDeleted = IFileManager::Get().Delete(*FilePath, false, true);
+		if (bDeleted)
+		{
+			InvalidateSlotIndex(SlotName);
+		}
+		return bDeleted;
 	}
-	if (IV.Num() > 0)
+
+	FooterOffset = Writer->Tell();
+	NewIndex.FooterOffset = FooterOffset;
+	WriteSlotFooter(*Writer, NewIndex);
+	EntryCount = NewIndex.OrderedSubSlots.Num();
+	Writer->Seek(EntryCountOffset);
+	*Writer << EntryCount;
+	*Writer << FooterOffset;
+	if (Writer->IsError())
 	{
-		FMemory::Memzero(IV.GetData(), IV.Num());
+		return FailAndCleanup();
 	}
-	if (Ciphertext.Num() > 0)
+	Writer->Flush();
+	Writer.Reset();
+
+	// The archive flush only reaches the OS; sync the temp file so a crash after the move cannot leave a torn slot.
+	TUniquePtr<IFileHandle> SyncHandle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*TempPath, true, true));
+	const bool bSynced = SyncHandle && SyncHandle->Flush(true);
+	SyncHandle.Reset();
+	if (!bSynced)
 	{
-		FMemory::Memzero(Ciphertext.GetData(), Ciphertext.Num());
+		IFileManager::Get().Delete(*TempPath);
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Compact sync failed"));
+		}
+		return false;
 	}
-	if (Tag.Num() > 0)
+
+	if (!IFileManager::Get().Move(*FilePath, *TempPath, true, true, false, true))
 	{
-		FMemory::Memzero(Tag.GetData(), Tag.Num());
+		IFileManager::Get().Delete(*TempPath);
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Compact move failed"));
+		}
+		return false;
 	}
-	if (Payload.Num() > 0 && !bSuccess)
+	InvalidateSlotIndex(SlotName);
+	if (bUseWriteAheadLog)
 	{
-		FMemory::Memzero(Payload.GetData(), Payload.Num());
+		WriteWALEntry(WALPath, FString::Printf(TEXT("Compact success Entries=%d"), EntryCount));
 	}
-	FMemory::Memzero(Derived, sizeof(Derived));
-	return bSuccess;
-#else
-	TArray<uint8> Tag;
-	TArray<uint8> Ciphertext;
+	return true;
+}
 
-	if (Context->CreateRandomBytes(TArrayView<uint8>(IV.GetData(), IV.Num())) != EPlatformCryptoResult::Success)
+void UTurboStructLiteBPLibrary::CompactSlotFileIfNeeded(const FString& SlotName, const FTurboStructLiteSlotIndex& Index, bool bUseWriteAheadLog, const FString& WALPath)
+{
+	const int64 FileSize = IFileManager::Get().FileSize(*BuildSavePath(SlotName));
+	if (FileSize < TurboStructLiteCompactionMinFileBytes)
 	{
-		goto Cleanup;
+		return;
 	}
-	if (!EncryptAesGcmFallback(Derived, IV.GetData(), IV.Num(), InOutData.GetData(), InOutData.Num(), Ciphertext, Tag))
+	const int64 DeadBytes = FileSize - CalcLiveSlotBytes(Index);
+	if (DeadBytes * 100 < FileSize * TurboStructLiteCompactionDeadPercent)
 	{
-		goto Cleanup;
+		return;
+	}
+	if (!CompactSlotFile(SlotName, INDEX_NONE, bUseWriteAheadLog, WALPath))
+	{
+		TURBOSTRUCTLITE_DEBUG_LOG_WARNING(FString::Printf(TEXT("Compaction of slot \"%s\" failed; dead space will be reclaimed on a later save"), *SlotName));
 	}
+}
 
-	Payload.Reserve(SaltSize + IVSize + Tag.Num() + Ciphertext.Num());
-	Payload.Append(Salt);
-	Payload.Append(IV);
-	Payload.Append(Tag);
-	Payload.Append(Ciphertext);
-	InOutData = MoveTemp(Payload);
-	bSuccess = true;
+void UTurboStructLiteBPLibrary::InvalidateSlotIndex(const FString& SlotName)
+{
+	FScopeLock Lock(&SlotIndexMutex);
+	const FString SanitizedName = SanitizeSlotName(SlotName);
+	CachedSlotIndexes.Remove(SanitizedName);
+}
 
-Cleanup:
-	if (Salt.Num() > 0)
+void UTurboStructLiteBPLibrary::InvalidateAllSlotIndexes()
+{
+	FScopeLock Lock(&SlotIndexMutex);
+	CachedSlotIndexes.Reset();
+}
+
+bool UTurboStructLiteBPLibrary::BuildSlotIndex(const FString& SlotName, FTurboStructLiteSlotIndex& OutIndex)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_BuildSlotIndex"));
+	OutIndex = FTurboStructLiteSlotIndex();
+	const FString FilePath = BuildSavePath(SlotName);
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
+	{
+		return false;
+	}
+	OutIndex.FileSizeBytes = IFileManager::Get().FileSize(*FilePath);
+	OutIndex.Timestamp = IFileManager::Get().GetTimeStamp(*FilePath);
+	return ReadSlotIndexFromArchive(*Reader, OutIndex);
+}
+
+bool UTurboStructLiteBPLibrary::GetSlotIndex(const FString& SlotName, FTurboStructLiteSlotIndex& OutIndex)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_GetSlotIndex"));
+	const FString SanitizedName = SanitizeSlotName(SlotName);
+	const FString FilePath = BuildSavePath(SlotName);
+	if (!FPaths::FileExists(FilePath))
+	{
+		return false;
+	}
+	const int64 CurrentSize = IFileManager::Get().FileSize(*FilePath);
+	const FDateTime CurrentTime = IFileManager::Get().GetTimeStamp(*FilePath);
 	{
-		FMemory::Memzero(Salt.GetData(), Salt.Num());
+		FScopeLock Lock(&SlotIndexMutex);
+		if (FTurboStructLiteSlotIndex* Found = CachedSlotIndexes.Find(SanitizedName))
+		{
+			if (Found->FileSizeBytes == CurrentSize && Found->Timestamp == CurrentTime)
+			{
+				OutIndex = *Found;
+				return true;
+			}
+		}
 	}
-	if (IV.Num() > 0)
+	FTurboStructLiteSlotIndex BuiltIndex;
+	if (!BuildSlotIndex(SlotName, BuiltIndex))
 	{
-		FMemory::Memzero(IV.GetData(), IV.Num());
+		return false;
 	}
-	if (Ciphertext.Num() > 0)
 	{
-		FMemory::Memzero(Ciphertext.GetData(), Ciphertext.Num());
+		FScopeLock Lock(&SlotIndexMutex);
+		CachedSlotIndexes.Add(SanitizedName, BuiltIndex);
 	}
-	if (Tag.Num() > 0)
+	OutIndex = BuiltIndex;
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::GetCachedEntry(const FString& SlotName, int32 SubSlotIndex, FTurboStructLiteCachedEntry& OutEntry)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_Load_GetCachedEntry"));
+	FTurboStructLiteSlotIndex Index;
+	if (!GetSlotIndex(SlotName, Index))
 	{
-		FMemory::Memzero(Tag.GetData(), Tag.Num());
+		return false;
 	}
-	if (Payload.Num() > 0 && !bSuccess)
+	if (const FTurboStructLiteCachedEntry* Found = Index.Entries.Find(SubSlotIndex))
 	{
-		FMemory::Memzero(Payload.GetData(), Payload.Num());
+		OutEntry = *Found;
+		return true;
 	}
-	FMemory::Memzero(Derived, sizeof(Derived));
-	return bSuccess;
-#endif
+	return false;
 }
 
-bool UTurboStructLiteBPLibrary::DecryptDataBuffer(ETurboStructLiteEncryption Method, const FString& Key, TArray<uint8>& InOutData)
+bool UTurboStructLiteBPLibrary::EncryptDataBuffer(ETurboStructLiteEncryption Method, const FString& Key, TArray<uint8>& InOutData)
 {
-	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_DecryptDataBuffer"));
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_EncryptDataBuffer"));
 	if (Method == ETurboStructLiteEncryption::None)
 	{
 		return true;
@@ -1333,404 +2061,1300 @@ bool UTurboStructLiteBPLibrary::DecryptDataBuffer(ETurboStructLiteEncryption Met
 	{
 		return false;
 	}
-	const int32 Overhead = 16 + 12 + 16;
-	if (InOutData.Num() <= Overhead)
+	uint8 MasterSalt[TurboStructLiteMasterSaltSize];
+	uint8 Salt[TurboStructLiteAesSaltSize];
+	uint8 IV[TurboStructLiteAesIVSize];
+	if (!GetSessionMasterSalt(MasterSalt) || !FillRandomBytes(Salt, TurboStructLiteAesSaltSize) || !FillRandomBytes(IV, TurboStructLiteAesIVSize))
 	{
 		return false;
 	}
-	const uint8* Ptr = InOutData.GetData();
-	const uint8* SaltPtr = Ptr;
-	Ptr += 16;
-	const uint8* IVPtr = Ptr;
-	Ptr += 12;
-	const uint8* TagPtr = Ptr;
-	Ptr += 16;
-	const uint8* DataPtr = Ptr;
-	const int32 DataLen = InOutData.Num() - Overhead;
-	TArray<uint8> SaltCopy;
-	SaltCopy.Append(SaltPtr, 16);
-	uint8 Derived[64];
-	if (!DeriveAESKeyFromString(Key, SaltCopy, Derived))
+	uint8 EntryKey[32];
+	if (!DeriveEntryAESKey(Key, MasterSalt, Salt, TurboStructLiteAesSaltSize, EntryKey))
 	{
 		return false;
 	}
-	bool bSuccess = false;
-#if TURBOSTRUCTLITE_USE_OPENSSL
-	EVP_CIPHER_CTX* Ctx = nullptr;
-	TArray<uint8> Plaintext;
-	int32 Len = 0;
-	int32 PlaintextLen = 0;
-	int32 Ret = 0;
-
-	Ctx = EVP_CIPHER_CTX_new();
-	if (!Ctx)
-	{
-		goto Cleanup;
-	}
-	if (1 != EVP_DecryptInit_ex(Ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr))
-	{
-		goto Cleanup;
-	}
-	if (1 != EVP_DecryptInit_ex(Ctx, nullptr, nullptr, Derived, IVPtr))
-	{
-		goto Cleanup;
-	}
-	Plaintext.SetNum(DataLen + 16);
-	if (1 != EVP_DecryptUpdate(Ctx, Plaintext.GetData(), &Len, DataPtr, DataLen))
+	TArray<uint8> Ciphertext;
+	uint8 Tag[TurboStructLiteAesTagSize];
+	const bool bEncrypted = EncryptAesGcm(EntryKey, IV, TurboStructLiteAesIVSize, InOutData.GetData(), InOutData.Num(), Ciphertext, Tag);
+	FMemory::Memzero(EntryKey, sizeof(EntryKey));
+	if (!bEncrypted)
 	{
-		goto Cleanup;
+		return false;
 	}
-	PlaintextLen = Len;
-	if (1 != EVP_CIPHER_CTX_ctrl(Ctx, EVP_CTRL_GCM_SET_TAG, 16, (void*)TagPtr))
+
+	// Layout: PayloadTag | MasterSalt | Salt | IV | Tag | Ciphertext.
+	TArray<uint8> Payload;
+	Payload.Reserve(4 + TurboStructLiteMasterSaltSize + TurboStructLiteAesSaltSize + TurboStructLiteAesIVSize + TurboStructLiteAesTagSize + Ciphertext.Num());
+	Payload.Add(static_cast<uint8>(TurboStructLiteSaltedPayloadTag & 0xFF));
+	Payload.Add(static_cast<uint8>((TurboStructLiteSaltedPayloadTag >> 8) & 0xFF));
+	Payload.Add(static_cast<uint8>((TurboStructLiteSaltedPayloadTag >> 16) & 0xFF));
+	Payload.Add(static_cast<uint8>((TurboStructLiteSaltedPayloadTag >> 24) & 0xFF));
+	Payload.Append(MasterSalt, TurboStructLiteMasterSaltSize);
+	Payload.Append(Salt, TurboStructLiteAesSaltSize);
+	Payload.Append(IV, TurboStructLiteAesIVSize);
+	Payload.Append(Tag, TurboStructLiteAesTagSize);
+	Payload.Append(Ciphertext);
+	InOutData = MoveTemp(Payload);
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::DecryptDataBuffer(ETurboStructLiteEncryption Method, const FString& Key, TArray<uint8>& InOutData)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_DecryptDataBuffer"));
+	if (Method == ETurboStructLiteEncryption::None)
 	{
-		goto Cleanup;
+		return true;
 	}
-	Ret = EVP_DecryptFinal_ex(Ctx, Plaintext.GetData() + Len, &Len);
-	if (Ret <= 0)
+	if (Method == ETurboStructLiteEncryption::ProjectDefault)
 	{
-		goto Cleanup;
+		Method = UTurboStructLiteBPLibrary::GetActiveEncryptionMode();
 	}
-	PlaintextLen += Len;
-	Plaintext.SetNum(PlaintextLen);
-	InOutData = MoveTemp(Plaintext);
-	bSuccess = true;
-
-Cleanup:
-	if (Ctx)
+	if (Method != ETurboStructLiteEncryption::AES)
 	{
-		EVP_CIPHER_CTX_free(Ctx);
+		return true;
 	}
-	if (Plaintext.Num() > 0 && !bSuccess)
+	if (Key.IsEmpty())
 	{
-		FMemory::Memzero(Plaintext.GetData(), Plaintext.Num());
+		return false;
 	}
-	if (SaltCopy.Num() > 0)
+	if (IsChunkedAesPayload(InOutData))
 	{
-		FMemory::Memzero(SaltCopy.GetData(), SaltCopy.Num());
+		TArray<uint8> Container;
+		if (!DecryptChunkedBuffer(Key, InOutData, ETurboStructLiteCompression::None, false, Container))
+		{
+			return false;
+		}
+		InOutData = MoveTemp(Container);
+		return true;
 	}
-	FMemory::Memzero(Derived, sizeof(Derived));
-	return bSuccess;
-#else
+	const int32 Overhead = TurboStructLiteAesSaltSize + TurboStructLiteAesIVSize + TurboStructLiteAesTagSize;
+	if (InOutData.Num() <= Overhead)
+	{
+		return false;
+	}
+	const uint8* Ptr = InOutData.GetData();
+	uint8 EntryKey[32];
 	TArray<uint8> Plaintext;
-	if (!DecryptAesGcmFallback(Derived, IVPtr, 12, DataPtr, DataLen, TagPtr, 16, Plaintext))
+
+	const uint32 PayloadTag = ReadPayloadTag(Ptr);
+	const bool bSalted = PayloadTag == TurboStructLiteSaltedPayloadTag;
+	const int32 TaggedPrefix = 4 + (bSalted ? TurboStructLiteMasterSaltSize : 0);
+	if ((bSalted || PayloadTag == TurboStructLiteKeyedPayloadTag) && InOutData.Num() > Overhead + TaggedPrefix)
 	{
-		goto Cleanup;
+		const uint8* MasterSaltPtr = bSalted ? Ptr + 4 : nullptr;
+		const uint8* SaltPtr = Ptr + TaggedPrefix;
+		const uint8* IVPtr = SaltPtr + TurboStructLiteAesSaltSize;
+		const uint8* TagPtr = IVPtr + TurboStructLiteAesIVSize;
+		const uint8* DataPtr = TagPtr + TurboStructLiteAesTagSize;
+		const int32 DataLen = InOutData.Num() - Overhead - TaggedPrefix;
+		if (!DeriveEntryAESKey(Key, MasterSaltPtr, SaltPtr, TurboStructLiteAesSaltSize, EntryKey))
+		{
+			return false;
+		}
+		const bool bDecrypted = DecryptAesGcm(EntryKey, IVPtr, TurboStructLiteAesIVSize, DataPtr, DataLen, TagPtr, Plaintext);
+		FMemory::Memzero(EntryKey, sizeof(EntryKey));
+		if (!bDecrypted)
+		{
+			// A tagged payload that fails authentication is rejected; retrying it as legacy would only add a PBKDF2 pass.
+			return false;
+		}
+		InOutData = MoveTemp(Plaintext);
+		return true;
+	}
+
+	// Legacy layout: Salt | IV | Tag | Ciphertext, keyed by PBKDF2 over the entry salt.
+	// Every legacy entry has its own salt, so the derived key cache cannot help here; legacy
+	// entries pay a full PBKDF2 pass each and bypass the cache so they do not evict master keys.
+	const uint8* SaltPtr = Ptr;
+	const uint8* IVPtr = SaltPtr + TurboStructLiteAesSaltSize;
+	const uint8* TagPtr = IVPtr + TurboStructLiteAesIVSize;
+	const uint8* DataPtr = TagPtr + TurboStructLiteAesTagSize;
+	const int32 DataLen = InOutData.Num() - Overhead;
+	TArray<uint8> SaltCopy;
+	SaltCopy.Append(SaltPtr, TurboStructLiteAesSaltSize);
+	uint8 Derived[64];
+	if (!DeriveAESKeyFromString(Key, SaltCopy, Derived))
+	{
+		return false;
+	}
+	FMemory::Memcpy(EntryKey, Derived, 32);
+	FMemory::Memzero(Derived, sizeof(Derived));
+	const bool bDecrypted = DecryptAesGcm(EntryKey, IVPtr, TurboStructLiteAesIVSize, DataPtr, DataLen, TagPtr, Plaintext);
+	FMemory::Memzero(EntryKey, sizeof(EntryKey));
+	if (!bDecrypted)
+	{
+		return false;
 	}
 	InOutData = MoveTemp(Plaintext);
-	bSuccess = true;
+	return true;
+}
 
-Cleanup:
-	if (Plaintext.Num() > 0 && !bSuccess)
+bool UTurboStructLiteBPLibrary::IsChunkedAesPayload(const TArray<uint8>& Data)
+{
+	if (Data.Num() < TurboStructLiteChunkedPayloadPrefixSize)
 	{
-		FMemory::Memzero(Plaintext.GetData(), Plaintext.Num());
+		return false;
 	}
-	if (SaltCopy.Num() > 0)
+	const int32 PrefixSize = GetChunkedAesPrefixSize(ReadPayloadTag(Data.GetData()));
+	return PrefixSize > 0 && Data.Num() >= PrefixSize;
+}
+
+uint32 UTurboStructLiteBPLibrary::ReadPayloadTag(const uint8* Data)
+{
+	return static_cast<uint32>(Data[0]) | (static_cast<uint32>(Data[1]) << 8) | (static_cast<uint32>(Data[2]) << 16) | (static_cast<uint32>(Data[3]) << 24);
+}
+
+int32 UTurboStructLiteBPLibrary::GetChunkedAesPrefixSize(uint32 PayloadTag)
+{
+	if (PayloadTag == TurboStructLiteSaltedChunkedPayloadTag)
 	{
-		FMemory::Memzero(SaltCopy.GetData(), SaltCopy.Num());
+		return TurboStructLiteSaltedChunkedPayloadPrefixSize;
 	}
-	FMemory::Memzero(Derived, sizeof(Derived));
-	return bSuccess;
-#endif
+	return PayloadTag == TurboStructLiteChunkedPayloadTag ? TurboStructLiteChunkedPayloadPrefixSize : 0;
 }
 
-bool UTurboStructLiteBPLibrary::SaveEntry(const FString& SlotName, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, bool bUseWriteAheadLog, const FString& WALPath)
+void UTurboStructLiteBPLibrary::BuildChunkNonce(const uint8* BaseIV, uint32 Counter, uint8 OutIV[12])
 {
-	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveEntry"));
-	if (bUseWriteAheadLog)
+	FMemory::Memcpy(OutIV, BaseIV, 12);
+	OutIV[8] ^= static_cast<uint8>((Counter >> 24) & 0xFF);
+	OutIV[9] ^= static_cast<uint8>((Counter >> 16) & 0xFF);
+	OutIV[10] ^= static_cast<uint8>((Counter >> 8) & 0xFF);
+	OutIV[11] ^= static_cast<uint8>(Counter & 0xFF);
+}
+
+bool UTurboStructLiteBPLibrary::CompressAndEncryptBuffer(ETurboStructLiteCompression Compression, const FString& Key, const TArray<uint8>& In, TArray<uint8>& Out, int32 MaxParallelThreads, int32 ChunkBatchSizeMB)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_CompressAndEncryptBuffer"));
+	Out.Reset();
+	if (In.Num() == 0 || Key.IsEmpty())
 	{
-		WriteWALEntry(WALPath, FString::Printf(TEXT("Start SaveEntry Slot=%s SubSlot=%d Bytes=%d Compression=%d Encryption=%d"), *SlotName, SubSlotIndex, RawBytes.Num(), static_cast<int32>(Compression), static_cast<int32>(Encryption)));
+		return false;
 	}
-	TArray<uint8> CompressedBytes;
-	const int32 ResolvedBatchMB = UTurboStructLiteBPLibrary::ResolveBatchingMB(CompressionBatching);
-	if (bUseWriteAheadLog)
+	const bool bRaw = Compression == ETurboStructLiteCompression::None;
+	const FName Name = bRaw ? NAME_None : GetCompressionName(Compression);
+	if (!bRaw && Name.IsNone())
 	{
-		WriteWALEntry(WALPath, TEXT("Compress start"));
+		return false;
 	}
-	if (!CompressBuffer(Compression, RawBytes, CompressedBytes, MaxParallelThreads, ResolvedBatchMB))
+
+	const int32 ChunkSizeMB = ChunkBatchSizeMB > 0 ? ChunkBatchSizeMB : 4;
+	const int32 ChunkSize = FMath::Max(1, ChunkSizeMB) * 1024 * 1024;
+	const int32 TotalSize = In.Num();
+	const int32 NumChunks = FMath::Max(1, FMath::DivideAndRoundUp(TotalSize, ChunkSize));
+	const int32 MaxThreads = FMath::Clamp(MaxParallelThreads > 0 ? MaxParallelThreads : GetParallelThreadLimit(), 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	const int32 TaskCount = FMath::Min(MaxThreads, NumChunks);
+	const int32 ChunksPerTask = FMath::DivideAndRoundUp(NumChunks, TaskCount);
+
+	uint8 MasterSalt[TurboStructLiteMasterSaltSize];
+	uint8 Salt[TurboStructLiteAesSaltSize];
+	uint8 BaseIV[TurboStructLiteAesIVSize];
+	if (!GetSessionMasterSalt(MasterSalt) || !FillRandomBytes(Salt, TurboStructLiteAesSaltSize) || !FillRandomBytes(BaseIV, TurboStructLiteAesIVSize))
 	{
-		if (bUseWriteAheadLog)
-		{
-			WriteWALEntry(WALPath, TEXT("Compress failed"));
-		}
 		return false;
 	}
-	if (bUseWriteAheadLog)
+	uint8 EntryKey[32];
+	if (!DeriveEntryAESKey(Key, MasterSalt, Salt, TurboStructLiteAesSaltSize, EntryKey))
 	{
-		WriteWALEntry(WALPath, FString::Printf(TEXT("Compress success Size=%d"), CompressedBytes.Num()));
+		return false;
 	}
 
-	TArray<uint8> Payload = MoveTemp(CompressedBytes);
-	if (Encryption != ETurboStructLiteEncryption::None)
+	// Each chunk is compressed and sealed on the same worker; the nonce binds the chunk index
+	// and marks the last chunk so chunks cannot be reordered or truncated.
+	TArray<TArray<uint8>> SealedChunks;
+	SealedChunks.SetNum(NumChunks);
+	TArray<uint8> ChunkTags;
+	ChunkTags.SetNumUninitialized(NumChunks * TurboStructLiteAesTagSize);
+	FThreadSafeBool bFailed(false);
+
+	ParallelFor(TaskCount, [&](int32 TaskIndex)
 	{
-		if (bUseWriteAheadLog)
+		const int32 StartChunk = TaskIndex * ChunksPerTask;
+		const int32 EndChunk = FMath::Min(StartChunk + ChunksPerTask, NumChunks);
+		TArray<uint8> LocalCompressed;
+		for (int32 ChunkIndex = StartChunk; ChunkIndex < EndChunk && !bFailed; ++ChunkIndex)
 		{
-			WriteWALEntry(WALPath, TEXT("Encrypt start"));
-		}
-		if (!EncryptDataBuffer(Encryption, EncryptionKey, Payload))
-		{
-			if (bUseWriteAheadLog)
+			const int32 Offset = ChunkIndex * ChunkSize;
+			const int32 ThisSize = FMath::Min(ChunkSize, TotalSize - Offset);
+			const uint8* PlainData = In.GetData() + Offset;
+			int32 PlainSize = ThisSize;
+			if (!bRaw)
 			{
-				WriteWALEntry(WALPath, TEXT("Encrypt failed"));
+				const int32 BoundSize = FCompression::CompressMemoryBound(Name, ThisSize);
+				LocalCompressed.SetNumUninitialized(BoundSize);
+				int32 LocalSize = BoundSize;
+				if (!FCompression::CompressMemory(Name, LocalCompressed.GetData(), LocalSize, PlainData, ThisSize))
+				{
+					bFailed = true;
+					return;
+				}
+				PlainData = LocalCompressed.GetData();
+				PlainSize = LocalSize;
+			}
+			const uint32 Counter = static_cast<uint32>(ChunkIndex + 1) | (ChunkIndex == NumChunks - 1 ? TurboStructLiteChunkedLastCounterBit : 0u);
+			uint8 Nonce[TurboStructLiteAesIVSize];
+			BuildChunkNonce(BaseIV, Counter, Nonce);
+			if (!EncryptAesGcm(EntryKey, Nonce, TurboStructLiteAesIVSize, PlainData, PlainSize, SealedChunks[ChunkIndex], ChunkTags.GetData() + ChunkIndex * TurboStructLiteAesTagSize))
+			{
+				bFailed = true;
+				return;
 			}
-			return false;
 		}
-		if (bUseWriteAheadLog)
+		if (LocalCompressed.Num() > 0)
 		{
-			WriteWALEntry(WALPath, FString::Printf(TEXT("Encrypt success Size=%d"), Payload.Num()));
+			FMemory::Memzero(LocalCompressed.GetData(), LocalCompressed.Num());
 		}
+	}, EParallelForFlags::Unbalanced);
+
+	if (bFailed)
+	{
+		FMemory::Memzero(EntryKey, sizeof(EntryKey));
+		return false;
 	}
 
-	FTurboStructLiteEntry NewEntry;
-	NewEntry.Compression = Compression;
-	NewEntry.Encryption = Encryption;
-	NewEntry.UncompressedSize = RawBytes.Num();
-	NewEntry.Data = MoveTemp(Payload);
+	// The container header (same layout as CompressBuffer) is sealed with its own counter.
+	TArray<uint8> Header;
+	Header.Reserve((3 + NumChunks) * sizeof(int32));
+	const int32 UncompressedSize = TotalSize;
+	Header.Append(reinterpret_cast<const uint8*>(&UncompressedSize), sizeof(int32));
+	const int32 StoredChunkSize = ChunkSize;
+	Header.Append(reinterpret_cast<const uint8*>(&StoredChunkSize), sizeof(int32));
+	const int32 StoredNumChunks = NumChunks;
+	Header.Append(reinterpret_cast<const uint8*>(&StoredNumChunks), sizeof(int32));
+	int64 TotalSealed = 0;
+	for (const TArray<uint8>& Chunk : SealedChunks)
+	{
+		const int32 Size = Chunk.Num();
+		Header.Append(reinterpret_cast<const uint8*>(&Size), sizeof(int32));
+		TotalSealed += Size;
+	}
+	const uint8 Flags = bRaw ? TurboStructLiteChunkedFlagRaw : 0;
+	uint8 HeaderNonce[TurboStructLiteAesIVSize];
+	BuildChunkNonce(BaseIV, TurboStructLiteChunkedHeaderCounter | Flags, HeaderNonce);
+	TArray<uint8> SealedHeader;
+	uint8 HeaderTag[TurboStructLiteAesTagSize];
+	const bool bHeaderSealed = EncryptAesGcm(EntryKey, HeaderNonce, TurboStructLiteAesIVSize, Header.GetData(), Header.Num(), SealedHeader, HeaderTag);
+	FMemory::Memzero(EntryKey, sizeof(EntryKey));
+	if (!bHeaderSealed)
+	{
+		return false;
+	}
 
-	const FString FilePath = BuildSavePath(SlotName);
-	const FString TempPath = FilePath + TEXT(".tmp");
+	// Layout: PayloadTag | MasterSalt | Salt | BaseIV | Flags | ChunkCount | HeaderTag | SealedHeader | ChunkTags | SealedChunks.
+	Out.Reserve(TurboStructLiteSaltedChunkedPayloadPrefixSize + SealedHeader.Num() + ChunkTags.Num() + TotalSealed);
+	Out.Add(static_cast<uint8>(TurboStructLiteSaltedChunkedPayloadTag & 0xFF));
+	Out.Add(static_cast<uint8>((TurboStructLiteSaltedChunkedPayloadTag >> 8) & 0xFF));
+	Out.Add(static_cast<uint8>((TurboStructLiteSaltedChunkedPayloadTag >> 16) & 0xFF));
+	Out.Add(static_cast<uint8>((TurboStructLiteSaltedChunkedPayloadTag >> 24) & 0xFF));
+	Out.Append(MasterSalt, TurboStructLiteMasterSaltSize);
+	Out.Append(Salt, TurboStructLiteAesSaltSize);
+	Out.Append(BaseIV, TurboStructLiteAesIVSize);
+	Out.Add(Flags);
+	Out.Append(reinterpret_cast<const uint8*>(&StoredNumChunks), sizeof(int32));
+	Out.Append(HeaderTag, TurboStructLiteAesTagSize);
+	Out.Append(SealedHeader);
+	Out.Append(ChunkTags);
+	for (const TArray<uint8>& Chunk : SealedChunks)
+	{
+		Out.Append(Chunk);
+	}
+	return true;
+}
 
-	TUniquePtr<FArchive> Reader;
-	if (FPaths::FileExists(FilePath))
+bool UTurboStructLiteBPLibrary::WriteEntryPayloadStreamed(IFileHandle& Handle, ETurboStructLiteCompression Compression, bool bEncrypt, const FString& Key, const TArray<uint8>& RawBytes, int32 MaxParallelThreads, int32 ChunkBatchSizeMB, int32& OutDataSize)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_WriteEntryPayloadStreamed"));
+	OutDataSize = 0;
+	if (RawBytes.Num() == 0 || (bEncrypt && Key.IsEmpty()))
+	{
+		return false;
+	}
+	const bool bRaw = Compression == ETurboStructLiteCompression::None;
+	if (bRaw && !bEncrypt)
+	{
+		OutDataSize = RawBytes.Num();
+		return Handle.Write(RawBytes.GetData(), RawBytes.Num());
+	}
+	const FName Name = bRaw ? NAME_None : GetCompressionName(Compression);
+	if (!bRaw && Name.IsNone())
+	{
+		return false;
+	}
+
+	const int32 ChunkSizeMB = ChunkBatchSizeMB > 0 ? ChunkBatchSizeMB : 4;
+	const int32 ChunkSize = FMath::Max(1, ChunkSizeMB) * 1024 * 1024;
+	const int32 TotalSize = RawBytes.Num();
+	const int32 NumChunks = FMath::Max(1, FMath::DivideAndRoundUp(TotalSize, ChunkSize));
+	const int32 MaxThreads = FMath::Clamp(MaxParallelThreads > 0 ? MaxParallelThreads : GetParallelThreadLimit(), 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	const int32 BatchSize = FMath::Min(MaxThreads, NumChunks);
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumChunks, BatchSize);
+	const int32 HeaderSize = (3 + NumChunks) * sizeof(int32);
+
+	uint8 MasterSalt[TurboStructLiteMasterSaltSize] = {};
+	uint8 Salt[TurboStructLiteAesSaltSize] = {};
+	uint8 BaseIV[TurboStructLiteAesIVSize] = {};
+	uint8 EntryKey[32] = {};
+	if (bEncrypt)
 	{
-		Reader.Reset(IFileManager::Get().CreateFileReader(*FilePath));
-		if (!Reader)
+		if (!GetSessionMasterSalt(MasterSalt) || !FillRandomBytes(Salt, TurboStructLiteAesSaltSize) || !FillRandomBytes(BaseIV, TurboStructLiteAesIVSize)
+			|| !DeriveEntryAESKey(Key, MasterSalt, Salt, TurboStructLiteAesSaltSize, EntryKey))
 		{
-			if (bUseWriteAheadLog)
-			{
-				WriteWALEntry(WALPath, TEXT("Open reader failed"));
-			}
 			return false;
 		}
 	}
 
-	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
-	if (!Writer)
+	// The chunk table precedes the chunk bodies, so reserve it now and patch it once every chunk is sized.
+	const int64 PayloadStart = Handle.Tell();
+	const int64 ReservedSize = bEncrypt
+		? TurboStructLiteSaltedChunkedPayloadPrefixSize + HeaderSize + static_cast<int64>(NumChunks) * TurboStructLiteAesTagSize
+		: HeaderSize;
+	TArray<uint8> Reserved;
+	Reserved.SetNumZeroed(ReservedSize);
+	if (!Handle.Write(Reserved.GetData(), ReservedSize))
 	{
-		if (bUseWriteAheadLog)
+		FMemory::Memzero(EntryKey, sizeof(EntryKey));
+		return false;
+	}
+
+	TArray<int32> ChunkSizes;
+	ChunkSizes.SetNumZeroed(NumChunks);
+	TArray<uint8> ChunkTags;
+	ChunkTags.SetNumZeroed(bEncrypt ? NumChunks * TurboStructLiteAesTagSize : 0);
+	TArray<TArray<uint8>> BatchBuffers[2];
+	BatchBuffers[0].SetNum(BatchSize);
+	BatchBuffers[1].SetNum(BatchSize);
+	int64 BodyBytes = 0;
+	auto WriteBatch = [&](int32 BatchIndex) -> bool
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_Save_WriteBatch"));
+		const int32 First = BatchIndex * BatchSize;
+		const int32 Count = FMath::Min(BatchSize, NumChunks - First);
+		for (int32 Local = 0; Local < Count; ++Local)
 		{
-			WriteWALEntry(WALPath, TEXT("Open writer failed"));
+			const TArray<uint8>& Chunk = BatchBuffers[BatchIndex & 1][Local];
+			if (!Handle.Write(Chunk.GetData(), Chunk.Num()))
+			{
+				return false;
+			}
+			BodyBytes += Chunk.Num();
+		}
+		return true;
+	};
+
+	// Workers compress (and seal) batch N while the calling thread writes batch N-1.
+	FThreadSafeBool bFailed(false);
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches && !bFailed; ++BatchIndex)
+	{
+		const int32 First = BatchIndex * BatchSize;
+		const int32 Count = FMath::Min(BatchSize, NumChunks - First);
+		TArray<TArray<uint8>>& Buffers = BatchBuffers[BatchIndex & 1];
+		bool bPrevWritten = true;
+		ParallelForWithPreWork(Count, [&](int32 Local)
+		{
+			const int32 ChunkIndex = First + Local;
+			const int32 Offset = ChunkIndex * ChunkSize;
+			const int32 ThisSize = FMath::Min(ChunkSize, TotalSize - Offset);
+			TArray<uint8>& Dest = Buffers[Local];
+			TArray<uint8> LocalCompressed;
+			const uint8* PlainData = RawBytes.GetData() + Offset;
+			int32 PlainSize = ThisSize;
+			if (!bRaw)
+			{
+				TArray<uint8>& CompressTarget = bEncrypt ? LocalCompressed : Dest;
+				const int32 BoundSize = FCompression::CompressMemoryBound(Name, ThisSize);
+				CompressTarget.SetNumUninitialized(BoundSize, false);
+				int32 LocalSize = BoundSize;
+				if (!FCompression::CompressMemory(Name, CompressTarget.GetData(), LocalSize, PlainData, ThisSize))
+				{
+					bFailed = true;
+					return;
+				}
+				CompressTarget.SetNum(LocalSize, false);
+				PlainData = CompressTarget.GetData();
+				PlainSize = LocalSize;
+			}
+			if (bEncrypt)
+			{
+				const uint32 Counter = static_cast<uint32>(ChunkIndex + 1) | (ChunkIndex == NumChunks - 1 ? TurboStructLiteChunkedLastCounterBit : 0u);
+				uint8 Nonce[TurboStructLiteAesIVSize];
+				BuildChunkNonce(BaseIV, Counter, Nonce);
+				if (!EncryptAesGcm(EntryKey, Nonce, TurboStructLiteAesIVSize, PlainData, PlainSize, Dest, ChunkTags.GetData() + ChunkIndex * TurboStructLiteAesTagSize))
+				{
+					bFailed = true;
+				}
+				if (LocalCompressed.Num() > 0)
+				{
+					FMemory::Memzero(LocalCompressed.GetData(), LocalCompressed.Num());
+				}
+			}
+			ChunkSizes[ChunkIndex] = Dest.Num();
+		},
+		[&]()
+		{
+			if (BatchIndex > 0)
+			{
+				bPrevWritten = WriteBatch(BatchIndex - 1);
+			}
+		}, EParallelForFlags::Unbalanced);
+		if (!bPrevWritten)
+		{
+			bFailed = true;
 		}
-		return false;
 	}
-	if (bUseWriteAheadLog)
+	if (!bFailed && !WriteBatch(NumBatches - 1))
 	{
-		WriteWALEntry(WALPath, FString::Printf(TEXT("Write temp start %s"), *TempPath));
+		bFailed = true;
 	}
-
-	auto FailAndCleanup = [&]() -> bool
+	if (bFailed)
 	{
-		Writer.Reset();
-		Reader.Reset();
-		IFileManager::Get().Delete(*TempPath);
-		if (bUseWriteAheadLog)
+		FMemory::Memzero(EntryKey, sizeof(EntryKey));
+		return false;
+	}
+
+	// Container header, same layout CompressBuffer produces.
+	TArray<uint8> Header;
+	Header.Reserve(HeaderSize);
+	const int32 UncompressedSize = TotalSize;
+	Header.Append(reinterpret_cast<const uint8*>(&UncompressedSize), sizeof(int32));
+	const int32 StoredChunkSize = ChunkSize;
+	Header.Append(reinterpret_cast<const uint8*>(&StoredChunkSize), sizeof(int32));
+	const int32 StoredNumChunks = NumChunks;
+	Header.Append(reinterpret_cast<const uint8*>(&StoredNumChunks), sizeof(int32));
+	Header.Append(reinterpret_cast<const uint8*>(ChunkSizes.GetData()), NumChunks * sizeof(int32));
+
+	TArray<uint8> Prefix;
+	if (bEncrypt)
+	{
+		const uint8 Flags = bRaw ? TurboStructLiteChunkedFlagRaw : 0;
+		uint8 HeaderNonce[TurboStructLiteAesIVSize];
+		BuildChunkNonce(BaseIV, TurboStructLiteChunkedHeaderCounter | Flags, HeaderNonce);
+		TArray<uint8> SealedHeader;
+		uint8 HeaderTag[TurboStructLiteAesTagSize];
+		const bool bHeaderSealed = EncryptAesGcm(EntryKey, HeaderNonce, TurboStructLiteAesIVSize, Header.GetData(), Header.Num(), SealedHeader, HeaderTag);
+		FMemory::Memzero(EntryKey, sizeof(EntryKey));
+		if (!bHeaderSealed)
 		{
-			WriteWALEntry(WALPath, TEXT("Abort and cleanup"));
+			return false;
 		}
+		Prefix.Reserve(ReservedSize);
+		Prefix.Add(static_cast<uint8>(TurboStructLiteSaltedChunkedPayloadTag & 0xFF));
+		Prefix.Add(static_cast<uint8>((TurboStructLiteSaltedChunkedPayloadTag >> 8) & 0xFF));
+		Prefix.Add(static_cast<uint8>((TurboStructLiteSaltedChunkedPayloadTag >> 16) & 0xFF));
+		Prefix.Add(static_cast<uint8>((TurboStructLiteSaltedChunkedPayloadTag >> 24) & 0xFF));
+		Prefix.Append(MasterSalt, TurboStructLiteMasterSaltSize);
+		Prefix.Append(Salt, TurboStructLiteAesSaltSize);
+		Prefix.Append(BaseIV, TurboStructLiteAesIVSize);
+		Prefix.Add(Flags);
+		Prefix.Append(reinterpret_cast<const uint8*>(&StoredNumChunks), sizeof(int32));
+		Prefix.Append(HeaderTag, TurboStructLiteAesTagSize);
+		Prefix.Append(SealedHeader);
+		Prefix.Append(ChunkTags);
+	}
+	else
+	{
+		Prefix = MoveTemp(Header);
+	}
+	if (Prefix.Num() != ReservedSize || !Handle.Seek(PayloadStart) || !Handle.Write(Prefix.GetData(), Prefix.Num()) || !Handle.SeekFromEnd(0))
+	{
 		return false;
-	};
+	}
+	const int64 TotalBytes = ReservedSize + BodyBytes;
+	if (TotalBytes > MAX_int32)
+	{
+		return false;
+	}
+	OutDataSize = static_cast<int32>(TotalBytes);
+	return true;
+}
 
-	int32 Magic = GetMagic();
-	*Writer << Magic;
-	int32 Version = GetVersion();
-	*Writer << Version;
-	int64 Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
-	*Writer << Timestamp;
+int64 UTurboStructLiteBPLibrary::CalcChunkedAesLayoutSize(const uint8* Prefix)
+{
+	const int32 PrefixSize = GetChunkedAesPrefixSize(ReadPayloadTag(Prefix));
+	if (PrefixSize <= 0)
+	{
+		return -1;
+	}
+	// The chunk count sits right before the header tag at the end of the prefix.
+	int32 NumChunks = 0;
+	FMemory::Memcpy(&NumChunks, Prefix + PrefixSize - TurboStructLiteAesTagSize - sizeof(int32), sizeof(int32));
+	if (NumChunks <= 0 || NumChunks >= 1'000'000)
+	{
+		return -1;
+	}
+	return PrefixSize + static_cast<int64>(3 + NumChunks) * sizeof(int32);
+}
 
-	const int64 EntryCountOffset = Writer->Tell();
-	int32 EntryCount = 0;
-	*Writer << EntryCount;
+bool UTurboStructLiteBPLibrary::ReadChunkedAesLayout(const FString& Key, const uint8* Data, int64 DataLen, FTurboStructLiteChunkedLayout& OutLayout)
+{
+	if (Key.IsEmpty() || DataLen < TurboStructLiteChunkedPayloadPrefixSize)
+	{
+		return false;
+	}
+	const uint32 PayloadTag = ReadPayloadTag(Data);
+	OutLayout.PrefixSize = GetChunkedAesPrefixSize(PayloadTag);
+	if (OutLayout.PrefixSize <= 0 || DataLen < OutLayout.PrefixSize)
+	{
+		return false;
+	}
+	const int64 LayoutSize = CalcChunkedAesLayoutSize(Data);
+	if (LayoutSize < 0 || LayoutSize > DataLen)
+	{
+		return false;
+	}
+	const uint8* Ptr = Data + 4;
+	const uint8* MasterSaltPtr = nullptr;
+	if (PayloadTag == TurboStructLiteSaltedChunkedPayloadTag)
+	{
+		MasterSaltPtr = Ptr;
+		Ptr += TurboStructLiteMasterSaltSize;
+	}
+	const uint8* SaltPtr = Ptr;
+	Ptr += TurboStructLiteAesSaltSize;
+	FMemory::Memcpy(OutLayout.BaseIV, Ptr, TurboStructLiteAesIVSize);
+	Ptr += TurboStructLiteAesIVSize;
+	OutLayout.Flags = *Ptr;
+	Ptr += 1;
+	int32 NumChunks = 0;
+	FMemory::Memcpy(&NumChunks, Ptr, sizeof(int32));
+	Ptr += sizeof(int32);
+	const uint8* HeaderTag = Ptr;
+	Ptr += TurboStructLiteAesTagSize;
+	const int32 HeaderSize = static_cast<int32>(LayoutSize - OutLayout.PrefixSize);
+
+	if (!DeriveEntryAESKey(Key, MasterSaltPtr, SaltPtr, TurboStructLiteAesSaltSize, OutLayout.Key))
+	{
+		return false;
+	}
+	uint8 HeaderNonce[TurboStructLiteAesIVSize];
+	BuildChunkNonce(OutLayout.BaseIV, TurboStructLiteChunkedHeaderCounter | OutLayout.Flags, HeaderNonce);
+	if (!DecryptAesGcm(OutLayout.Key, HeaderNonce, TurboStructLiteAesIVSize, Ptr, HeaderSize, HeaderTag, OutLayout.Header))
+	{
+		FMemory::Memzero(OutLayout.Key, sizeof(OutLayout.Key));
+		return false;
+	}
+	int32 StoredNumChunks = 0;
+	FMemory::Memcpy(&OutLayout.UncompressedSize, OutLayout.Header.GetData(), sizeof(int32));
+	FMemory::Memcpy(&OutLayout.ChunkSize, OutLayout.Header.GetData() + sizeof(int32), sizeof(int32));
+	FMemory::Memcpy(&StoredNumChunks, OutLayout.Header.GetData() + sizeof(int32) * 2, sizeof(int32));
+	OutLayout.ChunkSizes.SetNumUninitialized(NumChunks);
+	FMemory::Memcpy(OutLayout.ChunkSizes.GetData(), OutLayout.Header.GetData() + sizeof(int32) * 3, NumChunks * sizeof(int32));
+	bool bValid = OutLayout.UncompressedSize > 0 && OutLayout.ChunkSize > 0 && StoredNumChunks == NumChunks
+		&& FMath::DivideAndRoundUp(OutLayout.UncompressedSize, OutLayout.ChunkSize) == NumChunks;
+	for (int32 Size : OutLayout.ChunkSizes)
+	{
+		bValid &= Size > 0;
+	}
+	if (!bValid)
+	{
+		FMemory::Memzero(OutLayout.Key, sizeof(OutLayout.Key));
+	}
+	return bValid;
+}
 
-	if (Reader)
+bool UTurboStructLiteBPLibrary::DecryptChunkedBuffer(const FString& Key, const TArray<uint8>& In, ETurboStructLiteCompression Compression, bool bDecompress, TArray<uint8>& Out)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_DecryptChunkedBuffer"));
+	Out.Reset();
+	if (!IsChunkedAesPayload(In))
 	{
-		if (bUseWriteAheadLog)
+		return false;
+	}
+	FTurboStructLiteChunkedLayout Layout;
+	if (!ReadChunkedAesLayout(Key, In.GetData(), In.Num(), Layout))
+	{
+		return false;
+	}
+	const int32 NumChunks = Layout.ChunkSizes.Num();
+	const int32 HeaderSize = Layout.Header.Num();
+	const int64 TagsOffset = Layout.PrefixSize + HeaderSize;
+	const int64 DataOffset = TagsOffset + static_cast<int64>(NumChunks) * TurboStructLiteAesTagSize;
+	TArray<int64> ChunkOffsets;
+	ChunkOffsets.SetNumUninitialized(NumChunks);
+	int64 Running = DataOffset;
+	for (int32 Index = 0; Index < NumChunks; ++Index)
+	{
+		ChunkOffsets[Index] = Running;
+		Running += Layout.ChunkSizes[Index];
+	}
+	const bool bRaw = (Layout.Flags & TurboStructLiteChunkedFlagRaw) != 0;
+	const FName Name = bRaw ? NAME_None : GetCompressionName(Compression);
+	if (Running != In.Num() || (bDecompress && !bRaw && Name.IsNone()))
+	{
+		FMemory::Memzero(Layout.Key, sizeof(Layout.Key));
+		return false;
+	}
+
+	// Without decompression the caller gets the same bytes EncryptDataBuffer would have sealed.
+	const bool bProduceRaw = bDecompress || bRaw;
+	int64 ContainerOffset = 0;
+	if (bProduceRaw)
+	{
+		Out.SetNumUninitialized(Layout.UncompressedSize);
+	}
+	else
+	{
+		Out.SetNumUninitialized(HeaderSize + (Running - DataOffset));
+		FMemory::Memcpy(Out.GetData(), Layout.Header.GetData(), HeaderSize);
+		ContainerOffset = HeaderSize - DataOffset;
+	}
+
+	const int32 MaxThreads = FMath::Clamp(GetParallelThreadLimit(), 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	const int32 TaskCount = FMath::Min(MaxThreads, NumChunks);
+	const int32 ChunksPerTask = FMath::DivideAndRoundUp(NumChunks, TaskCount);
+	const uint8* ChunkTags = In.GetData() + TagsOffset;
+	FThreadSafeBool bFailed(false);
+
+	ParallelFor(TaskCount, [&](int32 TaskIndex)
+	{
+		const int32 StartChunk = TaskIndex * ChunksPerTask;
+		const int32 EndChunk = FMath::Min(StartChunk + ChunksPerTask, NumChunks);
+		TArray<uint8> LocalPlain;
+		for (int32 ChunkIndex = StartChunk; ChunkIndex < EndChunk && !bFailed; ++ChunkIndex)
 		{
-			WriteWALEntry(WALPath, TEXT("Copy existing entries"));
+			const uint32 Counter = static_cast<uint32>(ChunkIndex + 1) | (ChunkIndex == NumChunks - 1 ? TurboStructLiteChunkedLastCounterBit : 0u);
+			uint8 Nonce[TurboStructLiteAesIVSize];
+			BuildChunkNonce(Layout.BaseIV, Counter, Nonce);
+			if (!DecryptAesGcm(Layout.Key, Nonce, TurboStructLiteAesIVSize, In.GetData() + ChunkOffsets[ChunkIndex], Layout.ChunkSizes[ChunkIndex], ChunkTags + ChunkIndex * TurboStructLiteAesTagSize, LocalPlain))
+			{
+				bFailed = true;
+				return;
+			}
+			const int32 DestOffset = ChunkIndex * Layout.ChunkSize;
+			const int32 DestSize = (ChunkIndex == NumChunks - 1) ? (Layout.UncompressedSize - DestOffset) : Layout.ChunkSize;
+			if (bRaw)
+			{
+				if (LocalPlain.Num() != DestSize)
+				{
+					bFailed = true;
+					return;
+				}
+				FMemory::Memcpy(Out.GetData() + DestOffset, LocalPlain.GetData(), DestSize);
+			}
+			else if (bDecompress)
+			{
+				if (!FCompression::UncompressMemory(Name, Out.GetData() + DestOffset, DestSize, LocalPlain.GetData(), LocalPlain.Num()))
+				{
+					bFailed = true;
+					return;
+				}
+			}
+			else
+			{
+				FMemory::Memcpy(Out.GetData() + ChunkOffsets[ChunkIndex] + ContainerOffset, LocalPlain.GetData(), LocalPlain.Num());
+			}
 		}
-		int32 ExistingEntryCount = 0;
-		int32 ExistingVersion = 1;
-		if (!ReadHeaderAndEntryCount(*Reader, GetMagic(), ExistingVersion, ExistingEntryCount))
+		if (LocalPlain.Num() > 0)
 		{
-			return FailAndCleanup();
+			FMemory::Memzero(LocalPlain.GetData(), LocalPlain.Num());
 		}
+	}, EParallelForFlags::Unbalanced);
 
-		const int64 FileSize = Reader->TotalSize();
-		const int32 BufferSize = CalcStreamingBufferSize(FileSize);
-		TArray<uint8> Buffer;
-		Buffer.SetNum(BufferSize);
+	FMemory::Memzero(Layout.Key, sizeof(Layout.Key));
+	if (bFailed)
+	{
+		if (Out.Num() > 0)
+		{
+			FMemory::Memzero(Out.GetData(), Out.Num());
+		}
+		Out.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::LoadEntryStreamed(FArchive& Reader, const FTurboStructLiteCachedEntry& Cached, bool bEncrypted, const FString& Key, TArray<uint8>& OutRawBytes, bool& bOutStreamed)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadEntryStreamed"));
+	bOutStreamed = false;
+	OutRawBytes.Reset();
+	const int64 EndOffset = Cached.DataOffset + Cached.DataSize;
+	Reader.Seek(Cached.DataOffset);
+	if (Cached.DataSize <= 0 || !IsValidBufferSize(Reader, Cached.DataSize))
+	{
+		return false;
+	}
 
-		for (int32 Index = 0; Index < ExistingEntryCount; ++Index)
+	if (!bEncrypted && Cached.Compression == ETurboStructLiteCompression::None)
+	{
+		bOutStreamed = true;
+		OutRawBytes.SetNumUninitialized(Cached.DataSize);
+		Reader.Serialize(OutRawBytes.GetData(), Cached.DataSize);
+		return !Reader.IsError();
+	}
+
+	// Resolve the chunk table without touching the chunk bodies.
+	int32 UncompressedSize = 0;
+	int32 ChunkSize = 0;
+	TArray<int32> ChunkSizes;
+	TArray<uint8> ChunkTags;
+	FTurboStructLiteChunkedLayout Layout;
+	bool bRaw = Cached.Compression == ETurboStructLiteCompression::None;
+	if (bEncrypted)
+	{
+		TArray<uint8> LayoutBytes;
+		LayoutBytes.SetNumUninitialized(TurboStructLiteChunkedPayloadPrefixSize);
+		if (Cached.DataSize < TurboStructLiteChunkedPayloadPrefixSize)
 		{
-			if (Reader->AtEnd())
-			{
-				return FailAndCleanup();
-			}
-			int32 FoundSubSlot = 0;
-			uint8 CompressionByte = 0;
-			uint8 EncryptionByte = 0;
-			int32 UncompressedSize = 0;
-			int32 DataSize = 0;
-			int32 MetaSize = 0;
-			*Reader << FoundSubSlot;
-			*Reader << CompressionByte;
-			if (ExistingVersion >= 3)
+			return false;
+		}
+		Reader.Serialize(LayoutBytes.GetData(), TurboStructLiteChunkedPayloadPrefixSize);
+		const int32 PrefixSize = Reader.IsError() ? 0 : GetChunkedAesPrefixSize(ReadPayloadTag(LayoutBytes.GetData()));
+		if (PrefixSize <= 0)
+		{
+			// Single-stream payloads must be decrypted as a whole.
+			return false;
+		}
+		bOutStreamed = true;
+		if (PrefixSize > Cached.DataSize)
+		{
+			return false;
+		}
+		// Salted prefixes are longer than the legacy prefix read above.
+		LayoutBytes.SetNumUninitialized(PrefixSize);
+		Reader.Serialize(LayoutBytes.GetData() + TurboStructLiteChunkedPayloadPrefixSize, PrefixSize - TurboStructLiteChunkedPayloadPrefixSize);
+		const int64 LayoutSize = Reader.IsError() ? -1 : CalcChunkedAesLayoutSize(LayoutBytes.GetData());
+		if (LayoutSize < 0 || LayoutSize > Cached.DataSize)
+		{
+			return false;
+		}
+		LayoutBytes.SetNumUninitialized(LayoutSize);
+		Reader.Serialize(LayoutBytes.GetData() + PrefixSize, LayoutSize - PrefixSize);
+		if (Reader.IsError() || !ReadChunkedAesLayout(Key, LayoutBytes.GetData(), LayoutBytes.Num(), Layout))
+		{
+			return false;
+		}
+		UncompressedSize = Layout.UncompressedSize;
+		ChunkSize = Layout.ChunkSize;
+		ChunkSizes = Layout.ChunkSizes;
+		bRaw = (Layout.Flags & TurboStructLiteChunkedFlagRaw) != 0;
+		ChunkTags.SetNumUninitialized(ChunkSizes.Num() * TurboStructLiteAesTagSize);
+		if (!IsValidBufferSize(Reader, ChunkTags.Num()))
+		{
+			FMemory::Memzero(Layout.Key, sizeof(Layout.Key));
+			return false;
+		}
+		Reader.Serialize(ChunkTags.GetData(), ChunkTags.Num());
+	}
+	else
+	{
+		if (Cached.DataSize < static_cast<int32>(sizeof(int32) * 3))
+		{
+			return false;
+		}
+		int32 NumChunks = 0;
+		Reader << UncompressedSize;
+		Reader << ChunkSize;
+		Reader << NumChunks;
+		const int64 TableBytes = static_cast<int64>(NumChunks) * sizeof(int32);
+		if (UncompressedSize <= 0 || ChunkSize <= 0 || NumChunks <= 0 || NumChunks >= 1'000'000 || sizeof(int32) * 3 + TableBytes > Cached.DataSize)
+		{
+			// Not a chunk container (legacy single-block compression); use the buffered path.
+			return false;
+		}
+		if (NumChunks != FMath::DivideAndRoundUp(UncompressedSize, ChunkSize))
+		{
+			return false;
+		}
+		ChunkSizes.SetNumUninitialized(NumChunks);
+		Reader.Serialize(ChunkSizes.GetData(), TableBytes);
+		int64 PayloadSize = 0;
+		for (int32 Size : ChunkSizes)
+		{
+			if (Size <= 0)
 			{
-				*Reader << EncryptionByte;
+				return false;
 			}
-			*Reader << UncompressedSize;
-			*Reader << DataSize;
+			PayloadSize += Size;
+		}
+		if (sizeof(int32) * 3 + TableBytes + PayloadSize > Cached.DataSize)
+		{
+			return false;
+		}
+		bOutStreamed = true;
+	}
+
+	const int32 NumChunks = ChunkSizes.Num();
+	int64 BodyBytes = 0;
+	for (int32 Size : ChunkSizes)
+	{
+		BodyBytes += Size;
+	}
+	const FName Name = bRaw ? NAME_None : GetCompressionName(Cached.Compression);
+	// The chunk table must describe exactly the indexed entry before any worker writes into the output.
+	const bool bTableMatches = UncompressedSize == Cached.UncompressedSize && NumChunks == FMath::DivideAndRoundUp(UncompressedSize, ChunkSize);
+	if (Reader.IsError() || !bTableMatches || Reader.Tell() + BodyBytes > EndOffset || (!bRaw && Name.IsNone()))
+	{
+		FMemory::Memzero(Layout.Key, sizeof(Layout.Key));
+		return false;
+	}
+
+	// Double-buffered batches: the calling thread reads batch N+1 while workers
+	// decrypt/decompress batch N straight into the output buffer.
+	OutRawBytes.SetNumUninitialized(UncompressedSize);
+	const int32 BatchSize = FMath::Min(NumChunks, FMath::Clamp(GetParallelThreadLimit(), 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads()));
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumChunks, BatchSize);
+	TArray<TArray<uint8>> BatchBuffers[2];
+	BatchBuffers[0].SetNum(BatchSize);
+	BatchBuffers[1].SetNum(BatchSize);
+	auto ReadBatch = [&](int32 BatchIndex) -> bool
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_Load_ReadBatch"));
+		TArray<TArray<uint8>>& Buffers = BatchBuffers[BatchIndex & 1];
+		const int32 First = BatchIndex * BatchSize;
+		const int32 Count = FMath::Min(BatchSize, NumChunks - First);
+		for (int32 Local = 0; Local < Count; ++Local)
+		{
+			const int32 Size = ChunkSizes[First + Local];
+			Buffers[Local].SetNumUninitialized(Size, false);
+			Reader.Serialize(Buffers[Local].GetData(), Size);
+		}
+		return !Reader.IsError();
+	};
 
-			if (DataSize < 0)
+	FThreadSafeBool bFailed(!ReadBatch(0));
+	for (int32 BatchIndex = 0; BatchIndex < NumBatches && !bFailed; ++BatchIndex)
+	{
+		const int32 First = BatchIndex * BatchSize;
+		const int32 Count = FMath::Min(BatchSize, NumChunks - First);
+		TArray<TArray<uint8>>& Buffers = BatchBuffers[BatchIndex & 1];
+		bool bNextRead = true;
+		ParallelForWithPreWork(Count, [&](int32 Local)
+		{
+			const int32 ChunkIndex = First + Local;
+			const int64 DestOffset = static_cast<int64>(ChunkIndex) * ChunkSize;
+			const int64 DestSize = (ChunkIndex == NumChunks - 1) ? (UncompressedSize - DestOffset) : ChunkSize;
+			if (DestSize <= 0 || DestOffset + DestSize > OutRawBytes.Num())
 			{
-				return FailAndCleanup();
+				bFailed = true;
+				return;
 			}
-
-			if (ExistingVersion >= 2)
+			const TArray<uint8>& Source = Buffers[Local];
+			TArray<uint8> LocalPlain;
+			const uint8* PlainData = Source.GetData();
+			int32 PlainSize = Source.Num();
+			if (bEncrypted)
 			{
-				*Reader << MetaSize;
-				if (MetaSize < 0)
+				const uint32 Counter = static_cast<uint32>(ChunkIndex + 1) | (ChunkIndex == NumChunks - 1 ? TurboStructLiteChunkedLastCounterBit : 0u);
+				uint8 Nonce[TurboStructLiteAesIVSize];
+				BuildChunkNonce(Layout.BaseIV, Counter, Nonce);
+				if (!DecryptAesGcm(Layout.Key, Nonce, TurboStructLiteAesIVSize, Source.GetData(), Source.Num(), ChunkTags.GetData() + ChunkIndex * TurboStructLiteAesTagSize, LocalPlain))
 				{
-					return FailAndCleanup();
+					bFailed = true;
+					return;
 				}
+				PlainData = LocalPlain.GetData();
+				PlainSize = LocalPlain.Num();
 			}
-
-			if (FoundSubSlot == SubSlotIndex)
+			if (bRaw)
 			{
-				if (!SkipData(*Reader, DataSize))
+				if (PlainSize != DestSize)
 				{
-					return FailAndCleanup();
+					bFailed = true;
 				}
-				if (ExistingVersion >= 2 && MetaSize > 0)
+				else
 				{
-					if (!SkipData(*Reader, MetaSize))
-					{
-						return FailAndCleanup();
-					}
+					FMemory::Memcpy(OutRawBytes.GetData() + DestOffset, PlainData, DestSize);
 				}
-				continue;
 			}
+			else if (!FCompression::UncompressMemory(Name, OutRawBytes.GetData() + DestOffset, static_cast<int32>(DestSize), PlainData, PlainSize))
+			{
+				bFailed = true;
+			}
+			if (LocalPlain.Num() > 0)
+			{
+				FMemory::Memzero(LocalPlain.GetData(), LocalPlain.Num());
+			}
+		},
+		[&]()
+		{
+			if (BatchIndex + 1 < NumBatches)
+			{
+				bNextRead = ReadBatch(BatchIndex + 1);
+			}
+		}, EParallelForFlags::Unbalanced);
+		if (!bNextRead)
+		{
+			bFailed = true;
+		}
+	}
+
+	FMemory::Memzero(Layout.Key, sizeof(Layout.Key));
+	if (bFailed)
+	{
+		if (OutRawBytes.Num() > 0)
+		{
+			FMemory::Memzero(OutRawBytes.GetData(), OutRawBytes.Num());
+		}
+		OutRawBytes.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::IsSavePayloadValid(ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes)
+{
+	const ETurboStructLiteEncryption ResolvedEncryption = Encryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : Encryption;
+	return RawBytes.Num() > 0 && !(ResolvedEncryption == ETurboStructLiteEncryption::AES && EncryptionKey.IsEmpty());
+}
+
+bool UTurboStructLiteBPLibrary::OpenSlotForAppend(const FString& SlotName, FTurboStructLiteSlotIndex& OutIndex, TUniquePtr<IFileHandle>& OutHandle, bool bUseWriteAheadLog, const FString& WALPath)
+{
+	const FString FilePath = BuildSavePath(SlotName);
+	OutIndex = FTurboStructLiteSlotIndex();
+	if (FPaths::FileExists(FilePath))
+	{
+		if (!GetSlotIndex(SlotName, OutIndex))
+		{
+			if (bUseWriteAheadLog)
+			{
+				WriteWALEntry(WALPath, TEXT("Read slot index failed"));
+			}
+			return false;
+		}
+		if (OutIndex.Version < TurboStructLiteAppendOnlyVersion)
+		{
+			// Older layouts are upgraded once; every later save is a plain append.
+			if (bUseWriteAheadLog)
+			{
+				WriteWALEntry(WALPath, FString::Printf(TEXT("Upgrade slot file from version %d"), OutIndex.Version));
+			}
+			if (!CompactSlotFile(SlotName, INDEX_NONE, bUseWriteAheadLog, WALPath) || !GetSlotIndex(SlotName, OutIndex))
+			{
+				return false;
+			}
+		}
+	}
+	else
+	{
+		TArray<uint8> HeaderBytes;
+		FMemoryWriter HeaderWriter(HeaderBytes, true);
+		int32 Magic = GetMagic();
+		HeaderWriter << Magic;
+		int32 Version = GetVersion();
+		HeaderWriter << Version;
+		int64 Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+		HeaderWriter << Timestamp;
+		int32 EntryCount = 0;
+		HeaderWriter << EntryCount;
+		int64 FooterOffset = 0;
+		HeaderWriter << FooterOffset;
+		if (!FFileHelper::SaveArrayToFile(HeaderBytes, *FilePath))
+		{
+			if (bUseWriteAheadLog)
+			{
+				WriteWALEntry(WALPath, TEXT("Create slot file failed"));
+			}
+			return false;
+		}
+		OutIndex.Version = Version;
+	}
 
-			*Writer << FoundSubSlot;
-			*Writer << CompressionByte;
-			uint8 EncryptionToWrite = (ExistingVersion >= 3) ? EncryptionByte : static_cast<uint8>(ETurboStructLiteEncryption::None);
-			*Writer << EncryptionToWrite;
-			*Writer << UncompressedSize;
-			*Writer << DataSize;
-			int32 MetaSizeToWrite = (ExistingVersion >= 2) ? MetaSize : 0;
-			*Writer << MetaSizeToWrite;
-
-			int32 Remaining = DataSize;
-			while (Remaining > 0)
+	OutHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath, true, true));
+	if (!OutHandle)
+	{
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Open writer failed"));
+		}
+		return false;
+	}
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::AppendEntryRecord(IFileHandle& Handle, FTurboStructLiteSlotIndex& Index, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, bool bUseWriteAheadLog, const FString& WALPath, const TArray<uint8>* EncodedPayload)
+{
+	const int32 ResolvedBatchMB = UTurboStructLiteBPLibrary::ResolveBatchingMB(CompressionBatching);
+	const ETurboStructLiteEncryption ResolvedEncryption = Encryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : Encryption;
+	const bool bEncryptPayload = ResolvedEncryption == ETurboStructLiteEncryption::AES;
+
+	const FTCHARToUTF8 MetaUtf8(*DebugMeta);
+	TArray<uint8> MetaBytes;
+	if (MetaUtf8.Length() > 0)
+	{
+		MetaBytes.Append(reinterpret_cast<const uint8*>(MetaUtf8.Get()), MetaUtf8.Length());
+		if (Encryption == ETurboStructLiteEncryption::AES)
+		{
+			TArray<uint8> EncryptedMeta = MetaBytes;
+			if (EncryptDataBuffer(Encryption, EncryptionKey, EncryptedMeta))
 			{
-				const int32 ChunkSize = FMath::Min(Remaining, Buffer.Num());
-				Reader->Serialize(Buffer.GetData(), ChunkSize);
-				if (Reader->IsError())
-				{
-					return FailAndCleanup();
-				}
-				Writer->Serialize(Buffer.GetData(), ChunkSize);
-				if (Writer->IsError())
-				{
-					return FailAndCleanup();
-				}
-				Remaining -= ChunkSize;
+				MetaBytes = MoveTemp(EncryptedMeta);
 			}
+			else
+			{
+				MetaBytes.Reset();
+			}
+		}
+	}
 
-			if (MetaSizeToWrite > 0)
+	if (bUseWriteAheadLog)
+	{
+		WriteWALEntry(WALPath, TEXT("Append record start"));
+	}
+
+	// Records are appended after the last committed footer; a failed append only leaves dead bytes.
+	TArray<uint8> RecordHeader;
+	FMemoryWriter RecordWriter(RecordHeader, true);
+	int32 SubSlotToWrite = SubSlotIndex;
+	RecordWriter << SubSlotToWrite;
+	uint8 CompressionByte = static_cast<uint8>(Compression);
+	RecordWriter << CompressionByte;
+	uint8 EncryptionByte = static_cast<uint8>(Encryption);
+	RecordWriter << EncryptionByte;
+	int32 UncompressedSize = RawBytes.Num();
+	RecordWriter << UncompressedSize;
+	// DataSize is patched once the streamed payload has been written.
+	int32 DataSize = 0;
+	RecordWriter << DataSize;
+	int32 MetaSize = MetaBytes.Num();
+	RecordWriter << MetaSize;
+
+	if (!Handle.SeekFromEnd(0))
+	{
+		return false;
+	}
+	const int64 RecordStart = Handle.Tell();
+	bool bAppended = Handle.Write(RecordHeader.GetData(), RecordHeader.Num());
+	if (bAppended)
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_Save_StreamPayload"));
+		if (EncodedPayload && EncodedPayload->Num() > 0)
+		{
+			DataSize = EncodedPayload->Num();
+			bAppended = Handle.Write(EncodedPayload->GetData(), DataSize);
+		}
+		else
+		{
+			if (bUseWriteAheadLog)
 			{
-				int32 RemainingMeta = MetaSizeToWrite;
-				while (RemainingMeta > 0)
-				{
-					const int32 ChunkSize = FMath::Min(RemainingMeta, Buffer.Num());
-					Reader->Serialize(Buffer.GetData(), ChunkSize);
-					if (Reader->IsError())
-					{
-						return FailAndCleanup();
-					}
-					Writer->Serialize(Buffer.GetData(), ChunkSize);
-					if (Writer->IsError())
-					{
-						return FailAndCleanup();
-					}
-					RemainingMeta -= ChunkSize;
-				}
+				WriteWALEntry(WALPath, bEncryptPayload ? TEXT("Compress and encrypt start") : TEXT("Compress start"));
 			}
+			bAppended = WriteEntryPayloadStreamed(Handle, Compression, bEncryptPayload, EncryptionKey, RawBytes, MaxParallelThreads, ResolvedBatchMB, DataSize);
+		}
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, bAppended ? FString::Printf(TEXT("Payload written Size=%d"), DataSize) : TEXT("Payload write failed"));
+		}
+	}
+	TArray<uint8> DataSizeBytes;
+	FMemoryWriter DataSizeWriter(DataSizeBytes, true);
+	DataSizeWriter << DataSize;
+	bAppended = bAppended
+		&& (MetaSize == 0 || Handle.Write(MetaBytes.GetData(), MetaSize))
+		&& Handle.Seek(RecordStart + TurboStructLiteRecordDataSizeOffset)
+		&& Handle.Write(DataSizeBytes.GetData(), DataSizeBytes.Num())
+		&& Handle.SeekFromEnd(0);
+	if (!bAppended)
+	{
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Append record failed"));
+		}
+		return false;
+	}
+
+	FTurboStructLiteCachedEntry NewEntry;
+	NewEntry.Compression = Compression;
+	NewEntry.Encryption = Encryption;
+	NewEntry.UncompressedSize = UncompressedSize;
+	NewEntry.DataSize = DataSize;
+	NewEntry.MetaSize = MetaSize;
+	NewEntry.DataOffset = RecordStart + RecordHeader.Num();
+	NewEntry.MetaOffset = NewEntry.DataOffset + DataSize;
+	if (!bEncryptPayload)
+	{
+		NewEntry.ZoneMap = BuildZoneMap(RawBytes);
+	}
+	uint64 SchemaHash = 0;
+	if (ReadSchemaHashFromBytes(RawBytes, SchemaHash))
+	{
+		Index.SchemaHashes.AddUnique(SchemaHash);
+	}
+	if (!Index.Entries.Contains(SubSlotIndex))
+	{
+		Index.OrderedSubSlots.Add(SubSlotIndex);
+	}
+	Index.Entries.Add(SubSlotIndex, NewEntry);
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::CommitAppendedEntries(const FString& SlotName, TUniquePtr<IFileHandle>& Handle, FTurboStructLiteSlotIndex& Index, bool bUseWriteAheadLog, const FString& WALPath)
+{
+	if (bUseWriteAheadLog)
+	{
+		WriteWALEntry(WALPath, TEXT("Commit footer start"));
+	}
+	const bool bCommitted = CommitSlotFooter(*Handle, Index);
+	Handle.Reset();
+	InvalidateSlotIndex(SlotName);
+	if (!bCommitted)
+	{
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Commit footer failed"));
+		}
+		return false;
+	}
+	if (bUseWriteAheadLog)
+	{
+		WriteWALEntry(WALPath, TEXT("Commit footer success"));
+	}
+
+	CompactSlotFileIfNeeded(SlotName, Index, bUseWriteAheadLog, WALPath);
+	return true;
+}
 
-			++EntryCount;
+bool UTurboStructLiteBPLibrary::SaveEntry(const FString& SlotName, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, bool bUseWriteAheadLog, const FString& WALPath)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveEntry"));
+	if (bUseWriteAheadLog)
+	{
+		WriteWALEntry(WALPath, FString::Printf(TEXT("Start SaveEntry Slot=%s SubSlot=%d Bytes=%d Compression=%d Encryption=%d"), *SlotName, SubSlotIndex, RawBytes.Num(), static_cast<int32>(Compression), static_cast<int32>(Encryption)));
+	}
+	if (!IsSavePayloadValid(Encryption, EncryptionKey, RawBytes))
+	{
+		if (bUseWriteAheadLog)
+		{
+			WriteWALEntry(WALPath, TEXT("Invalid payload or missing key"));
 		}
+		return false;
 	}
 
-	const FTCHARToUTF8 MetaUtf8(*DebugMeta);
-	int32 MetaSize = MetaUtf8.Length();
+	const FTurboStructLiteSlotCommitStamp IndexedStamp = GetIndexedSlotStamp(SlotName);
+	FTurboStructLiteSlotIndex Index;
+	TUniquePtr<IFileHandle> Handle;
+	if (!OpenSlotForAppend(SlotName, Index, Handle, bUseWriteAheadLog, WALPath))
+	{
+		return false;
+	}
+	if (!AppendEntryRecord(*Handle, Index, SubSlotIndex, Compression, Encryption, EncryptionKey, RawBytes, DebugMeta, MaxParallelThreads, CompressionBatching, bUseWriteAheadLog, WALPath))
+	{
+		return false;
+	}
+	if (!CommitAppendedEntries(SlotName, Handle, Index, bUseWriteAheadLog, WALPath))
+	{
+		return false;
+	}
+	UpdateSecondaryIndexes(SlotName, IndexedStamp, {SubSlotIndex}, {&RawBytes});
+	if (bUseWriteAheadLog)
+	{
+		WriteWALEntry(WALPath, TEXT("SaveEntry completed"));
+	}
+	return true;
+}
 
-	int32 SubSlotToWrite = SubSlotIndex;
-	*Writer << SubSlotToWrite;
-	uint8 CompressionByte = static_cast<uint8>(Compression);
-	*Writer << CompressionByte;
-	uint8 EncryptionByte = static_cast<uint8>(Encryption);
-	*Writer << EncryptionByte;
-	int32 UncompressedSize = NewEntry.UncompressedSize;
-	*Writer << UncompressedSize;
-	int32 DataSize = NewEntry.Data.Num();
-	*Writer << DataSize;
-	TArray<uint8> MetaBytes;
-	if (MetaSize > 0)
+bool UTurboStructLiteBPLibrary::SaveEntries(const FString& SlotName, const TArray<FTurboStructLiteSaveRequest>& Entries, TArray<bool>& OutResults)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveEntries"));
+	OutResults.Init(false, Entries.Num());
+	TArray<bool> Appended;
+	Appended.Init(false, Entries.Num());
+	int32 LeadIndex = INDEX_NONE;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
 	{
-		MetaBytes.Append(reinterpret_cast<const uint8*>(MetaUtf8.Get()), MetaSize);
-		if (Encryption == ETurboStructLiteEncryption::AES)
+		const FTurboStructLiteSaveRequest& Entry = Entries[EntryIndex];
+		if (Entry.bUseWriteAheadLog)
 		{
-			TArray<uint8> EncryptedMeta = MetaBytes;
-			if (EncryptDataBuffer(Encryption, EncryptionKey, EncryptedMeta))
-			{
-				MetaBytes = MoveTemp(EncryptedMeta);
-			}
-			else
+			WriteWALEntry(Entry.WALPath, FString::Printf(TEXT("Start SaveEntries Slot=%s SubSlot=%d Bytes=%d Batch=%d"), *SlotName, Entry.SubSlotIndex, Entry.RawBytes.Num(), Entries.Num()));
+		}
+		if (!IsSavePayloadValid(Entry.Encryption, Entry.EncryptionKey, Entry.RawBytes))
+		{
+			if (Entry.bUseWriteAheadLog)
 			{
-				MetaBytes.Reset();
+				WriteWALEntry(Entry.WALPath, TEXT("Invalid payload or missing key"));
 			}
+			continue;
+		}
+		Appended[EntryIndex] = true;
+		if (LeadIndex == INDEX_NONE)
+		{
+			LeadIndex = EntryIndex;
 		}
-		MetaSize = MetaBytes.Num();
 	}
-	*Writer << MetaSize;
-	if (DataSize > 0)
+	if (LeadIndex == INDEX_NONE)
 	{
-		Writer->Serialize(const_cast<uint8*>(NewEntry.Data.GetData()), DataSize);
+		return false;
 	}
-	if (MetaSize > 0)
+
+	// Small entries gain little from chunk parallelism, so they are encoded side by side before the sequential append.
+	TArray<int32> InlineEntries;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
 	{
-		Writer->Serialize(MetaBytes.GetData(), MetaSize);
+		const FTurboStructLiteSaveRequest& Entry = Entries[EntryIndex];
+		const bool bEncrypt = (Entry.Encryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : Entry.Encryption) == ETurboStructLiteEncryption::AES;
+		if (Appended[EntryIndex] && (bEncrypt || Entry.Compression != ETurboStructLiteCompression::None) && Entry.RawBytes.Num() <= TurboStructLiteBatchInlineEntryBytes)
+		{
+			InlineEntries.Add(EntryIndex);
+		}
+	}
+	TArray<TArray<uint8>> EncodedPayloads;
+	EncodedPayloads.SetNum(Entries.Num());
+	if (InlineEntries.Num() > 1)
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveEntries_EncodeInline"));
+		ParallelFor(InlineEntries.Num(), [&](int32 InlineIndex)
+		{
+			const int32 EntryIndex = InlineEntries[InlineIndex];
+			const FTurboStructLiteSaveRequest& Entry = Entries[EntryIndex];
+			const bool bEncrypt = (Entry.Encryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : Entry.Encryption) == ETurboStructLiteEncryption::AES;
+			const int32 BatchMB = ResolveBatchingMB(Entry.CompressionBatching);
+			const bool bEncoded = bEncrypt
+				? CompressAndEncryptBuffer(Entry.Compression, Entry.EncryptionKey, Entry.RawBytes, EncodedPayloads[EntryIndex], 1, BatchMB)
+				: CompressBuffer(Entry.Compression, Entry.RawBytes, EncodedPayloads[EntryIndex], 1, BatchMB);
+			if (!bEncoded)
+			{
+				// Falls back to the streamed path during the append.
+				EncodedPayloads[EntryIndex].Reset();
+			}
+		}, EParallelForFlags::Unbalanced);
 	}
-	++EntryCount;
-
-	Writer->Seek(EntryCountOffset);
-	*Writer << EntryCount;
-
-	Writer.Reset();
-	Reader.Reset();
 
-	if (bUseWriteAheadLog)
+	// Every record goes after the same committed footer; one new footer publishes them all.
+	const bool bLeadWAL = Entries[LeadIndex].bUseWriteAheadLog;
+	const FString& LeadWALPath = Entries[LeadIndex].WALPath;
+	const FTurboStructLiteSlotCommitStamp IndexedStamp = GetIndexedSlotStamp(SlotName);
+	FTurboStructLiteSlotIndex Index;
+	TUniquePtr<IFileHandle> Handle;
+	if (!OpenSlotForAppend(SlotName, Index, Handle, bLeadWAL, LeadWALPath))
 	{
-		WriteWALEntry(WALPath, TEXT("Move temp to final start"));
+		return false;
 	}
-	if (!IFileManager::Get().Move(*FilePath, *TempPath, true, true, false, true))
+	bool bAnyAppended = false;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
 	{
-		IFileManager::Get().Delete(*TempPath);
-		if (bUseWriteAheadLog)
+		if (!Appended[EntryIndex])
 		{
-			WriteWALEntry(WALPath, TEXT("Move temp to final failed"));
+			continue;
 		}
+		const FTurboStructLiteSaveRequest& Entry = Entries[EntryIndex];
+		Appended[EntryIndex] = AppendEntryRecord(*Handle, Index, Entry.SubSlotIndex, Entry.Compression, Entry.Encryption, Entry.EncryptionKey, Entry.RawBytes, Entry.DebugMetadata, Entry.MaxParallelThreads, Entry.CompressionBatching, Entry.bUseWriteAheadLog, Entry.WALPath, &EncodedPayloads[EntryIndex]);
+		EncodedPayloads[EntryIndex].Empty();
+		bAnyAppended |= Appended[EntryIndex];
+	}
+	if (!bAnyAppended)
+	{
 		return false;
 	}
-
-	if (bUseWriteAheadLog)
+	const bool bCommitted = CommitAppendedEntries(SlotName, Handle, Index, bLeadWAL, LeadWALPath);
+	TArray<int32> IndexedSubSlots;
+	TArray<const TArray<uint8>*> IndexedPayloads;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
 	{
-		WriteWALEntry(WALPath, TEXT("Move temp to final success"));
+		OutResults[EntryIndex] = bCommitted && Appended[EntryIndex];
+		const FTurboStructLiteSaveRequest& Entry = Entries[EntryIndex];
+		if (Entry.bUseWriteAheadLog && EntryIndex != LeadIndex && Appended[EntryIndex])
+		{
+			WriteWALEntry(Entry.WALPath, bCommitted ? TEXT("Batch commit success") : TEXT("Batch commit failed"));
+		}
+		if (OutResults[EntryIndex])
+		{
+			IndexedSubSlots.Add(Entry.SubSlotIndex);
+			IndexedPayloads.Add(&Entry.RawBytes);
+		}
 	}
-	InvalidateSlotIndex(SlotName);
-	if (bUseWriteAheadLog)
+	if (bCommitted)
 	{
-		WriteWALEntry(WALPath, TEXT("SaveEntry completed"));
+		UpdateSecondaryIndexes(SlotName, IndexedStamp, IndexedSubSlots, IndexedPayloads);
 	}
-	return true;
+	return bCommitted;
 }
 
 bool UTurboStructLiteBPLibrary::ListSubSlotIndices(const FString& SlotName, TArray<int32>& OutSubSlots)
@@ -1918,6 +3542,43 @@ bool UTurboStructLiteBPLibrary::LoadEntry(const FString& SlotName, int32 SubSlot
 		}
 		return false;
 	}
+	ETurboStructLiteEncryption EffectiveEncryption = Cached.Encryption;
+	if (EffectiveEncryption == ETurboStructLiteEncryption::ProjectDefault)
+	{
+		EffectiveEncryption = DefaultEncryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : DefaultEncryption;
+	}
+	const bool bEncrypted = EffectiveEncryption == ETurboStructLiteEncryption::AES;
+	FString KeyToUse = EncryptionKey;
+	if (bEncrypted)
+	{
+		if (KeyToUse.IsEmpty())
+		{
+			KeyToUse = GetActiveEncryptionKey();
+		}
+		if (KeyToUse.IsEmpty())
+		{
+			if (bUseWriteAheadLog)
+			{
+				WriteWALEntry(WALPath, TEXT("Decrypt missing key"));
+			}
+			return false;
+		}
+	}
+
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_Load_Streamed"));
+		bool bStreamed = false;
+		const bool bLoaded = LoadEntryStreamed(*Reader, Cached, bEncrypted, KeyToUse, OutRawBytes, bStreamed);
+		if (bStreamed)
+		{
+			if (bUseWriteAheadLog)
+			{
+				WriteWALEntry(WALPath, bLoaded ? FString::Printf(TEXT("Streamed load success Size=%d"), OutRawBytes.Num()) : TEXT("Streamed load failed"));
+			}
+			return bLoaded;
+		}
+	}
+
 	Reader->Seek(Cached.DataOffset);
 	if (!IsValidBufferSize(*Reader, Cached.DataSize))
 	{
@@ -1949,31 +3610,13 @@ bool UTurboStructLiteBPLibrary::LoadEntry(const FString& SlotName, int32 SubSlot
 			return false;
 		}
 	}
-	ETurboStructLiteEncryption EffectiveEncryption = Entry.Encryption;
-	if (EffectiveEncryption == ETurboStructLiteEncryption::ProjectDefault)
-	{
-		EffectiveEncryption = DefaultEncryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : DefaultEncryption;
-	}
-	if (EffectiveEncryption == ETurboStructLiteEncryption::AES)
+	if (bEncrypted)
 	{
 		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_Load_Decrypt"));
 		if (bUseWriteAheadLog)
 		{
 			WriteWALEntry(WALPath, TEXT("Decrypt start"));
 		}
-		FString KeyToUse = EncryptionKey;
-		if (KeyToUse.IsEmpty())
-		{
-			KeyToUse = GetActiveEncryptionKey();
-		}
-		if (KeyToUse.IsEmpty())
-		{
-			if (bUseWriteAheadLog)
-			{
-				WriteWALEntry(WALPath, TEXT("Decrypt missing key"));
-			}
-			return false;
-		}
 		if (!DecryptDataBuffer(ETurboStructLiteEncryption::AES, KeyToUse, Entry.Data))
 		{
 			if (bUseWriteAheadLog)
@@ -2000,197 +3643,158 @@ bool UTurboStructLiteBPLibrary::LoadEntry(const FString& SlotName, int32 SubSlot
 	return bDecompressed;
 }
 
-bool UTurboStructLiteBPLibrary::ExistsEntry(const FString& SlotName, int32 SubSlotIndex)
-{
-	FTurboStructLiteCachedEntry Cached;
-	return GetCachedEntry(SlotName, SubSlotIndex, Cached);
-}
-
-bool UTurboStructLiteBPLibrary::RemoveEntry(const FString& SlotName, int32 SubSlotIndex)
+bool UTurboStructLiteBPLibrary::LoadEntries(const FString& SlotName, const TArray<int32>& SubSlotIndices, const FString& EncryptionKey, ETurboStructLiteEncryption DefaultEncryption, TArray<TArray<uint8>>& OutRawBytes, TArray<bool>& OutResults)
 {
-	const FString FilePath = BuildSavePath(SlotName);
-	if (!FPaths::FileExists(FilePath))
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadEntries"));
+	OutRawBytes.Reset();
+	OutRawBytes.SetNum(SubSlotIndices.Num());
+	OutResults.Init(false, SubSlotIndices.Num());
+	UTurboStructLiteBPLibrary::EnsureSettingsLoaded();
+	FTurboStructLiteSlotIndex Index;
+	if (SubSlotIndices.Num() == 0 || !GetSlotIndex(SlotName, Index))
 	{
 		return false;
 	}
-
-	const FString TempPath = FilePath + TEXT(".tmp");
-
+	const FString FilePath = BuildSavePath(SlotName);
 	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
 	if (!Reader)
 	{
 		return false;
 	}
+	const FString ActiveKey = EncryptionKey.IsEmpty() ? GetActiveEncryptionKey() : EncryptionKey;
 
-	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
-	if (!Writer)
-	{
-		return false;
-	}
-
-	auto FailAndCleanup = [&]() -> bool
-	{
-		Writer.Reset();
-		Reader.Reset();
-		IFileManager::Get().Delete(*TempPath);
-		return false;
-	};
-
-	int32 EntryCount = 0;
-	int32 ExistingVersion = 1;
-	if (!ReadHeaderAndEntryCount(*Reader, GetMagic(), ExistingVersion, EntryCount))
-	{
-		return FailAndCleanup();
-	}
-
-	int32 Magic = GetMagic();
-	*Writer << Magic;
-	int32 VersionToWrite = GetVersion();
-	*Writer << VersionToWrite;
-	int64 Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
-	*Writer << Timestamp;
-	const int64 EntryCountOffset = Writer->Tell();
-	int32 NewEntryCount = 0;
-	*Writer << NewEntryCount;
-
-	bool bRemoved = false;
-	const int64 FileSize = Reader->TotalSize();
-	const int32 BufferSize = CalcStreamingBufferSize(FileSize);
-	TArray<uint8> Buffer;
-	Buffer.SetNum(BufferSize);
-
-	for (int32 Index = 0; Index < EntryCount; ++Index)
+	// Large entries stream through their own chunk pipeline; small ones are read in file order and decoded in parallel.
+	TArray<int32> InlineEntries;
+	TArray<bool> Encrypted;
+	Encrypted.Init(false, SubSlotIndices.Num());
+	for (int32 EntryIndex = 0; EntryIndex < SubSlotIndices.Num(); ++EntryIndex)
 	{
-		if (Reader->AtEnd())
+		const FTurboStructLiteCachedEntry* Cached = Index.Entries.Find(SubSlotIndices[EntryIndex]);
+		if (!Cached)
 		{
-			return FailAndCleanup();
+			continue;
 		}
-
-		int32 FoundSubSlot = 0;
-		uint8 CompressionByte = 0;
-		uint8 EncryptionByte = 0;
-		int32 UncompressedSize = 0;
-		int32 DataSize = 0;
-		int32 MetaSize = 0;
-		*Reader << FoundSubSlot;
-		*Reader << CompressionByte;
-		if (ExistingVersion >= 3)
+		ETurboStructLiteEncryption EffectiveEncryption = Cached->Encryption;
+		if (EffectiveEncryption == ETurboStructLiteEncryption::ProjectDefault)
 		{
-			*Reader << EncryptionByte;
+			EffectiveEncryption = DefaultEncryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : DefaultEncryption;
 		}
-		*Reader << UncompressedSize;
-		*Reader << DataSize;
-
-		if (DataSize < 0)
+		Encrypted[EntryIndex] = EffectiveEncryption == ETurboStructLiteEncryption::AES;
+		if (Encrypted[EntryIndex] && ActiveKey.IsEmpty())
 		{
-			return FailAndCleanup();
+			continue;
 		}
-
-		if (ExistingVersion >= 2)
+		if (Cached->DataSize <= TurboStructLiteBatchInlineEntryBytes)
 		{
-			*Reader << MetaSize;
-			if (MetaSize < 0)
-			{
-				return FailAndCleanup();
-			}
+			InlineEntries.Add(EntryIndex);
+			continue;
 		}
+		bool bStreamed = false;
+		OutResults[EntryIndex] = LoadEntryStreamed(*Reader, *Cached, Encrypted[EntryIndex], ActiveKey, OutRawBytes[EntryIndex], bStreamed) && bStreamed;
+		if (!bStreamed)
+		{
+			InlineEntries.Add(EntryIndex);
+		}
+	}
+	InlineEntries.Sort([&Index, &SubSlotIndices](int32 A, int32 B)
+	{
+		return Index.Entries[SubSlotIndices[A]].DataOffset < Index.Entries[SubSlotIndices[B]].DataOffset;
+	});
 
-		if (FoundSubSlot == SubSlotIndex)
+	TArray<TArray<uint8>> EncodedPayloads;
+	EncodedPayloads.SetNum(SubSlotIndices.Num());
+	TArray<bool> Read;
+	Read.Init(false, SubSlotIndices.Num());
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadEntries_ReadData"));
+		for (const int32 EntryIndex : InlineEntries)
 		{
-			if (!SkipData(*Reader, DataSize))
+			const FTurboStructLiteCachedEntry& Cached = Index.Entries[SubSlotIndices[EntryIndex]];
+			Reader->Seek(Cached.DataOffset);
+			if (!IsValidBufferSize(*Reader, Cached.DataSize))
 			{
-				return FailAndCleanup();
+				continue;
 			}
-			if (ExistingVersion >= 2 && MetaSize > 0)
+			EncodedPayloads[EntryIndex].SetNumUninitialized(Cached.DataSize);
+			if (Cached.DataSize > 0)
 			{
-				if (!SkipData(*Reader, MetaSize))
-				{
-					return FailAndCleanup();
-				}
+				Reader->Serialize(EncodedPayloads[EntryIndex].GetData(), Cached.DataSize);
 			}
-			bRemoved = true;
-			continue;
+			Read[EntryIndex] = !Reader->IsError();
 		}
+	}
+	Reader.Reset();
 
-		*Writer << FoundSubSlot;
-		*Writer << CompressionByte;
-		uint8 EncryptionToWrite = (ExistingVersion >= 3) ? EncryptionByte : static_cast<uint8>(ETurboStructLiteEncryption::None);
-		*Writer << EncryptionToWrite;
-		*Writer << UncompressedSize;
-		*Writer << DataSize;
-		int32 MetaSizeToWrite = (ExistingVersion >= 2) ? MetaSize : 0;
-		*Writer << MetaSizeToWrite;
-
-		int32 Remaining = DataSize;
-		while (Remaining > 0)
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadEntries_Decode"));
+		ParallelFor(InlineEntries.Num(), [&](int32 InlineIndex)
 		{
-			const int32 ChunkSize = FMath::Min(Remaining, Buffer.Num());
-			Reader->Serialize(Buffer.GetData(), ChunkSize);
-			if (Reader->IsError())
+			const int32 EntryIndex = InlineEntries[InlineIndex];
+			if (!Read[EntryIndex])
 			{
-				return FailAndCleanup();
+				return;
 			}
-			Writer->Serialize(Buffer.GetData(), ChunkSize);
-			if (Writer->IsError())
+			TArray<uint8>& Data = EncodedPayloads[EntryIndex];
+			if (Encrypted[EntryIndex] && !DecryptDataBuffer(ETurboStructLiteEncryption::AES, ActiveKey, Data))
 			{
-				return FailAndCleanup();
+				return;
 			}
-			Remaining -= ChunkSize;
-		}
+			OutResults[EntryIndex] = DecompressBuffer(Index.Entries[SubSlotIndices[EntryIndex]].Compression, Data, OutRawBytes[EntryIndex]);
+			Data.Empty();
+		}, EParallelForFlags::Unbalanced);
+	}
 
-		if (MetaSizeToWrite > 0)
+	for (const bool bLoaded : OutResults)
+	{
+		if (!bLoaded)
 		{
-			int32 RemainingMeta = MetaSizeToWrite;
-			while (RemainingMeta > 0)
-			{
-				const int32 ChunkSize = FMath::Min(RemainingMeta, Buffer.Num());
-				Reader->Serialize(Buffer.GetData(), ChunkSize);
-				if (Reader->IsError())
-				{
-					return FailAndCleanup();
-				}
-				Writer->Serialize(Buffer.GetData(), ChunkSize);
-				if (Writer->IsError())
-				{
-					return FailAndCleanup();
-				}
-				RemainingMeta -= ChunkSize;
-			}
+			return false;
 		}
-
-		++NewEntryCount;
 	}
+	return true;
+}
 
-	if (!bRemoved)
+bool UTurboStructLiteBPLibrary::ExistsEntry(const FString& SlotName, int32 SubSlotIndex)
+{
+	FTurboStructLiteCachedEntry Cached;
+	return GetCachedEntry(SlotName, SubSlotIndex, Cached);
+}
+
+bool UTurboStructLiteBPLibrary::RemoveEntry(const FString& SlotName, int32 SubSlotIndex)
+{
+	const FString FilePath = BuildSavePath(SlotName);
+	FTurboStructLiteSlotIndex Index;
+	if (!GetSlotIndex(SlotName, Index) || !Index.Entries.Contains(SubSlotIndex))
 	{
-		return FailAndCleanup();
+		return false;
 	}
 
-	Writer->Seek(EntryCountOffset);
-	*Writer << NewEntryCount;
-
-	Writer.Reset();
-	Reader.Reset();
-	if (NewEntryCount == 0)
+	const FTurboStructLiteSlotCommitStamp IndexedStamp = GetIndexedSlotStamp(SlotName);
+	if (Index.Version < TurboStructLiteAppendOnlyVersion || Index.OrderedSubSlots.Num() <= 1)
 	{
-		IFileManager::Get().Delete(*TempPath);
-		const bool bDeleted = IFileManager::Get().Delete(*FilePath, false, true);
-		if (bDeleted)
+		if (!CompactSlotFile(SlotName, SubSlotIndex))
 		{
-			InvalidateSlotIndex(SlotName);
+			return false;
 		}
-		return bDeleted;
+		UpdateSecondaryIndexes(SlotName, IndexedStamp, {SubSlotIndex}, {nullptr});
+		return true;
 	}
 
-	if (!IFileManager::Get().Move(*FilePath, *TempPath, true, true, false, true))
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*FilePath, true, true));
+	if (!Handle)
 	{
-		IFileManager::Get().Delete(*TempPath);
 		return false;
 	}
-
+	Index.Entries.Remove(SubSlotIndex);
+	Index.OrderedSubSlots.Remove(SubSlotIndex);
+	const bool bCommitted = CommitSlotFooter(*Handle, Index);
+	Handle.Reset();
 	InvalidateSlotIndex(SlotName);
+	if (!bCommitted)
+	{
+		return false;
+	}
+	CompactSlotFileIfNeeded(SlotName, Index);
+	UpdateSecondaryIndexes(SlotName, IndexedStamp, {SubSlotIndex}, {nullptr});
 	return true;
 }
-
-
-
@@ -0,0 +1,571 @@
+#include "TurboStructLiteBPLibrary.h"
+#include "TurboStructLiteConstants.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "TurboStructLiteDebugMacros.h"
+
+bool UTurboStructLiteBPLibrary::TurboStructLiteCreateIndex(const FString& MainSlotName, const FString& FieldPath, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption)
+{
+	const FString TrimmedPath = FieldPath.TrimStartAndEnd();
+	if (MainSlotName.IsEmpty() || TrimmedPath.IsEmpty())
+	{
+		return false;
+	}
+	const ETurboStructLiteEncryption ResolvedEncryption = Encryption == ETurboStructLiteEncryption::ProjectDefault ? GetActiveEncryptionMode() : Encryption;
+	if (ResolvedEncryption == ETurboStructLiteEncryption::AES)
+	{
+		// The sidecar stores field values in plaintext, which would leak the contents of an encrypted slot.
+		TURBOSTRUCTLITE_DEBUG_LOG_WARNING(FString::Printf(TEXT("CreateIndex on slot \"%s\" refused: secondary indexes are not supported on AES slots"), *MainSlotName));
+		return false;
+	}
+	BeginSlotOperation(MainSlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(MainSlotName);
+	bool bCreated = false;
+	{
+		FWriteScopeLock Lock(*OpLock);
+		if (HasEncryptedEntries(MainSlotName))
+		{
+			TURBOSTRUCTLITE_DEBUG_LOG_WARNING(FString::Printf(TEXT("CreateIndex on slot \"%s\" refused: secondary indexes are not supported on AES slots"), *MainSlotName));
+			EndSlotOperation(MainSlotName);
+			return false;
+		}
+		FTurboStructLiteSecondaryIndexSet Set;
+		ReadSecondaryIndexes(MainSlotName, Set);
+		Set.Indexes.RemoveAll([&TrimmedPath](const FTurboStructLiteFieldIndex& Index)
+		{
+			return Index.FieldPath.Equals(TrimmedPath, ESearchCase::IgnoreCase);
+		});
+		FTurboStructLiteFieldIndex& NewIndex = Set.Indexes.AddDefaulted_GetRef();
+		NewIndex.FieldPath = TrimmedPath;
+
+		// Every index is rebuilt so a sidecar that went stale is brought back in line with the slot.
+		TArray<int32> SubSlots;
+		ListSubSlotIndices(MainSlotName, SubSlots);
+		if (RebuildIndexes(Set.Indexes, MainSlotName, SubSlots, EncryptionKey, ResolvedEncryption))
+		{
+			Set.SlotStamp = ReadSlotCommitStamp(MainSlotName);
+			bCreated = WriteSecondaryIndexes(MainSlotName, Set);
+		}
+		else
+		{
+			TURBOSTRUCTLITE_DEBUG_LOG_WARNING(FString::Printf(TEXT("CreateIndex on slot \"%s\" failed: could not load every subslot"), *MainSlotName));
+		}
+	}
+	EndSlotOperation(MainSlotName);
+	return bCreated;
+}
+
+bool UTurboStructLiteBPLibrary::TurboStructLiteDropIndex(const FString& MainSlotName, const FString& FieldPath)
+{
+	const FString TrimmedPath = FieldPath.TrimStartAndEnd();
+	if (MainSlotName.IsEmpty() || TrimmedPath.IsEmpty())
+	{
+		return false;
+	}
+	BeginSlotOperation(MainSlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(MainSlotName);
+	bool bDropped = false;
+	{
+		FWriteScopeLock Lock(*OpLock);
+		FTurboStructLiteSecondaryIndexSet Set;
+		if (ReadSecondaryIndexes(MainSlotName, Set))
+		{
+			const int32 Removed = Set.Indexes.RemoveAll([&TrimmedPath](const FTurboStructLiteFieldIndex& Index)
+			{
+				return Index.FieldPath.Equals(TrimmedPath, ESearchCase::IgnoreCase);
+			});
+			// The stamp is kept as read so a stale sidecar stays stale.
+			bDropped = Removed > 0 && WriteSecondaryIndexes(MainSlotName, Set);
+		}
+	}
+	EndSlotOperation(MainSlotName);
+	return bDropped;
+}
+
+TArray<FString> UTurboStructLiteBPLibrary::TurboStructLiteGetIndexedFields(const FString& MainSlotName)
+{
+	TArray<FString> Fields;
+	if (MainSlotName.IsEmpty())
+	{
+		return Fields;
+	}
+	BeginSlotOperation(MainSlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(MainSlotName);
+	{
+		FReadScopeLock Lock(*OpLock);
+		FTurboStructLiteSecondaryIndexSet Set;
+		if (ReadSecondaryIndexes(MainSlotName, Set))
+		{
+			for (const FTurboStructLiteFieldIndex& Index : Set.Indexes)
+			{
+				Fields.Add(Index.FieldPath);
+			}
+		}
+	}
+	EndSlotOperation(MainSlotName);
+	return Fields;
+}
+
+FString UTurboStructLiteBPLibrary::BuildIndexPath(const FString& SlotName)
+{
+	return BuildSavePath(SlotName) + TurboStructLiteIndexFileSuffix;
+}
+
+bool UTurboStructLiteBPLibrary::ReadSecondaryIndexes(const FString& SlotName, FTurboStructLiteSecondaryIndexSet& OutSet)
+{
+	OutSet = FTurboStructLiteSecondaryIndexSet();
+	const FString IndexPath = BuildIndexPath(SlotName);
+	if (!FPaths::FileExists(IndexPath))
+	{
+		return false;
+	}
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *IndexPath))
+	{
+		return false;
+	}
+	FMemoryReader Reader(Bytes, true);
+	int32 Magic = 0;
+	int32 Version = 0;
+	int32 IndexCount = 0;
+	Reader << Magic;
+	Reader << Version;
+	Reader << OutSet.SlotStamp.FileSize;
+	Reader << OutSet.SlotStamp.FooterOffset;
+	Reader << OutSet.SlotStamp.CommitTimestamp;
+	Reader << IndexCount;
+	if (Reader.IsError() || Magic != TurboStructLiteIndexMagic || Version != TurboStructLiteIndexVersion || IndexCount < 0)
+	{
+		OutSet = FTurboStructLiteSecondaryIndexSet();
+		return false;
+	}
+	auto ReadCount = [&Reader](int32 ElementBytes, int32& OutCount) -> bool
+	{
+		Reader << OutCount;
+		return !Reader.IsError() && OutCount >= 0 && static_cast<int64>(OutCount) * ElementBytes <= Reader.TotalSize() - Reader.Tell();
+	};
+	for (int32 IndexNum = 0; IndexNum < IndexCount; ++IndexNum)
+	{
+		FTurboStructLiteFieldIndex& Index = OutSet.Indexes.AddDefaulted_GetRef();
+		Reader << Index.FieldPath;
+		int32 Count = 0;
+		if (!ReadCount(sizeof(double) + sizeof(int32), Count))
+		{
+			OutSet = FTurboStructLiteSecondaryIndexSet();
+			return false;
+		}
+		Index.SortedKeys.SetNum(Count);
+		for (FTurboStructLiteIndexKey& Key : Index.SortedKeys)
+		{
+			Reader << Key.Value;
+			Reader << Key.SubSlot;
+		}
+		if (!ReadCount(sizeof(uint32) + sizeof(int32), Count))
+		{
+			OutSet = FTurboStructLiteSecondaryIndexSet();
+			return false;
+		}
+		Index.HashKeys.SetNum(Count);
+		for (FTurboStructLiteIndexHashKey& Key : Index.HashKeys)
+		{
+			Reader << Key.Hash;
+			Reader << Key.SubSlot;
+		}
+		if (!ReadCount(sizeof(int32), Count))
+		{
+			OutSet = FTurboStructLiteSecondaryIndexSet();
+			return false;
+		}
+		Index.UnkeyedSubSlots.SetNum(Count);
+		for (int32& SubSlot : Index.UnkeyedSubSlots)
+		{
+			Reader << SubSlot;
+		}
+	}
+	if (Reader.IsError())
+	{
+		OutSet = FTurboStructLiteSecondaryIndexSet();
+		return false;
+	}
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::WriteSecondaryIndexes(const FString& SlotName, const FTurboStructLiteSecondaryIndexSet& Set)
+{
+	const FString IndexPath = BuildIndexPath(SlotName);
+	if (Set.Indexes.Num() == 0)
+	{
+		return !FPaths::FileExists(IndexPath) || IFileManager::Get().Delete(*IndexPath, false, true, true);
+	}
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes, true);
+	int32 Magic = TurboStructLiteIndexMagic;
+	int32 Version = TurboStructLiteIndexVersion;
+	int32 IndexCount = Set.Indexes.Num();
+	FTurboStructLiteSlotCommitStamp SlotStamp = Set.SlotStamp;
+	Writer << Magic;
+	Writer << Version;
+	Writer << SlotStamp.FileSize;
+	Writer << SlotStamp.FooterOffset;
+	Writer << SlotStamp.CommitTimestamp;
+	Writer << IndexCount;
+	for (const FTurboStructLiteFieldIndex& Index : Set.Indexes)
+	{
+		FString FieldPath = Index.FieldPath;
+		Writer << FieldPath;
+		int32 Count = Index.SortedKeys.Num();
+		Writer << Count;
+		for (const FTurboStructLiteIndexKey& Key : Index.SortedKeys)
+		{
+			double Value = Key.Value;
+			int32 SubSlot = Key.SubSlot;
+			Writer << Value;
+			Writer << SubSlot;
+		}
+		Count = Index.HashKeys.Num();
+		Writer << Count;
+		for (const FTurboStructLiteIndexHashKey& Key : Index.HashKeys)
+		{
+			uint32 Hash = Key.Hash;
+			int32 SubSlot = Key.SubSlot;
+			Writer << Hash;
+			Writer << SubSlot;
+		}
+		Count = Index.UnkeyedSubSlots.Num();
+		Writer << Count;
+		for (int32 SubSlot : Index.UnkeyedSubSlots)
+		{
+			Writer << SubSlot;
+		}
+	}
+	if (!FFileHelper::SaveArrayToFile(Bytes, *IndexPath))
+	{
+		TURBOSTRUCTLITE_DEBUG_LOG_WARNING(FString::Printf(TEXT("Writing secondary indexes of slot \"%s\" failed; queries fall back to a scan"), *SlotName));
+		return false;
+	}
+	return true;
+}
+
+bool UTurboStructLiteBPLibrary::GetFreshSecondaryIndexes(const FString& SlotName, FTurboStructLiteSecondaryIndexSet& OutSet)
+{
+	if (!ReadSecondaryIndexes(SlotName, OutSet) || OutSet.Indexes.Num() == 0)
+	{
+		return false;
+	}
+	return OutSet.SlotStamp == ReadSlotCommitStamp(SlotName);
+}
+
+FTurboStructLiteSlotCommitStamp UTurboStructLiteBPLibrary::ReadSlotCommitStamp(const FString& SlotName)
+{
+	FTurboStructLiteSlotCommitStamp Stamp;
+	const FString FilePath = BuildSavePath(SlotName);
+	Stamp.FileSize = IFileManager::Get().FileSize(*FilePath);
+	if (Stamp.FileSize < 0)
+	{
+		return Stamp;
+	}
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
+	{
+		return Stamp;
+	}
+	// Commits rewrite the header timestamp and footer offset, so a same-size rewrite still reads as a new commit.
+	int32 Magic = 0;
+	int32 Version = 0;
+	int32 EntryCount = 0;
+	int64 Timestamp = 0;
+	int64 FooterOffset = 0;
+	*Reader << Magic;
+	*Reader << Version;
+	*Reader << Timestamp;
+	*Reader << EntryCount;
+	if (Version >= TurboStructLiteAppendOnlyVersion)
+	{
+		*Reader << FooterOffset;
+	}
+	if (!Reader->IsError())
+	{
+		Stamp.FooterOffset = FooterOffset;
+		Stamp.CommitTimestamp = Timestamp;
+	}
+	return Stamp;
+}
+
+FTurboStructLiteSlotCommitStamp UTurboStructLiteBPLibrary::GetIndexedSlotStamp(const FString& SlotName)
+{
+	if (!FPaths::FileExists(BuildIndexPath(SlotName)))
+	{
+		FTurboStructLiteSlotCommitStamp NoIndexes;
+		NoIndexes.FileSize = -2;
+		return NoIndexes;
+	}
+	return ReadSlotCommitStamp(SlotName);
+}
+
+void UTurboStructLiteBPLibrary::UpdateSecondaryIndexes(const FString& SlotName, const FTurboStructLiteSlotCommitStamp& StampBefore, const TArray<int32>& SubSlots, const TArray<const TArray<uint8>*>& Payloads)
+{
+	if (StampBefore.FileSize == -2 || SubSlots.Num() != Payloads.Num())
+	{
+		return;
+	}
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_UpdateSecondaryIndexes"));
+	FTurboStructLiteSecondaryIndexSet Set;
+	if (!ReadSecondaryIndexes(SlotName, Set) || Set.SlotStamp != StampBefore)
+	{
+		// Already stale: leave it for the next CreateIndex rather than stamping partial keys as current.
+		return;
+	}
+	if (HasEncryptedEntries(SlotName))
+	{
+		// An AES entry was written into an indexed slot; drop the plaintext sidecar instead of keying it.
+		WriteSecondaryIndexes(SlotName, FTurboStructLiteSecondaryIndexSet());
+		return;
+	}
+	for (FTurboStructLiteFieldIndex& Index : Set.Indexes)
+	{
+		for (int32 EntryIndex = 0; EntryIndex < SubSlots.Num(); ++EntryIndex)
+		{
+			SetIndexEntry(Index, SubSlots[EntryIndex], Payloads[EntryIndex]);
+		}
+	}
+	Set.SlotStamp = ReadSlotCommitStamp(SlotName);
+	WriteSecondaryIndexes(SlotName, Set);
+}
+
+bool UTurboStructLiteBPLibrary::HasEncryptedEntries(const FString& SlotName)
+{
+	FTurboStructLiteSlotIndex SlotIndex;
+	if (!GetSlotIndex(SlotName, SlotIndex))
+	{
+		return false;
+	}
+	const ETurboStructLiteEncryption DefaultEncryption = GetActiveEncryptionMode();
+	for (const TPair<int32, FTurboStructLiteCachedEntry>& Pair : SlotIndex.Entries)
+	{
+		const ETurboStructLiteEncryption Resolved = Pair.Value.Encryption == ETurboStructLiteEncryption::ProjectDefault ? DefaultEncryption : Pair.Value.Encryption;
+		if (Resolved == ETurboStructLiteEncryption::AES)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UTurboStructLiteBPLibrary::TransferSecondaryIndexes(const FString& SourceSlotName, const FString& TargetSlotName, bool bMove)
+{
+	const FString SourcePath = BuildIndexPath(SourceSlotName);
+	const FString TargetPath = BuildIndexPath(TargetSlotName);
+	if (SourcePath == TargetPath)
+	{
+		return;
+	}
+	if (!FPaths::FileExists(SourcePath))
+	{
+		IFileManager::Get().Delete(*TargetPath, false, true, true);
+		return;
+	}
+	const bool bTransferred = bMove
+		? IFileManager::Get().Move(*TargetPath, *SourcePath, true, true, false, true)
+		: IFileManager::Get().Copy(*TargetPath, *SourcePath, true, true) == COPY_OK;
+	if (!bTransferred)
+	{
+		IFileManager::Get().Delete(*TargetPath, false, true, true);
+	}
+}
+
+bool UTurboStructLiteBPLibrary::ReadFieldVariantFromBytes(const TArray<uint8>& RawBytes, const FString& FieldPath, FTurboStructLiteVariant& OutVariant)
+{
+	OutVariant = FTurboStructLiteVariant();
+	TArray<FTurboStructLiteFieldMeta> Fields;
+	const uint8* DataPtr = nullptr;
+	int32 DataLen = 0;
+	FString ErrorMessage;
+	FTurboStructLiteNameTable NameTable;
+	if (!ReadMetaFromBytes(RawBytes, Fields, DataPtr, DataLen, ErrorMessage, &NameTable) || Fields.Num() == 0)
+	{
+		return false;
+	}
+	TArray<FString> Segments;
+	FieldPath.ParseIntoArray(Segments, TEXT("."), true);
+	if (Segments.Num() == 0)
+	{
+		return false;
+	}
+
+	const TArray<FTurboStructLiteFieldMeta>* CurrentFields = &Fields;
+	if (Fields.Num() == 1 && Fields[0].Children.Num() > 0)
+	{
+		CurrentFields = &Fields[0].Children;
+	}
+	int32 TotalOffset = 0;
+	const FTurboStructLiteFieldMeta* FoundMeta = nullptr;
+	for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+	{
+		const FString Segment = NormalizeMetaFieldName(Segments[SegmentIndex].TrimStartAndEnd());
+		int32 LocalOffset = 0;
+		FoundMeta = nullptr;
+		for (const FTurboStructLiteFieldMeta& Meta : *CurrentFields)
+		{
+			if (NormalizeMetaFieldName(Meta.Name).Equals(Segment, ESearchCase::IgnoreCase))
+			{
+				FoundMeta = &Meta;
+				break;
+			}
+			LocalOffset += Meta.Size;
+		}
+		if (!FoundMeta)
+		{
+			return false;
+		}
+		TotalOffset += LocalOffset;
+		if (SegmentIndex < Segments.Num() - 1)
+		{
+			if (FoundMeta->Children.Num() == 0)
+			{
+				return false;
+			}
+			CurrentFields = &FoundMeta->Children;
+		}
+	}
+	if (TotalOffset < 0 || FoundMeta->Size <= 0 || static_cast<int64>(TotalOffset) + FoundMeta->Size > DataLen)
+	{
+		return false;
+	}
+	FMemoryReader VersionSource(RawBytes, true);
+	FScopedNameTableLite NameGuard(NameTable.Names.Num() > 0 ? &NameTable : nullptr);
+	bool bReaderError = false;
+	return TryReadVariantFromMeta(*FoundMeta, DataPtr + TotalOffset, FoundMeta->Size, false, VersionSource, OutVariant, bReaderError);
+}
+
+uint32 UTurboStructLiteBPLibrary::HashIndexString(const FString& Value)
+{
+	return FCrc::StrCrc32(*Value.ToLower());
+}
+
+void UTurboStructLiteBPLibrary::SetIndexEntry(FTurboStructLiteFieldIndex& Index, int32 SubSlot, const TArray<uint8>* RawBytes)
+{
+	Index.SortedKeys.RemoveAll([SubSlot](const FTurboStructLiteIndexKey& Key) { return Key.SubSlot == SubSlot; });
+	Index.HashKeys.RemoveAll([SubSlot](const FTurboStructLiteIndexHashKey& Key) { return Key.SubSlot == SubSlot; });
+	Index.UnkeyedSubSlots.Remove(SubSlot);
+	if (RawBytes)
+	{
+		AddIndexKey(Index, SubSlot, *RawBytes, true);
+	}
+}
+
+void UTurboStructLiteBPLibrary::AddIndexKey(FTurboStructLiteFieldIndex& Index, int32 SubSlot, const TArray<uint8>& RawBytes, bool bKeepSorted)
+{
+	FTurboStructLiteVariant Variant;
+	if (!ReadFieldVariantFromBytes(RawBytes, Index.FieldPath, Variant))
+	{
+		Index.UnkeyedSubSlots.Add(SubSlot);
+		return;
+	}
+	switch (Variant.Type)
+	{
+	case ETurboStructLiteVariantType::Bool:
+	case ETurboStructLiteVariantType::Int:
+	case ETurboStructLiteVariantType::Float:
+	{
+		FTurboStructLiteIndexKey Key;
+		Key.Value = Variant.Type == ETurboStructLiteVariantType::Int ? static_cast<double>(Variant.IntValue) : Variant.FloatValue;
+		Key.SubSlot = SubSlot;
+		if (FMath::IsNaN(Key.Value))
+		{
+			Index.UnkeyedSubSlots.Add(SubSlot);
+			return;
+		}
+		const int32 InsertAt = bKeepSorted ? Algo::UpperBoundBy(Index.SortedKeys, Key.Value, &FTurboStructLiteIndexKey::Value) : Index.SortedKeys.Num();
+		Index.SortedKeys.Insert(Key, InsertAt);
+		return;
+	}
+	case ETurboStructLiteVariantType::String:
+	case ETurboStructLiteVariantType::Name:
+	{
+		FTurboStructLiteIndexHashKey Key;
+		Key.Hash = HashIndexString(Variant.StringValue);
+		Key.SubSlot = SubSlot;
+		const int32 InsertAt = bKeepSorted ? Algo::UpperBoundBy(Index.HashKeys, Key.Hash, &FTurboStructLiteIndexHashKey::Hash) : Index.HashKeys.Num();
+		Index.HashKeys.Insert(Key, InsertAt);
+		return;
+	}
+	default:
+		Index.UnkeyedSubSlots.Add(SubSlot);
+		return;
+	}
+}
+
+bool UTurboStructLiteBPLibrary::RebuildIndexes(TArray<FTurboStructLiteFieldIndex>& Indexes, const FString& SlotName, const TArray<int32>& SubSlots, const FString& EncryptionKey, ETurboStructLiteEncryption DefaultEncryption)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_RebuildIndexes"));
+	for (FTurboStructLiteFieldIndex& Index : Indexes)
+	{
+		Index.SortedKeys.Reset(SubSlots.Num());
+		Index.HashKeys.Reset();
+		Index.UnkeyedSubSlots.Reset();
+	}
+	// Subslots are loaded a batch at a time so peak memory stays bounded by the batch, not the slot.
+	TArray<int32> Batch;
+	TArray<TArray<uint8>> RawBytes;
+	TArray<bool> Results;
+	for (int32 Start = 0; Start < SubSlots.Num(); Start += TurboStructLiteIndexBuildBatchEntries)
+	{
+		const int32 Count = FMath::Min(TurboStructLiteIndexBuildBatchEntries, SubSlots.Num() - Start);
+		Batch.Reset(Count);
+		Batch.Append(SubSlots.GetData() + Start, Count);
+		RawBytes.Reset();
+		Results.Reset();
+		if (!LoadEntries(SlotName, Batch, EncryptionKey, DefaultEncryption, RawBytes, Results) || Results.Contains(false) || RawBytes.Num() != Count)
+		{
+			return false;
+		}
+		for (FTurboStructLiteFieldIndex& Index : Indexes)
+		{
+			for (int32 EntryIndex = 0; EntryIndex < Count; ++EntryIndex)
+			{
+				AddIndexKey(Index, Batch[EntryIndex], RawBytes[EntryIndex], false);
+			}
+		}
+	}
+	// Stable sorts keep equal keys in subslot order, matching what per-entry inserts produce.
+	for (FTurboStructLiteFieldIndex& Index : Indexes)
+	{
+		Index.SortedKeys.StableSort([](const FTurboStructLiteIndexKey& A, const FTurboStructLiteIndexKey& B) { return A.Value < B.Value; });
+		Index.HashKeys.StableSort([](const FTurboStructLiteIndexHashKey& A, const FTurboStructLiteIndexHashKey& B) { return A.Hash < B.Hash; });
+	}
+	return true;
+}
+
+void UTurboStructLiteBPLibrary::CollectIndexRange(const FTurboStructLiteFieldIndex& Index, double Min, double Max, TSet<int32>& OutSubSlots)
+{
+	for (int32 KeyIndex = Algo::LowerBoundBy(Index.SortedKeys, Min, &FTurboStructLiteIndexKey::Value); KeyIndex < Index.SortedKeys.Num() && Index.SortedKeys[KeyIndex].Value <= Max; ++KeyIndex)
+	{
+		OutSubSlots.Add(Index.SortedKeys[KeyIndex].SubSlot);
+	}
+	// Entries that were not keyed as numbers still go through the full predicate.
+	for (const FTurboStructLiteIndexHashKey& Key : Index.HashKeys)
+	{
+		OutSubSlots.Add(Key.SubSlot);
+	}
+	OutSubSlots.Append(Index.UnkeyedSubSlots);
+}
+
+void UTurboStructLiteBPLibrary::CollectIndexHash(const FTurboStructLiteFieldIndex& Index, uint32 Hash, TSet<int32>& OutSubSlots)
+{
+	for (int32 KeyIndex = Algo::LowerBoundBy(Index.HashKeys, Hash, &FTurboStructLiteIndexHashKey::Hash); KeyIndex < Index.HashKeys.Num() && Index.HashKeys[KeyIndex].Hash == Hash; ++KeyIndex)
+	{
+		OutSubSlots.Add(Index.HashKeys[KeyIndex].SubSlot);
+	}
+	// Entries that were not keyed as strings still go through the full predicate.
+	for (const FTurboStructLiteIndexKey& Key : Index.SortedKeys)
+	{
+		OutSubSlots.Add(Key.SubSlot);
+	}
+	OutSubSlots.Append(Index.UnkeyedSubSlots);
+}
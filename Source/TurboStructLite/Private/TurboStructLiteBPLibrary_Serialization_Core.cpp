@@ -1,5 +1,7 @@
 #include "TurboStructLiteBPLibrary.h"
 #include "TurboStructLite.h"
+#include "TurboStructLiteConstants.h"
+#include "Hash/CityHash.h"
 #include "Misc/Compression.h"
 #include "Misc/DefaultValueHelper.h"
 #include "Misc/Guid.h"
@@ -17,17 +19,17 @@
 #include "Runtime/Launch/Resources/Version.h"
 
 
-void UTurboStructLiteBPLibrary::WriteFieldMeta(FArchive& Ar, const FTurboStructLiteFieldMeta& Meta)
+void UTurboStructLiteBPLibrary::WriteFieldMeta(FArchive& Ar, const FTurboStructLiteFieldMeta& Meta, bool bWriteSizes)
 {
 	Ar << const_cast<FString&>(Meta.Name);
 	Ar << const_cast<FString&>(Meta.Type);
-	int32 SizeCopy = Meta.Size;
+	int32 SizeCopy = bWriteSizes ? Meta.Size : 0;
 	Ar << SizeCopy;
 	int32 ChildCount = Meta.Children.Num();
 	Ar << ChildCount;
 	for (const FTurboStructLiteFieldMeta& Child : Meta.Children)
 	{
-		WriteFieldMeta(Ar, Child);
+		WriteFieldMeta(Ar, Child, bWriteSizes);
 	}
 }
 
@@ -53,6 +55,106 @@ bool UTurboStructLiteBPLibrary::ReadFieldMeta(FArchive& Ar, FTurboStructLiteFiel
 	return true;
 }
 
+void UTurboStructLiteBPLibrary::CollectFieldMetaSizes(const FTurboStructLiteFieldMeta& Meta, TArray<int32>& OutSizes)
+{
+	OutSizes.Add(Meta.Size);
+	for (const FTurboStructLiteFieldMeta& Child : Meta.Children)
+	{
+		CollectFieldMetaSizes(Child, OutSizes);
+	}
+}
+
+bool UTurboStructLiteBPLibrary::ApplyFieldMetaSizes(FTurboStructLiteFieldMeta& Meta, const TArray<int32>& Sizes, int32& InOutSizeIndex)
+{
+	if (!Sizes.IsValidIndex(InOutSizeIndex))
+	{
+		return false;
+	}
+	Meta.Size = Sizes[InOutSizeIndex++];
+	for (FTurboStructLiteFieldMeta& Child : Meta.Children)
+	{
+		if (!ApplyFieldMetaSizes(Child, Sizes, InOutSizeIndex))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+TSharedPtr<const FTurboStructLiteSchema> UTurboStructLiteBPLibrary::RegisterSchema(const TArray<uint8>& SchemaBytes)
+{
+	const uint64 SchemaHash = CityHash64(reinterpret_cast<const char*>(SchemaBytes.GetData()), SchemaBytes.Num());
+	{
+		FScopeLock Lock(&SchemaCacheMutex);
+		if (const TSharedPtr<const FTurboStructLiteSchema>* Found = SchemaCache.Find(SchemaHash))
+		{
+			return *Found;
+		}
+	}
+
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_RegisterSchema"));
+	TSharedPtr<FTurboStructLiteSchema> Schema = MakeShared<FTurboStructLiteSchema>();
+	Schema->Hash = SchemaHash;
+	Schema->Bytes = SchemaBytes;
+	FMemoryReader SchemaReader(Schema->Bytes, true);
+	int32 Count = 0;
+	SchemaReader << Count;
+	if (Count < 0 || Count > SchemaBytes.Num())
+	{
+		return nullptr;
+	}
+	Schema->Fields.SetNum(Count);
+	for (FTurboStructLiteFieldMeta& Field : Schema->Fields)
+	{
+		if (!ReadFieldMeta(SchemaReader, Field) || SchemaReader.IsError())
+		{
+			return nullptr;
+		}
+	}
+	TArray<int32> Sizes;
+	for (const FTurboStructLiteFieldMeta& Field : Schema->Fields)
+	{
+		CollectFieldMetaSizes(Field, Sizes);
+	}
+	Schema->NodeCount = Sizes.Num();
+
+	FScopeLock Lock(&SchemaCacheMutex);
+	// Another thread may have parsed the same schema meanwhile; the first one stays shared.
+	if (const TSharedPtr<const FTurboStructLiteSchema>* Found = SchemaCache.Find(SchemaHash))
+	{
+		return *Found;
+	}
+	SchemaCache.Add(SchemaHash, Schema);
+	return Schema;
+}
+
+TSharedPtr<const FTurboStructLiteSchema> UTurboStructLiteBPLibrary::FindSchema(uint64 SchemaHash)
+{
+	FScopeLock Lock(&SchemaCacheMutex);
+	if (const TSharedPtr<const FTurboStructLiteSchema>* Found = SchemaCache.Find(SchemaHash))
+	{
+		return *Found;
+	}
+	return nullptr;
+}
+
+bool UTurboStructLiteBPLibrary::ReadSchemaHashFromBytes(const TArray<uint8>& InBytes, uint64& OutSchemaHash)
+{
+	OutSchemaHash = 0;
+	if (InBytes.Num() < static_cast<int32>(sizeof(int32) + sizeof(uint64)))
+	{
+		return false;
+	}
+	int32 FormatVersion = 0;
+	FMemory::Memcpy(&FormatVersion, InBytes.GetData(), sizeof(int32));
+	if ((FormatVersion & ~TurboStructLiteMetaFormatNameTableFlag) != TurboStructLiteMetaFormatSchema)
+	{
+		return false;
+	}
+	FMemory::Memcpy(&OutSchemaHash, InBytes.GetData() + sizeof(int32), sizeof(uint64));
+	return true;
+}
+
 bool UTurboStructLiteBPLibrary::BuildDebugString(const TArray<FTurboStructLiteFieldMeta>& Fields, FString& Out)
 {
 	if (Fields.Num() == 1)
@@ -285,11 +387,11 @@ bool UTurboStructLiteBPLibrary::DecompressBuffer(ETurboStructLiteCompression Met
 	return true;
 }
 
-bool UTurboStructLiteBPLibrary::SerializeWildcard(FProperty* Property, void* Address, TArray<uint8>& OutBytes, bool bSaveOnlyMarked)
+bool UTurboStructLiteBPLibrary::SerializeWildcard(FProperty* Property, void* Address, TArray<uint8>& OutBytes, bool bSaveOnlyMarked, bool bShareSchema)
 {
 	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SerializeWildcard"));
 	FString DebugMeta;
-	return SerializePropertyWithMeta(Property, Address, OutBytes, DebugMeta, bSaveOnlyMarked);
+	return SerializePropertyWithMeta(Property, Address, OutBytes, DebugMeta, bSaveOnlyMarked, bShareSchema);
 }
 
 bool UTurboStructLiteBPLibrary::DeserializeWildcard(FProperty* Property, void* Address, const TArray<uint8>& InBytes, int32 OverrideMaxThreads, bool bSaveOnlyMarked)
@@ -297,7 +399,7 @@ bool UTurboStructLiteBPLibrary::DeserializeWildcard(FProperty* Property, void* A
 	return DeserializePropertyWithMeta(Property, Address, InBytes, OverrideMaxThreads, bSaveOnlyMarked);
 }
 
-bool UTurboStructLiteBPLibrary::SerializePropertyWithMeta(FProperty* Property, void* Address, TArray<uint8>& OutBytes, FString& OutDebugMeta, bool bSaveOnlyMarked)
+bool UTurboStructLiteBPLibrary::SerializePropertyWithMeta(FProperty* Property, void* Address, TArray<uint8>& OutBytes, FString& OutDebugMeta, bool bSaveOnlyMarked, bool bShareSchema)
 {
 	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SerializePropertyWithMeta"));
 	if (!Property || !Address)
@@ -307,12 +409,18 @@ bool UTurboStructLiteBPLibrary::SerializePropertyWithMeta(FProperty* Property, v
 
 	TArray<FTurboStructLiteFieldMeta> Fields;
 	TArray<uint8> DataBuffer;
+	FTurboStructLiteNameTable NameTable;
 
 	FTurboStructLiteFieldMeta RootMeta;
-	if (SerializePropertyRecursive(Property, Address, DataBuffer, RootMeta, bSaveOnlyMarked))
 	{
-		Fields.Add(MoveTemp(RootMeta));
+		FScopedNameTableLite NameGuard(&NameTable);
+		if (SerializePropertyRecursive(Property, Address, DataBuffer, RootMeta, bSaveOnlyMarked))
+		{
+			Fields.Add(MoveTemp(RootMeta));
+		}
 	}
+	// The name table flag is only set when the value actually serialized names.
+	const int32 NameTableFlag = NameTable.Names.Num() > 0 ? TurboStructLiteMetaFormatNameTableFlag : 0;
 	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SerializeProperty_PostRecursive"));
 
 	TArray<uint8> MetaBytes;
@@ -321,7 +429,7 @@ bool UTurboStructLiteBPLibrary::SerializePropertyWithMeta(FProperty* Property, v
 	MetaWriter << Count;
 	for (const FTurboStructLiteFieldMeta& FieldMeta : Fields)
 	{
-		WriteFieldMeta(MetaWriter, FieldMeta);
+		WriteFieldMeta(MetaWriter, FieldMeta, !bShareSchema);
 	}
 
 	OutDebugMeta.Reset();
@@ -329,7 +437,38 @@ bool UTurboStructLiteBPLibrary::SerializePropertyWithMeta(FProperty* Property, v
 
 	OutBytes.Reset();
 	FMemoryWriter Writer(OutBytes, true);
-	int32 FormatVersion = 1;
+	if (bShareSchema)
+	{
+		// The shape goes to the shared schema; only the sizes that vary per value stay in the entry.
+		const TSharedPtr<const FTurboStructLiteSchema> Schema = RegisterSchema(MetaBytes);
+		if (!Schema.IsValid())
+		{
+			return false;
+		}
+		TArray<int32> Sizes;
+		Sizes.Reserve(Schema->NodeCount);
+		for (const FTurboStructLiteFieldMeta& FieldMeta : Fields)
+		{
+			CollectFieldMetaSizes(FieldMeta, Sizes);
+		}
+		int32 FormatVersion = TurboStructLiteMetaFormatSchema | NameTableFlag;
+		uint64 SchemaHash = Schema->Hash;
+		int32 SizeCount = Sizes.Num();
+		Writer << FormatVersion;
+		Writer << SchemaHash;
+		Writer << SizeCount;
+		Writer.Serialize(Sizes.GetData(), SizeCount * sizeof(int32));
+		if (NameTableFlag != 0)
+		{
+			WriteNameTable(Writer, NameTable);
+		}
+		if (DataBuffer.Num() > 0)
+		{
+			Writer.Serialize(DataBuffer.GetData(), DataBuffer.Num());
+		}
+		return true;
+	}
+	int32 FormatVersion = TurboStructLiteMetaFormatInline | NameTableFlag;
 	Writer << FormatVersion;
 	int32 MetaSize = MetaBytes.Num();
 	Writer << MetaSize;
@@ -337,6 +476,10 @@ bool UTurboStructLiteBPLibrary::SerializePropertyWithMeta(FProperty* Property, v
 	{
 		Writer.Serialize(MetaBytes.GetData(), MetaSize);
 	}
+	if (NameTableFlag != 0)
+	{
+		WriteNameTable(Writer, NameTable);
+	}
 	if (DataBuffer.Num() > 0)
 	{
 		Writer.Serialize(DataBuffer.GetData(), DataBuffer.Num());
@@ -347,44 +490,13 @@ bool UTurboStructLiteBPLibrary::SerializePropertyWithMeta(FProperty* Property, v
 bool UTurboStructLiteBPLibrary::BuildDebugMetadataFromBytes(const TArray<uint8>& InBytes, FString& OutDebugMeta)
 {
 	OutDebugMeta.Reset();
-	if (InBytes.Num() < static_cast<int32>(sizeof(int32) * 2))
-	{
-		return false;
-	}
-	FMemoryReader Reader(InBytes, true);
-	int32 FormatVersion = 0;
-	Reader << FormatVersion;
-	if (FormatVersion != 1)
-	{
-		return false;
-	}
-	int32 MetaSize = 0;
-	Reader << MetaSize;
-	if (MetaSize < 0 || Reader.TotalSize() < Reader.Tell() + MetaSize)
-	{
-		return false;
-	}
-	TArray<uint8> MetaBytes;
-	MetaBytes.SetNum(MetaSize);
-	if (MetaSize > 0)
-	{
-		Reader.Serialize(MetaBytes.GetData(), MetaSize);
-	}
-	FMemoryReader MetaReader(MetaBytes, true);
-	int32 Count = 0;
-	MetaReader << Count;
-	if (Count < 0)
-	{
-		return false;
-	}
 	TArray<FTurboStructLiteFieldMeta> Fields;
-	Fields.SetNum(Count);
-	for (int32 Index = 0; Index < Count; ++Index)
+	const uint8* DataPtr = nullptr;
+	int32 DataLen = 0;
+	FString MetaError;
+	if (!ReadMetaFromBytes(InBytes, Fields, DataPtr, DataLen, MetaError))
 	{
-		if (!ReadFieldMeta(MetaReader, Fields[Index]))
-		{
-			return false;
-		}
+		return false;
 	}
 	return BuildDebugString(Fields, OutDebugMeta);
 }
@@ -399,7 +511,24 @@ bool UTurboStructLiteBPLibrary::GetRootMetaTypeFromBytes(const TArray<uint8>& In
 	FMemoryReader Reader(InBytes, true);
 	int32 FormatVersion = 0;
 	Reader << FormatVersion;
-	if (FormatVersion != 1)
+	FormatVersion &= ~TurboStructLiteMetaFormatNameTableFlag;
+	if (FormatVersion == TurboStructLiteMetaFormatSchema)
+	{
+		// The root type lives in the shared schema, so no per-entry metadata is parsed.
+		uint64 SchemaHash = 0;
+		if (!ReadSchemaHashFromBytes(InBytes, SchemaHash))
+		{
+			return false;
+		}
+		const TSharedPtr<const FTurboStructLiteSchema> Schema = FindSchema(SchemaHash);
+		if (!Schema.IsValid() || Schema->Fields.Num() == 0)
+		{
+			return false;
+		}
+		OutType = Schema->Fields[0].Type;
+		return !OutType.IsEmpty();
+	}
+	if (FormatVersion != TurboStructLiteMetaFormatInline)
 	{
 		return false;
 	}
@@ -443,7 +572,8 @@ bool UTurboStructLiteBPLibrary::DeserializePropertyWithMeta(FProperty* Property,
 	FMemoryReader Reader(InBytes, true);
 	int32 FormatVersion = 0;
 	Reader << FormatVersion;
-	if (FormatVersion != 1)
+	FormatVersion &= ~TurboStructLiteMetaFormatNameTableFlag;
+	if (FormatVersion != TurboStructLiteMetaFormatInline && FormatVersion != TurboStructLiteMetaFormatSchema)
 	{
 		Reader.Seek(0);
 		FObjectAndNameAsStringProxyArchive Ar(Reader, true);
@@ -455,40 +585,16 @@ bool UTurboStructLiteBPLibrary::DeserializePropertyWithMeta(FProperty* Property,
 		return true;
 	}
 
-	int32 MetaSize = 0;
-	Reader << MetaSize;
-	if (MetaSize < 0 || Reader.TotalSize() < Reader.Tell() + MetaSize)
-	{
-		return false;
-	}
-
-	TArray<uint8> MetaBytes;
-	MetaBytes.SetNum(MetaSize);
-	if (MetaSize > 0)
-	{
-		Reader.Serialize(MetaBytes.GetData(), MetaSize);
-	}
-
-	const int32 DataOffset = Reader.Tell();
-	const int32 DataLen = InBytes.Num() - DataOffset;
-	const uint8* DataPtr = InBytes.GetData() + DataOffset;
-
-	FMemoryReader MetaReader(MetaBytes, true);
-	int32 Count = 0;
-	MetaReader << Count;
-	if (Count < 0)
-	{
-		return false;
-	}
 	TArray<FTurboStructLiteFieldMeta> Fields;
-	Fields.SetNum(Count);
-	for (int32 Index = 0; Index < Count; ++Index)
+	const uint8* DataPtr = nullptr;
+	int32 DataLen = 0;
+	FString MetaError;
+	FTurboStructLiteNameTable NameTable;
+	if (!ReadMetaFromBytes(InBytes, Fields, DataPtr, DataLen, MetaError, &NameTable))
 	{
-		if (!ReadFieldMeta(MetaReader, Fields[Index]))
-		{
-			return false;
-		}
+		return false;
 	}
+	FScopedNameTableLite NameGuard(NameTable.Names.Num() > 0 ? &NameTable : nullptr);
 
 	int32 Offset = 0;
 	const int32 MaxThreads = FMath::Clamp((OverrideMaxThreads > 0) ? OverrideMaxThreads : GetParallelThreadLimit(), 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
@@ -496,11 +602,15 @@ bool UTurboStructLiteBPLibrary::DeserializePropertyWithMeta(FProperty* Property,
 	{
 		uint8* StructPtr = static_cast<uint8*>(Address);
 		const FString RootPath = StructProp->Struct ? StructProp->Struct->GetName() : FString();
-		if (Fields.Num() == 1 && Fields[0].Children.Num() > 0)
+		const TArray<FTurboStructLiteFieldMeta>& RootFields = (Fields.Num() == 1 && Fields[0].Children.Num() > 0) ? Fields[0].Children : Fields;
+		uint64 SchemaHash = 0;
+		if (StructProp->Struct && StructPtr && DataPtr && FormatVersion == TurboStructLiteMetaFormatSchema && ReadSchemaHashFromBytes(InBytes, SchemaHash))
 		{
-			return ApplyMetaToStruct(Fields[0].Children, StructProp->Struct, StructPtr, DataPtr, DataLen, Offset, MaxThreads, bSaveOnlyMarked, RootPath, Reader);
+			// Shared schemas resolve names, types and redirects once per live struct and reuse the plan afterwards.
+			const TSharedPtr<const FTurboStructLiteLoadPlan> Plan = GetLoadPlan(SchemaHash, RootFields, StructProp->Struct, RootPath);
+			return ApplyLoadPlan(*Plan, RootFields, StructPtr, DataPtr, DataLen, Offset, MaxThreads, bSaveOnlyMarked, RootPath, Reader);
 		}
-		return ApplyMetaToStruct(Fields, StructProp->Struct, StructPtr, DataPtr, DataLen, Offset, MaxThreads, bSaveOnlyMarked, RootPath, Reader);
+		return ApplyMetaToStruct(RootFields, StructProp->Struct, StructPtr, DataPtr, DataLen, Offset, MaxThreads, bSaveOnlyMarked, RootPath, Reader);
 	}
 
 	if (Fields.Num() == 0)
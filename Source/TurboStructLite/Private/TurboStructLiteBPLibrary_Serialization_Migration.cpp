@@ -153,7 +153,7 @@ bool UTurboStructLiteBPLibrary::TryReadVariantFromMeta(const FTurboStructLiteFie
 		return false;
 	}
 	FMemoryReaderView ReaderView(MakeArrayView(DataPtr, DataSize));
-	FObjectAndNameAsStringProxyArchive Ar(ReaderView, true);
+	FTurboStructLiteNameArchive Ar(ReaderView, GetActiveNameTable());
 	CopyArchiveVersions(Ar, VersionSource);
 	Ar.ArIsSaveGame = bSaveOnlyMarked;
 	Ar.ArNoDelta = true;
@@ -299,16 +299,16 @@ bool UTurboStructLiteBPLibrary::TryReadVariantFromMeta(const FTurboStructLiteFie
 	}
 	if (NormalType == TEXT("fname"))
 	{
-		FString NameString;
-		Ar << NameString;
+		FName NameValue;
+		Ar << NameValue;
 		if (ReaderView.IsError())
 		{
 			bOutReaderError = true;
 			return false;
 		}
 		OutVariant.Type = ETurboStructLiteVariantType::Name;
-		OutVariant.NameValue = FName(*NameString);
-		OutVariant.StringValue = NameString;
+		OutVariant.NameValue = NameValue;
+		OutVariant.StringValue = NameValue.ToString();
 		return true;
 	}
 	if (NormalType == TEXT("ftext"))
@@ -374,12 +374,13 @@ bool UTurboStructLiteBPLibrary::TryReadVariantFromMeta(const FTurboStructLiteFie
 		if (Enum)
 		{
 			FMemoryReaderView NameReaderView(MakeArrayView(DataPtr, DataSize));
-			FObjectAndNameAsStringProxyArchive NameAr(NameReaderView, true);
+			FTurboStructLiteNameArchive NameAr(NameReaderView, GetActiveNameTable());
 			CopyArchiveVersions(NameAr, VersionSource);
 			NameAr.ArIsSaveGame = bSaveOnlyMarked;
 			NameAr.ArNoDelta = true;
-			FString EnumNameString;
-			NameAr << EnumNameString;
+			FName EnumName;
+			NameAr << EnumName;
+			const FString EnumNameString = EnumName.ToString();
 			if (!NameReaderView.IsError())
 			{
 				int64 EnumValue = INDEX_NONE;
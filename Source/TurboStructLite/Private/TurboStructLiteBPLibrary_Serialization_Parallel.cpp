@@ -19,6 +19,7 @@
 
 
 thread_local int32 GTurboStructLiteParallelThreadLimit = 2;
+thread_local FTurboStructLiteNameTable* GTurboStructLiteActiveNameTable = nullptr;
 
 FScopedParallelLimitLite::FScopedParallelLimitLite(int32 NewLimit)
 {
@@ -30,6 +31,67 @@ FScopedParallelLimitLite::~FScopedParallelLimitLite()
 	UTurboStructLiteBPLibrary::SetParallelThreadLimit(PrevLimit);
 }
 
+FScopedNameTableLite::FScopedNameTableLite(FTurboStructLiteNameTable* NewTable)
+{
+	PrevTable = UTurboStructLiteBPLibrary::SetActiveNameTable(NewTable);
+}
+
+FScopedNameTableLite::~FScopedNameTableLite()
+{
+	UTurboStructLiteBPLibrary::SetActiveNameTable(PrevTable);
+}
+
+FTurboStructLiteNameArchive::FTurboStructLiteNameArchive(FArchive& InInnerArchive, FTurboStructLiteNameTable* InNameTable)
+	: FObjectAndNameAsStringProxyArchive(InInnerArchive, true)
+	, NameTable(InNameTable)
+{
+}
+
+FArchive& FTurboStructLiteNameArchive::operator<<(FName& Value)
+{
+	if (!NameTable)
+	{
+		return FObjectAndNameAsStringProxyArchive::operator<<(Value);
+	}
+	uint32 Index = 0;
+	if (IsLoading())
+	{
+		SerializeIntPacked(Index);
+		if (InnerArchive.IsError() || !NameTable->Names.IsValidIndex(static_cast<int32>(Index)))
+		{
+			InnerArchive.SetError();
+			Value = NAME_None;
+			return *this;
+		}
+		Value = NameTable->Names[Index];
+		return *this;
+	}
+	const TPair<FNameEntryId, int32> Key(Value.GetDisplayIndex(), Value.GetNumber());
+	if (const uint32* Found = LocalIndices.Find(Key))
+	{
+		Index = *Found;
+	}
+	else
+	{
+		{
+			FScopeLock Lock(&NameTable->Mutex);
+			if (const int32* Shared = NameTable->Indices.Find(Key))
+			{
+				Index = static_cast<uint32>(*Shared);
+			}
+			else
+			{
+				const int32 NewIndex = NameTable->Names.Add(Value);
+				NameTable->Indices.Add(Key, NewIndex);
+				Index = static_cast<uint32>(NewIndex);
+			}
+		}
+		LocalIndices.Add(Key, Index);
+	}
+	SerializeIntPacked(Index);
+	return *this;
+}
+
 int32 UTurboStructLiteBPLibrary::SetParallelThreadLimit(int32 MaxThreads)
 {
 	const int32 Prev = GTurboStructLiteParallelThreadLimit;
@@ -42,6 +104,57 @@ int32 UTurboStructLiteBPLibrary::GetParallelThreadLimit()
 	return GTurboStructLiteParallelThreadLimit;
 }
 
+FTurboStructLiteNameTable* UTurboStructLiteBPLibrary::SetActiveNameTable(FTurboStructLiteNameTable* Table)
+{
+	FTurboStructLiteNameTable* Prev = GTurboStructLiteActiveNameTable;
+	GTurboStructLiteActiveNameTable = Table;
+	return Prev;
+}
+
+FTurboStructLiteNameTable* UTurboStructLiteBPLibrary::GetActiveNameTable()
+{
+	return GTurboStructLiteActiveNameTable;
+}
+
+void UTurboStructLiteBPLibrary::WriteNameTable(FArchive& Ar, const FTurboStructLiteNameTable& Table)
+{
+	int32 NameCount = Table.Names.Num();
+	Ar << NameCount;
+	for (const FName& Name : Table.Names)
+	{
+		FString NameString = Name.ToString();
+		Ar << NameString;
+	}
+}
+
+bool UTurboStructLiteBPLibrary::ReadNameTable(FArchive& Ar, FTurboStructLiteNameTable* OutTable)
+{
+	int32 NameCount = 0;
+	Ar << NameCount;
+	if (Ar.IsError() || NameCount < 0 || NameCount > Ar.TotalSize() - Ar.Tell())
+	{
+		return false;
+	}
+	if (OutTable)
+	{
+		OutTable->Names.Reset(NameCount);
+	}
+	for (int32 Index = 0; Index < NameCount; ++Index)
+	{
+		FString NameString;
+		Ar << NameString;
+		if (Ar.IsError())
+		{
+			return false;
+		}
+		if (OutTable)
+		{
+			OutTable->Names.Add(FName(*NameString));
+		}
+	}
+	return true;
+}
+
 bool UTurboStructLiteBPLibrary::IsPropertySafeForParallel(const FProperty* Property)
 {
 	if (!Property)
@@ -77,6 +190,140 @@ bool UTurboStructLiteBPLibrary::IsPropertySafeForParallel(const FProperty* Prope
 	return true;
 }
 
+bool UTurboStructLiteBPLibrary::IsRawPodElement(const FProperty* Inner)
+{
+	if (const FNumericProperty* NumericProp = CastField<FNumericProperty>(Inner))
+	{
+		// Enum bytes may be written by enumerator name.
+		return !NumericProp->IsEnum();
+	}
+	if (const FStructProperty* StructProp = CastField<FStructProperty>(Inner))
+	{
+		return StructProp->Struct && (StructProp->Struct->StructFlags & STRUCT_IsPlainOldData) != 0;
+	}
+	return false;
+}
+
+bool UTurboStructLiteBPLibrary::IsRawSerializableStruct(const UScriptStruct* Struct)
+{
+	if (!Struct || (Struct->StructFlags & STRUCT_IsPlainOldData) == 0)
+	{
+		return false;
+	}
+	// Core math types whose native serializers write their fields in declaration order.
+	static const UScriptStruct* const NativeRawStructs[] =
+	{
+		TBaseStructure<FVector>::Get(), TBaseStructure<FVector2D>::Get(), TBaseStructure<FVector4>::Get(),
+		TBaseStructure<FQuat>::Get(), TBaseStructure<FRotator>::Get(), TBaseStructure<FIntPoint>::Get(),
+		TBaseStructure<FIntVector>::Get(), TBaseStructure<FColor>::Get(), TBaseStructure<FLinearColor>::Get(),
+		TBaseStructure<FGuid>::Get()
+	};
+	for (const UScriptStruct* NativeStruct : NativeRawStructs)
+	{
+		if (Struct == NativeStruct)
+		{
+			return true;
+		}
+	}
+	// Other immutable structs are written field by field in binary; when every field is a plain number and the
+	// fields tile the struct with no padding, those bytes equal memory for every value.
+	if ((Struct->StructFlags & STRUCT_Immutable) == 0 || (Struct->StructFlags & STRUCT_SerializeNative) != 0)
+	{
+		return false;
+	}
+	int32 ExpectedOffset = 0;
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
+		const int32 ElementSize = Property->GetElementSize();
+		const int32 ArrayDim = Property->GetArrayDim();
+#else
+		const int32 ElementSize = Property->GetSize();
+		const int32 ArrayDim = Property->ArrayDim;
+#endif
+		if (ArrayDim != 1 || Property->GetOffset_ForInternal() != ExpectedOffset)
+		{
+			return false;
+		}
+		if (const FNumericProperty* NumericProp = CastField<FNumericProperty>(Property))
+		{
+			if (NumericProp->IsEnum())
+			{
+				return false;
+			}
+		}
+		else if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+		{
+			if (!IsRawSerializableStruct(StructProp->Struct))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			return false;
+		}
+		ExpectedOffset += ElementSize;
+	}
+	return ExpectedOffset > 0 && ExpectedOffset == Struct->GetStructureSize();
+}
+
+bool UTurboStructLiteBPLibrary::CanSerializeArrayRaw(FArrayProperty* ArrayProp, void* Address, bool bSaveOnlyMarked)
+{
+#if PLATFORM_LITTLE_ENDIAN
+	if (!ArrayProp || !Address || !IsRawPodElement(ArrayProp->Inner))
+	{
+		return false;
+	}
+	const FStructProperty* StructProp = CastField<FStructProperty>(ArrayProp->Inner);
+	if (!StructProp)
+	{
+		return true;
+	}
+	// SaveGame filtering drops struct members the raw block would keep.
+	if (bSaveOnlyMarked)
+	{
+		return false;
+	}
+	// Decided by the element type alone, so no element can serialize differently from the one block.
+	return IsRawSerializableStruct(StructProp->Struct);
+#else
+	return false;
+#endif
+}
+
+bool UTurboStructLiteBPLibrary::SerializeArrayRaw(FArrayProperty* ArrayProp, void* Address, TArray<uint8>& OutData, FTurboStructLiteFieldMeta& OutMeta, bool bSaveOnlyMarked)
+{
+	if (!CanSerializeArrayRaw(ArrayProp, Address, bSaveOnlyMarked))
+	{
+		return false;
+	}
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SerializeArrayRaw"));
+	FScriptArrayHelper Helper(ArrayProp, Address);
+	const int32 NumElements = Helper.Num();
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
+	const int32 ElementSize = ArrayProp->Inner->GetElementSize();
+#else
+	const int32 ElementSize = ArrayProp->Inner->GetSize();
+#endif
+	const int64 BlockSize = static_cast<int64>(NumElements) * ElementSize;
+	if (BlockSize + OutData.Num() + static_cast<int64>(sizeof(int32)) > MAX_int32)
+	{
+		return false;
+	}
+
+	// Same layout as FArrayProperty::SerializeItem (count, then elements), so every reader stays compatible.
+	const int32 StartOffset = OutData.Num();
+	OutData.Append(reinterpret_cast<const uint8*>(&NumElements), sizeof(int32));
+	if (NumElements > 0)
+	{
+		OutData.Append(Helper.GetRawPtr(0), static_cast<int32>(BlockSize));
+	}
+	OutMeta.Size = OutData.Num() - StartOffset;
+	return true;
+}
+
 bool UTurboStructLiteBPLibrary::SerializeArrayParallel(FArrayProperty* ArrayProp, void* Address, TArray<uint8>& OutData, FTurboStructLiteFieldMeta& OutMeta, bool bSaveOnlyMarked)
 {
 	FScriptArrayHelper Helper(ArrayProp, Address);
@@ -84,6 +331,10 @@ bool UTurboStructLiteBPLibrary::SerializeArrayParallel(FArrayProperty* ArrayProp
 
 	OutMeta.Name = ArrayProp->GetName();
 	OutMeta.Type = ArrayProp->GetCPPType(nullptr, 0);
+	if (SerializeArrayRaw(ArrayProp, Address, OutData, OutMeta, bSaveOnlyMarked))
+	{
+		return true;
+	}
 
 	const bool bIsComplexType = ArrayProp->Inner->IsA<FStructProperty>() || ArrayProp->Inner->IsA<FArrayProperty>() || ArrayProp->Inner->IsA<FMapProperty>() || ArrayProp->Inner->IsA<FSetProperty>();
 	const int32 ParallelThreshold = bIsComplexType ? TurboStructLiteParallelThresholdComplex : TurboStructLiteParallelThresholdSimple;
@@ -125,6 +376,7 @@ bool UTurboStructLiteBPLibrary::SerializeArrayParallel(FArrayProperty* ArrayProp
 
 	TArray<TArray<uint8>> ChunkBuffers;
 	ChunkBuffers.SetNum(NumChunks);
+	FTurboStructLiteNameTable* NameTable = GetActiveNameTable();
 
 	ParallelFor(NumChunks, [&](int32 ChunkIndex)
 	{
@@ -134,7 +386,7 @@ bool UTurboStructLiteBPLibrary::SerializeArrayParallel(FArrayProperty* ArrayProp
 		TArray<uint8>& LocalBuffer = ChunkBuffers[ChunkIndex];
 		LocalBuffer.Reserve((EndIndex - StartIndex) * ElementSize);
 		FMemoryWriter LocalWriter(LocalBuffer, true);
-		FObjectAndNameAsStringProxyArchive LocalAr(LocalWriter, true);
+		FTurboStructLiteNameArchive LocalAr(LocalWriter, NameTable);
 		LocalAr.ArIsSaveGame = bSaveOnlyMarked;
 		LocalAr.ArNoDelta = true;
 		for (int32 i = StartIndex; i < EndIndex; ++i)
@@ -164,7 +416,3 @@ bool UTurboStructLiteBPLibrary::SerializeArrayParallel(FArrayProperty* ArrayProp
 	OutMeta.Size = OutData.Num() - StartOffset;
 	return true;
 }
-
-
-
-
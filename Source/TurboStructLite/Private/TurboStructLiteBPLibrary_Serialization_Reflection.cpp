@@ -1,5 +1,6 @@
 #include "TurboStructLiteBPLibrary.h"
 #include "TurboStructLite.h"
+#include "TurboStructLiteConstants.h"
 #include "Misc/Compression.h"
 #include "Misc/DefaultValueHelper.h"
 #include "Misc/Guid.h"
@@ -120,6 +121,8 @@ bool UTurboStructLiteBPLibrary::SerializePropertyRecursive(FProperty* Property,
 
 			TArray<bool> bPropIsSplit;
 			bPropIsSplit.Init(false, NumProps);
+			TArray<bool> bPropIsRaw;
+			bPropIsRaw.Init(false, NumProps);
 
 			const int32 ArraySplitThreshold = 1;
 			const int32 ArrayChunkSize = 1;
@@ -150,6 +153,7 @@ bool UTurboStructLiteBPLibrary::SerializePropertyRecursive(FProperty* Property,
 							}
 							bSplit = true;
 							bPropIsSplit[PropIdx] = true;
+							bPropIsRaw[PropIdx] = CanSerializeArrayRaw(ArrayProp, ChildAddresses[PropIdx], bSaveOnlyMarked);
 						}
 					}
 				}
@@ -177,11 +181,13 @@ bool UTurboStructLiteBPLibrary::SerializePropertyRecursive(FProperty* Property,
 			PropOk.Init(false, NumProps);
 
 			const int32 NumActiveWorkers = FMath::Max(1, FMath::Min(MaxThreads, WorkCount));
+			FTurboStructLiteNameTable* NameTable = GetActiveNameTable();
 
 			TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SerializePropertyRecursive_HybridParallel"));
 			ParallelFor(NumActiveWorkers, [&](int32 WorkerID)
 			{
 				FScopedParallelLimitLite ThreadGuard(1);
+				FScopedNameTableLite NameGuard(NameTable);
 
 				while (true)
 				{
@@ -212,8 +218,18 @@ bool UTurboStructLiteBPLibrary::SerializePropertyRecursive(FProperty* Property,
 								continue;
 							}
 							TArray<uint8>& Buffer = TaskBuffers[TaskID];
+							if (bPropIsRaw[PropIdx])
+							{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
+								const int32 ElementSize = ArrayProp->Inner->GetElementSize();
+#else
+								const int32 ElementSize = ArrayProp->Inner->GetSize();
+#endif
+								Buffer.Append(Helper.GetRawPtr(Offset), Count * ElementSize);
+								continue;
+							}
 							FMemoryWriter Writer(Buffer, true);
-							FObjectAndNameAsStringProxyArchive Ar(Writer, true);
+							FTurboStructLiteNameArchive Ar(Writer, NameTable);
 							Ar.ArIsSaveGame = bSaveOnlyMarked;
 							Ar.ArNoDelta = true;
 							for (int32 LocalIdx = 0; LocalIdx < Count; ++LocalIdx)
@@ -364,13 +380,17 @@ bool UTurboStructLiteBPLibrary::SerializePropertyRecursive(FProperty* Property,
 	}
 	else if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
 	{
+		if (SerializeArrayRaw(ArrayProp, Address, OutData, OutMeta, bSaveOnlyMarked))
+		{
+			return true;
+		}
 		if (SerializeArrayParallel(ArrayProp, Address, OutData, OutMeta, bSaveOnlyMarked))
 		{
 			return true;
 		}
 		TArray<uint8> Local;
 		FMemoryWriter Writer(Local, true);
-		FObjectAndNameAsStringProxyArchive Ar(Writer, true);
+		FTurboStructLiteNameArchive Ar(Writer, GetActiveNameTable());
 		Ar.ArIsSaveGame = bSaveOnlyMarked;
 		Ar.ArNoDelta = true;
 		FStructuredArchiveFromArchive Structured(Ar);
@@ -387,7 +407,7 @@ bool UTurboStructLiteBPLibrary::SerializePropertyRecursive(FProperty* Property,
 
 		TArray<uint8> Local;
 		FMemoryWriter Writer(Local, true);
-		FObjectAndNameAsStringProxyArchive Ar(Writer, true);
+		FTurboStructLiteNameArchive Ar(Writer, GetActiveNameTable());
 		Ar.ArIsSaveGame = bSaveOnlyMarked;
 		Ar.ArNoDelta = true;
 		FStructuredArchiveFromArchive Structured(Ar);
@@ -407,6 +427,24 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 	{
 		return false;
 	}
+	const TSharedPtr<const TMap<FString, FString>> Redirects = GetLegacyRedirects();
+	const TSharedPtr<const FTurboStructLiteLoadPlan> Plan = BuildLoadPlan(MetaFields, Struct, PathPrefix, Redirects.Get());
+	return ApplyLoadPlan(*Plan, MetaFields, BasePtr, Data, DataLen, Offset, MaxThreads, bSaveOnlyMarked, PathPrefix, VersionSource);
+}
+
+TSharedPtr<const FTurboStructLiteLoadPlan> UTurboStructLiteBPLibrary::BuildLoadPlan(const TArray<FTurboStructLiteFieldMeta>& MetaFields, const UStruct* Struct, const FString& PathPrefix, const TMap<FString, FString>* Redirects)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_BuildLoadPlan"));
+	TSharedPtr<FTurboStructLiteLoadPlan> Plan = MakeShared<FTurboStructLiteLoadPlan>();
+	Plan->Fields.SetNum(MetaFields.Num());
+	if (!Struct)
+	{
+		return Plan;
+	}
+	Plan->Struct = Struct;
+	Plan->FirstProperty = Struct->ChildProperties;
+	Plan->PropertiesSize = Struct->GetPropertiesSize();
+
 	TArray<FProperty*> DestProps;
 	TMap<FName, FProperty*> NameToProp;
 	DestProps.Reserve(32);
@@ -427,37 +465,6 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 			}
 		}
 	}
-	TMap<FString, FString> Redirects;
-	LoadLegacyRedirects(Redirects);
-	const TMap<FString, FString>* RedirectsPtr = Redirects.Num() > 0 ? &Redirects : nullptr;
-
-	TArray<int32> MetaOffsets;
-	MetaOffsets.SetNum(MetaFields.Num());
-	int32 RunningOffset = Offset;
-	for (int32 Index = 0; Index < MetaFields.Num(); ++Index)
-	{
-		const FTurboStructLiteFieldMeta& Meta = MetaFields[Index];
-		const int64 NextOffset = static_cast<int64>(RunningOffset) + static_cast<int64>(Meta.Size);
-		if (Meta.Size < 0 || NextOffset > DataLen)
-		{
-			Offset = DataLen;
-			return false;
-		}
-		MetaOffsets[Index] = RunningOffset;
-		RunningOffset = static_cast<int32>(NextOffset);
-	}
-	const int32 FinalOffset = RunningOffset;
-
-	TArray<FTurboStructLiteLoadWorkUnit> WorkList;
-	WorkList.Reserve(MetaFields.Num() * 2);
-
-	TArray<FProperty*> ResolvedProps;
-	ResolvedProps.SetNum(MetaFields.Num());
-	TArray<bool> ResolvedTypeMatches;
-	ResolvedTypeMatches.Init(false, MetaFields.Num());
-
-	const int32 ArraySplitThreshold = 100;
-	const int32 MaxSlices = MaxThreads * 32;
 
 	for (int32 MetaIdx = 0; MetaIdx < MetaFields.Num(); ++MetaIdx)
 	{
@@ -466,23 +473,23 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 		bool bTypeMatch = false;
 		const FString MetaBaseName = NormalizeMetaFieldName(Meta.Name);
 		FString ResolvedName = MetaBaseName;
-		if (RedirectsPtr)
+		if (Redirects)
 		{
 			const FString ScopedPathBase = PathPrefix.IsEmpty() ? MetaBaseName : PathPrefix + TEXT(".") + MetaBaseName;
 			const FString ScopedPathRaw = PathPrefix.IsEmpty() ? Meta.Name : PathPrefix + TEXT(".") + Meta.Name;
-			if (const FString* Found = RedirectsPtr->Find(ScopedPathBase))
+			if (const FString* Found = Redirects->Find(ScopedPathBase))
 			{
 				ResolvedName = *Found;
 			}
-			else if (const FString* FoundRaw = RedirectsPtr->Find(ScopedPathRaw))
+			else if (const FString* FoundRaw = Redirects->Find(ScopedPathRaw))
 			{
 				ResolvedName = *FoundRaw;
 			}
-			else if (const FString* FoundGlobal = RedirectsPtr->Find(MetaBaseName))
+			else if (const FString* FoundGlobal = Redirects->Find(MetaBaseName))
 			{
 				ResolvedName = *FoundGlobal;
 			}
-			else if (const FString* FoundGlobalRaw = RedirectsPtr->Find(Meta.Name))
+			else if (const FString* FoundGlobalRaw = Redirects->Find(Meta.Name))
 			{
 				ResolvedName = *FoundGlobalRaw;
 			}
@@ -525,71 +532,159 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 			}
 		}
 
-		ResolvedProps[MetaIdx] = TargetProp;
-		ResolvedTypeMatches[MetaIdx] = TargetProp && bTypeMatch;
-
 		if (!TargetProp)
 		{
 			continue;
 		}
 
-		bool bSplitted = false;
+		FTurboStructLiteLoadPlanField& Field = Plan->Fields[MetaIdx];
+		Field.TargetProp = TargetProp;
+		Field.bTypeMatch = bTypeMatch;
 
-		if (ResolvedTypeMatches[MetaIdx])
+		if (bTypeMatch)
 		{
-			if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(TargetProp))
+			FArrayProperty* ArrayProp = CastField<FArrayProperty>(TargetProp);
+			if (ArrayProp && PLATFORM_LITTLE_ENDIAN)
 			{
-				bool bIsFixedSize = ArrayProp->Inner->HasAnyPropertyFlags(CPF_IsPlainOldData);
-				if (!bIsFixedSize)
-				{
-					if (FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner))
-					{
-						if (InnerStruct->Struct->StructFlags & STRUCT_IsPlainOldData)
-						{
-							bIsFixedSize = true;
-						}
-					}
-				}
-
-				if (bIsFixedSize && Meta.Size >= 4)
+				if (IsRawPodElement(ArrayProp->Inner))
 				{
-					int32 NumStored = 0;
-					const uint8* PropData = Data + MetaOffsets[MetaIdx];
-					checkSlow(PropData);
-					checkSlow(MetaOffsets[MetaIdx] >= 0);
-					checkSlow(MetaOffsets[MetaIdx] + static_cast<int32>(sizeof(int32)) <= DataLen);
-					FMemory::Memcpy(&NumStored, PropData, sizeof(int32));
-
+					Field.bPodArray = true;
 #if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
-					const int32 ElementSize = ArrayProp->Inner->GetElementSize();
+					Field.ElementSize = ArrayProp->Inner->GetElementSize();
 #else
-					const int32 ElementSize = ArrayProp->Inner->GetSize();
+					Field.ElementSize = ArrayProp->Inner->GetSize();
 #endif
-					const int64 ExpectedSize = static_cast<int64>(NumStored) * ElementSize + 4;
+				}
+			}
+		}
 
-					if (ExpectedSize == Meta.Size && NumStored > ArraySplitThreshold)
-					{
-						void* ArrayAddr = ArrayProp->ContainerPtrToValuePtr<void>(BasePtr);
-						FScriptArrayHelper Helper(ArrayProp, ArrayAddr);
-						Helper.Resize(NumStored);
+		if (FStructProperty* StructProp = CastField<FStructProperty>(TargetProp))
+		{
+			if (Meta.Children.Num() > 0)
+			{
+				const FString ChildPath = PathPrefix.IsEmpty() ? Meta.Name : PathPrefix + TEXT(".") + Meta.Name;
+				Field.ChildPlan = BuildLoadPlan(Meta.Children, StructProp->Struct, ChildPath, Redirects);
+			}
+		}
+	}
+	return Plan;
+}
 
-						int32 NumChunks = FMath::Clamp(NumStored / 1000, MaxThreads, MaxSlices);
-						const int32 BatchSize = FMath::Max(1, FMath::DivideAndRoundUp(NumStored, NumChunks));
+TSharedPtr<const FTurboStructLiteLoadPlan> UTurboStructLiteBPLibrary::GetLoadPlan(uint64 SchemaHash, const TArray<FTurboStructLiteFieldMeta>& MetaFields, const UStruct* Struct, const FString& PathPrefix)
+{
+	const TPair<uint64, const UStruct*> Key(SchemaHash, Struct);
+	{
+		FScopeLock Lock(&LoadPlanCacheMutex);
+		if (const TSharedPtr<const FTurboStructLiteLoadPlan>* Found = LoadPlanCache.Find(Key))
+		{
+			if (IsLoadPlanCurrent(**Found, Struct) && (*Found)->Fields.Num() == MetaFields.Num())
+			{
+				return *Found;
+			}
+		}
+	}
 
-						for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
-						{
-							FTurboStructLiteLoadWorkUnit Unit;
-							Unit.MetaIndex = MetaIdx;
-							Unit.ArrayOffset = ChunkIdx * BatchSize;
-							Unit.ArrayCount = FMath::Min(BatchSize, NumStored - Unit.ArrayOffset);
-							if (Unit.ArrayCount > 0)
-							{
-								WorkList.Add(Unit);
-							}
-						}
-						bSplitted = true;
+	const TSharedPtr<const TMap<FString, FString>> Redirects = GetLegacyRedirects();
+	const TSharedPtr<const FTurboStructLiteLoadPlan> Plan = BuildLoadPlan(MetaFields, Struct, PathPrefix, Redirects.Get());
+
+	FScopeLock Lock(&LoadPlanCacheMutex);
+	LoadPlanCache.Add(Key, Plan);
+	return Plan;
+}
+
+bool UTurboStructLiteBPLibrary::IsLoadPlanCurrent(const FTurboStructLiteLoadPlan& Plan, const UStruct* Struct)
+{
+	// The weak pointer catches a collected struct whose address was reused; the property
+	// chain and size catch a struct recompiled in place (user defined structs, hot reload).
+	return Struct
+		&& Plan.Struct.Get() == Struct
+		&& Plan.FirstProperty == Struct->ChildProperties
+		&& Plan.PropertiesSize == Struct->GetPropertiesSize();
+}
+
+void UTurboStructLiteBPLibrary::ClearLoadPlanCache()
+{
+	FScopeLock Lock(&LoadPlanCacheMutex);
+	LoadPlanCache.Empty();
+}
+
+bool UTurboStructLiteBPLibrary::ApplyLoadPlan(const FTurboStructLiteLoadPlan& Plan, const TArray<FTurboStructLiteFieldMeta>& MetaFields, uint8* BasePtr, const uint8* Data, int32 DataLen, int32& Offset, int32 MaxThreads, bool bSaveOnlyMarked, const FString& PathPrefix, const FArchive& VersionSource)
+{
+	if (!ensureMsgf(BasePtr && Data && Plan.Fields.Num() == MetaFields.Num(), TEXT("TurboStructLite ApplyLoadPlan: invalid input")))
+	{
+		Offset = DataLen;
+		return false;
+	}
+
+	TArray<int32> MetaOffsets;
+	MetaOffsets.SetNum(MetaFields.Num());
+	int32 RunningOffset = Offset;
+	for (int32 Index = 0; Index < MetaFields.Num(); ++Index)
+	{
+		const FTurboStructLiteFieldMeta& Meta = MetaFields[Index];
+		const int64 NextOffset = static_cast<int64>(RunningOffset) + static_cast<int64>(Meta.Size);
+		if (Meta.Size < 0 || NextOffset > DataLen)
+		{
+			Offset = DataLen;
+			return false;
+		}
+		MetaOffsets[Index] = RunningOffset;
+		RunningOffset = static_cast<int32>(NextOffset);
+	}
+	const int32 FinalOffset = RunningOffset;
+
+	TArray<FTurboStructLiteLoadWorkUnit> WorkList;
+	WorkList.Reserve(MetaFields.Num() * 2);
+
+	const int32 ArraySplitThreshold = 100;
+	const int32 MaxSlices = MaxThreads * 32;
+
+	for (int32 MetaIdx = 0; MetaIdx < MetaFields.Num(); ++MetaIdx)
+	{
+		const FTurboStructLiteFieldMeta& Meta = MetaFields[MetaIdx];
+		const FTurboStructLiteLoadPlanField& Field = Plan.Fields[MetaIdx];
+		if (!Field.TargetProp)
+		{
+			continue;
+		}
+
+		bool bSplitted = false;
+
+		// Only the stored element count varies per load; the POD decision was made when the plan was built.
+		if (Field.bPodArray && Meta.Size >= 4)
+		{
+			int32 NumStored = 0;
+			const uint8* PropData = Data + MetaOffsets[MetaIdx];
+			checkSlow(PropData);
+			checkSlow(MetaOffsets[MetaIdx] >= 0);
+			checkSlow(MetaOffsets[MetaIdx] + static_cast<int32>(sizeof(int32)) <= DataLen);
+			FMemory::Memcpy(&NumStored, PropData, sizeof(int32));
+
+			const int64 ExpectedSize = static_cast<int64>(NumStored) * Field.ElementSize + 4;
+
+			if (ExpectedSize == Meta.Size)
+			{
+				FArrayProperty* ArrayProp = CastFieldChecked<FArrayProperty>(Field.TargetProp);
+				void* ArrayAddr = ArrayProp->ContainerPtrToValuePtr<void>(BasePtr);
+				FScriptArrayHelper Helper(ArrayProp, ArrayAddr);
+				Helper.Resize(NumStored);
+
+				// Small blocks are still one memcpy, just not worth slicing across workers.
+				int32 NumChunks = NumStored > ArraySplitThreshold ? FMath::Clamp(NumStored / 1000, MaxThreads, MaxSlices) : 1;
+				const int32 BatchSize = FMath::Max(1, FMath::DivideAndRoundUp(NumStored, NumChunks));
+
+				for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx)
+				{
+					FTurboStructLiteLoadWorkUnit Unit;
+					Unit.MetaIndex = MetaIdx;
+					Unit.ArrayOffset = ChunkIdx * BatchSize;
+					Unit.ArrayCount = FMath::Min(BatchSize, NumStored - Unit.ArrayOffset);
+					if (Unit.ArrayCount > 0)
+					{
+						WorkList.Add(Unit);
 					}
 				}
+				bSplitted = true;
 			}
 		}
 
@@ -609,10 +704,12 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 
 	FThreadSafeCounter NextTaskIndex(0);
 	FThreadSafeBool bHasError(false);
+	FTurboStructLiteNameTable* NameTable = GetActiveNameTable();
 
 	ParallelFor(NumActiveWorkers, [&](int32 WorkerID)
 	{
 		FScopedParallelLimitLite ThreadGuard(MaxThreadsClamped);
+		FScopedNameTableLite NameGuard(NameTable);
 
 		while (true)
 		{
@@ -628,9 +725,10 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 
 			const FTurboStructLiteLoadWorkUnit& Unit = WorkList[TaskID];
 			const FTurboStructLiteFieldMeta& Meta = MetaFields[Unit.MetaIndex];
-			FProperty* TargetProp = ResolvedProps[Unit.MetaIndex];
+			const FTurboStructLiteLoadPlanField& Field = Plan.Fields[Unit.MetaIndex];
+			FProperty* TargetProp = Field.TargetProp;
 			const int32 PropOffset = MetaOffsets[Unit.MetaIndex];
-			const bool bTypeMatch = ResolvedTypeMatches[Unit.MetaIndex];
+			const bool bTypeMatch = Field.bTypeMatch;
 			if (!TargetProp)
 			{
 				continue;
@@ -643,11 +741,7 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 				FArrayProperty* ArrayProp = CastField<FArrayProperty>(TargetProp);
 				checkSlow(ArrayProp);
 				FScriptArrayHelper Helper(ArrayProp, TargetPtr);
-#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5)
-				const int32 ElementSize = ArrayProp->Inner->GetElementSize();
-#else
-				const int32 ElementSize = ArrayProp->Inner->GetSize();
-#endif
+				const int32 ElementSize = Field.ElementSize;
 
 				const uint8* SrcData = Data + PropOffset + sizeof(int32) + (Unit.ArrayOffset * ElementSize);
 				uint8* DestData = Helper.GetRawPtr(Unit.ArrayOffset);
@@ -669,7 +763,17 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 					{
 						const FString ChildPath = PathPrefix.IsEmpty() ? Meta.Name : PathPrefix + TEXT(".") + Meta.Name;
 						int32 ChildOffset = 0;
-						if (!ApplyMetaToStruct(Meta.Children, StructProp->Struct, TargetPtr, Data + PropOffset, Meta.Size, ChildOffset, MaxThreadsClamped, bSaveOnlyMarked, ChildPath, VersionSource))
+						bool bChildApplied = false;
+						if (Field.ChildPlan.IsValid() && IsLoadPlanCurrent(*Field.ChildPlan, StructProp->Struct))
+						{
+							bChildApplied = ApplyLoadPlan(*Field.ChildPlan, Meta.Children, TargetPtr, Data + PropOffset, Meta.Size, ChildOffset, MaxThreadsClamped, bSaveOnlyMarked, ChildPath, VersionSource);
+						}
+						else
+						{
+							// The nested struct changed layout after the plan was cached; resolve it again for this load.
+							bChildApplied = ApplyMetaToStruct(Meta.Children, StructProp->Struct, TargetPtr, Data + PropOffset, Meta.Size, ChildOffset, MaxThreadsClamped, bSaveOnlyMarked, ChildPath, VersionSource);
+						}
+						if (!bChildApplied)
 						{
 							bHasError = true;
 						}
@@ -718,7 +822,7 @@ bool UTurboStructLiteBPLibrary::ApplyMetaToStruct(const TArray<FTurboStructLiteF
 	return true;
 }
 
-bool UTurboStructLiteBPLibrary::ReadMetaFromBytes(const TArray<uint8>& InBytes, TArray<FTurboStructLiteFieldMeta>& OutFields, const uint8*& OutDataPtr, int32& OutDataLen, FString& OutErrorMessage)
+bool UTurboStructLiteBPLibrary::ReadMetaFromBytes(const TArray<uint8>& InBytes, TArray<FTurboStructLiteFieldMeta>& OutFields, const uint8*& OutDataPtr, int32& OutDataLen, FString& OutErrorMessage, FTurboStructLiteNameTable* OutNameTable)
 {
 	OutFields.Reset();
 	OutErrorMessage.Reset();
@@ -734,7 +838,53 @@ bool UTurboStructLiteBPLibrary::ReadMetaFromBytes(const TArray<uint8>& InBytes,
 	FMemoryReader Reader(InBytes, true);
 	int32 FormatVersion = 0;
 	Reader << FormatVersion;
-	if (FormatVersion != 1)
+	const bool bHasNameTable = (FormatVersion & TurboStructLiteMetaFormatNameTableFlag) != 0;
+	FormatVersion &= ~TurboStructLiteMetaFormatNameTableFlag;
+	if (OutNameTable)
+	{
+		OutNameTable->Names.Reset();
+	}
+	if (FormatVersion == TurboStructLiteMetaFormatSchema)
+	{
+		uint64 SchemaHash = 0;
+		int32 SizeCount = 0;
+		Reader << SchemaHash;
+		Reader << SizeCount;
+		if (Reader.IsError() || SizeCount < 0 || Reader.TotalSize() - Reader.Tell() < static_cast<int64>(SizeCount) * sizeof(int32))
+		{
+			OutErrorMessage = TEXT("IO Error: Invalid metadata size");
+			return false;
+		}
+		// The tree is parsed once per schema; each entry only carries its sizes.
+		const TSharedPtr<const FTurboStructLiteSchema> Schema = FindSchema(SchemaHash);
+		if (!Schema.IsValid() || Schema->NodeCount != SizeCount)
+		{
+			OutErrorMessage = TEXT("IO Error: Unknown metadata schema");
+			return false;
+		}
+		TArray<int32> Sizes;
+		Sizes.SetNumUninitialized(SizeCount);
+		Reader.Serialize(Sizes.GetData(), SizeCount * sizeof(int32));
+		OutFields = Schema->Fields;
+		int32 SizeIndex = 0;
+		for (FTurboStructLiteFieldMeta& Field : OutFields)
+		{
+			if (!ApplyFieldMetaSizes(Field, Sizes, SizeIndex))
+			{
+				OutErrorMessage = TEXT("IO Error: Failed to read metadata");
+				return false;
+			}
+		}
+		if (bHasNameTable && !ReadNameTable(Reader, OutNameTable))
+		{
+			OutErrorMessage = TEXT("IO Error: Failed to read name table");
+			return false;
+		}
+		OutDataPtr = InBytes.GetData() + Reader.Tell();
+		OutDataLen = InBytes.Num() - Reader.Tell();
+		return true;
+	}
+	if (FormatVersion != TurboStructLiteMetaFormatInline)
 	{
 		OutErrorMessage = TEXT("IO Error: Unsupported data format");
 		return false;
@@ -754,6 +904,11 @@ bool UTurboStructLiteBPLibrary::ReadMetaFromBytes(const TArray<uint8>& InBytes,
 	{
 		Reader.Serialize(MetaBytes.GetData(), MetaSize);
 	}
+	if (bHasNameTable && !ReadNameTable(Reader, OutNameTable))
+	{
+		OutErrorMessage = TEXT("IO Error: Failed to read name table");
+		return false;
+	}
 
 	OutDataPtr = InBytes.GetData() + Reader.Tell();
 	OutDataLen = InBytes.Num() - Reader.Tell();
@@ -860,7 +1015,7 @@ bool UTurboStructLiteBPLibrary::DeserializePropertyFromSlice(FProperty* Property
 		return false;
 	}
 	FMemoryReaderView ReaderView(MakeArrayView(DataPtr, DataSize));
-	FObjectAndNameAsStringProxyArchive Ar(ReaderView, true);
+	FTurboStructLiteNameArchive Ar(ReaderView, GetActiveNameTable());
 	CopyArchiveVersions(Ar, VersionSource);
 	Ar.ArIsSaveGame = bSaveOnlyMarked;
 	Ar.ArNoDelta = true;
@@ -2,11 +2,14 @@
 #include "TurboStructLite.h"
 
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "HAL/CriticalSection.h"
 #include "TurboStructLiteTypes.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/PlatformTime.h"
 #include "UObject/UnrealType.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "TurboStructLiteDebugMacros.h"
@@ -14,7 +17,7 @@
 FCriticalSection UTurboStructLiteBPLibrary::QueuesMutex;
 TMap<FString, TSharedPtr<FTurboStructLiteTaskQueue>> UTurboStructLiteBPLibrary::QueuesBySlot;
 FCriticalSection UTurboStructLiteBPLibrary::SlotOperationMutex;
-TMap<FString, TSharedPtr<FCriticalSection>> UTurboStructLiteBPLibrary::SlotOperationLocks;
+TMap<FString, TSharedPtr<FRWLock>> UTurboStructLiteBPLibrary::SlotOperationLocks;
 FCriticalSection UTurboStructLiteBPLibrary::ActiveSlotOpsMutex;
 TMap<FString, int32> UTurboStructLiteBPLibrary::ActiveSlotOps;
 int32 UTurboStructLiteBPLibrary::ActiveSlotOpsTotal = 0;
@@ -32,15 +35,15 @@ TSharedPtr<FTurboStructLiteTaskQueue> UTurboStructLiteBPLibrary::GetQueueForSlot
 	return NewQueue;
 }
 
-TSharedPtr<FCriticalSection> UTurboStructLiteBPLibrary::GetSlotOperationLock(const FString& SlotName)
+TSharedPtr<FRWLock> UTurboStructLiteBPLibrary::GetSlotOperationLock(const FString& SlotName)
 {
 	const FString SanitizedName = SanitizeSlotName(SlotName);
 	FScopeLock Lock(&SlotOperationMutex);
-	if (TSharedPtr<FCriticalSection>* Found = SlotOperationLocks.Find(SanitizedName))
+	if (TSharedPtr<FRWLock>* Found = SlotOperationLocks.Find(SanitizedName))
 	{
 		return *Found;
 	}
-	TSharedPtr<FCriticalSection> NewLock = MakeShared<FCriticalSection>();
+	TSharedPtr<FRWLock> NewLock = MakeShared<FRWLock>();
 	SlotOperationLocks.Add(SanitizedName, NewLock);
 	return NewLock;
 }
@@ -137,7 +140,8 @@ void UTurboStructLiteBPLibrary::ClearAllQueues()
 					}
 				}
 				Queue->PendingTasks.Reset();
-				if (!Queue->bTaskInProgress)
+				Queue->PendingSaves.Reset();
+				if (!Queue->IsBusy())
 				{
 					QueuesToRemove.Add(Pair.Key);
 				}
@@ -195,12 +199,7 @@ int32 UTurboStructLiteBPLibrary::TurboStructLiteGetPendingCount(const FString& S
 		if (Queue.IsValid())
 		{
 			FScopeLock QueueLock(&Queue->Mutex);
-			int32 Total = Queue->PendingTasks.Num();
-			if (Queue->bTaskInProgress)
-			{
-				++Total;
-			}
-			return Total;
+			return Queue->PendingTasks.Num() + Queue->ActiveReaders + (Queue->bWriterActive ? 1 : 0);
 		}
 	}
 	return 0;
@@ -232,7 +231,7 @@ bool UTurboStructLiteBPLibrary::TurboStructLiteIsSystemBusy()
 		if (Queue.IsValid())
 		{
 			FScopeLock QueueLock(&Queue->Mutex);
-			if (Queue->bTaskInProgress || Queue->PendingTasks.Num() > 0)
+			if (Queue->IsBusy() || Queue->PendingTasks.Num() > 0)
 			{
 				return true;
 			}
@@ -283,7 +282,9 @@ void UTurboStructLiteBPLibrary::TurboStructLiteClearQueues(bool bClearAll, const
 						}
 					}
 					Queue->PendingTasks = MoveTemp(Remaining);
-					if (Queue->PendingTasks.Num() == 0 && !Queue->bTaskInProgress)
+					Queue->PendingTasks.Heapify();
+					Queue->PendingSaves.Reset();
+					if (Queue->PendingTasks.Num() == 0 && !Queue->IsBusy())
 					{
 						QueuesToRemove.Add(Pair.Key);
 					}
@@ -318,6 +319,7 @@ void UTurboStructLiteBPLibrary::TurboStructLiteClearQueues(bool bClearAll, const
 							}
 						}
 						Queue->PendingTasks = MoveTemp(Remaining);
+						Queue->PendingTasks.Heapify();
 					}
 					else
 					{
@@ -330,7 +332,8 @@ void UTurboStructLiteBPLibrary::TurboStructLiteClearQueues(bool bClearAll, const
 						}
 						Queue->PendingTasks.Reset();
 					}
-					if (Queue->PendingTasks.Num() == 0 && !Queue->bTaskInProgress)
+					Queue->PendingSaves.Reset();
+					if (Queue->PendingTasks.Num() == 0 && !Queue->IsBusy())
 					{
 						QueuesToRemove.Add(SanitizedName);
 					}
@@ -345,120 +348,348 @@ void UTurboStructLiteBPLibrary::TurboStructLiteClearQueues(bool bClearAll, const
 	DispatchCancelCallbacks(MoveTemp(CancelCallbacks));
 }
 
-void UTurboStructLiteBPLibrary::EnqueueTask(const FString& SlotName, TFunction<void()> Task, int32 Priority, TFunction<void()> CancelCallback)
+void UTurboStructLiteBPLibrary::EnqueueTask(const FString& SlotName, TFunction<void()> Task, int32 Priority, TFunction<void()> CancelCallback, bool bReadOnly)
 {
 	const FString SanitizedName = SanitizeSlotName(SlotName);
 	const TSharedPtr<FTurboStructLiteTaskQueue> Queue = GetQueueForSlot(SanitizedName);
-	bool bShouldStart = false;
-	if (Queue.IsValid())
+	if (!Queue.IsValid())
+	{
+		return;
+	}
 	{
 		FScopeLock Lock(&Queue->Mutex);
-
 		FTurboStructLiteQueuedTask NewTask;
 		NewTask.Payload = MoveTemp(Task);
 		NewTask.CancelCallback = MoveTemp(CancelCallback);
 		NewTask.Priority = Priority;
+		NewTask.bReadOnly = bReadOnly;
+		PushQueuedTask(*Queue, MoveTemp(NewTask));
+		// Any other task is a barrier: later saves must not be folded into saves queued before it.
+		Queue->PendingSaves.Reset();
+	}
+	DispatchReadyTasks(SanitizedName);
+}
+
+uint64 UTurboStructLiteBPLibrary::PushQueuedTask(FTurboStructLiteTaskQueue& Queue, FTurboStructLiteQueuedTask&& Task)
+{
+	const uint64 Sequence = Queue.NextSequence++;
+	Task.Sequence = Sequence;
+	Task.EnqueueTime = FPlatformTime::Seconds();
+	Queue.PendingTasks.HeapPush(MoveTemp(Task));
+	return Sequence;
+}
+
+void UTurboStructLiteBPLibrary::DispatchReadyTasks(const FString& SlotName)
+{
+	if (!HasActiveGameWorld())
+	{
+		ClearAllQueues();
+		return;
+	}
 
-		int32 InsertIndex = Queue->PendingTasks.Num();
-		for (int32 i = 0; i < Queue->PendingTasks.Num(); ++i)
+	const TSharedPtr<FTurboStructLiteTaskQueue> Queue = GetQueueForSlot(SlotName);
+	TArray<TFunction<void()>> ReadyTasks;
+	if (Queue.IsValid())
+	{
+		FScopeLock Lock(&Queue->Mutex);
+		const double Now = FPlatformTime::Seconds();
+		// Readers share the slot; a writer waits for active readers and then runs alone.
+		while (Queue->PendingTasks.Num() > 0 && !Queue->bWriterActive)
 		{
-			if (Queue->PendingTasks[i].Priority > Priority)
+			if (!Queue->PendingTasks.HeapTop().bReadOnly && Queue->ActiveReaders > 0)
 			{
-				InsertIndex = i;
 				break;
 			}
+			FTurboStructLiteQueuedTask Next = MoveTemp(Queue->PendingTasks.HeapTop());
+			Queue->PendingTasks.HeapPopDiscard();
+			if (!Queue->IsBusy())
+			{
+				Queue->BusySince = Now;
+			}
+			if (Next.bReadOnly)
+			{
+				++Queue->ActiveReaders;
+			}
+			else
+			{
+				Queue->bWriterActive = true;
+			}
+			const double WaitSeconds = Now - Next.EnqueueTime;
+			++Queue->Stats.DispatchedTasks;
+			Queue->Stats.TotalWaitSeconds += WaitSeconds;
+			Queue->Stats.MaxWaitSeconds = FMath::Max(Queue->Stats.MaxWaitSeconds, WaitSeconds);
+			ReadyTasks.Add(MoveTemp(Next.Payload));
 		}
-		Queue->PendingTasks.Insert(MoveTemp(NewTask), InsertIndex);
+	}
+	for (TFunction<void()>& Task : ReadyTasks)
+	{
+		if (Task)
+		{
+			Task();
+		}
+	}
+}
 
-		if (!Queue->bTaskInProgress)
+void UTurboStructLiteBPLibrary::ProcessNextTask(const FString& SlotName)
+{
+	const FString SanitizedName = SanitizeSlotName(SlotName);
+	const TSharedPtr<FTurboStructLiteTaskQueue> Queue = GetQueueForSlot(SanitizedName);
+	if (Queue.IsValid())
+	{
+		// Writers never overlap readers, so the finished task is the writer whenever one is active.
+		FScopeLock Lock(&Queue->Mutex);
+		if (Queue->bWriterActive)
+		{
+			Queue->bWriterActive = false;
+		}
+		else if (Queue->ActiveReaders > 0)
 		{
-			Queue->bTaskInProgress = true;
-			bShouldStart = true;
+			--Queue->ActiveReaders;
+		}
+		if (!Queue->IsBusy() && Queue->BusySince > 0.0)
+		{
+			Queue->Stats.SlotBusySeconds += FPlatformTime::Seconds() - Queue->BusySince;
+			Queue->BusySince = 0.0;
 		}
 	}
-	if (bShouldStart)
+	DispatchReadyTasks(SanitizedName);
+}
+
+FTurboStructLiteQueueStats UTurboStructLiteBPLibrary::TurboStructLiteGetQueueStats(const FString& SlotName)
+{
+	const FString SanitizedName = SanitizeSlotName(SlotName);
+	FScopeLock GlobalLock(&QueuesMutex);
+	if (const TSharedPtr<FTurboStructLiteTaskQueue>* Found = QueuesBySlot.Find(SanitizedName))
 	{
-		ProcessNextTask(SanitizedName);
+		if (const TSharedPtr<FTurboStructLiteTaskQueue> Queue = *Found)
+		{
+			FScopeLock QueueLock(&Queue->Mutex);
+			FTurboStructLiteQueueStats Stats = Queue->Stats;
+			if (Queue->IsBusy() && Queue->BusySince > 0.0)
+			{
+				Stats.SlotBusySeconds += FPlatformTime::Seconds() - Queue->BusySince;
+			}
+			return Stats;
+		}
 	}
+	return FTurboStructLiteQueueStats();
 }
 
-void UTurboStructLiteBPLibrary::ProcessNextTask(const FString& SlotName)
+void UTurboStructLiteBPLibrary::EnqueueSaveRequest(FTurboStructLiteSaveRequest&& Request)
 {
-	if (!HasActiveGameWorld())
+	const FString SanitizedName = SanitizeSlotName(Request.SlotName);
+	const int32 SubSlotCopy = Request.SubSlotIndex;
+	const int32 Priority = FMath::Clamp(Request.QueuePriority, 0, 100);
+	const TSharedPtr<FTurboStructLiteTaskQueue> Queue = GetQueueForSlot(SanitizedName);
+	if (!Queue.IsValid())
 	{
-		ClearAllQueues();
 		return;
 	}
 
-	const TSharedPtr<FTurboStructLiteTaskQueue> Queue = GetQueueForSlot(SlotName);
-	TFunction<void()> Task;
-	if (Queue.IsValid())
+	// Back-to-back saves of the same subslot: only the latest payload is written and every caller is notified.
+	FTurboStructLiteSaveRequest Superseded;
+	bool bCoalesced = false;
 	{
 		FScopeLock Lock(&Queue->Mutex);
-		if (Queue->PendingTasks.Num() == 0)
+		if (TSharedPtr<FTurboStructLitePendingSave>* Found = Queue->PendingSaves.Find(SubSlotCopy))
 		{
-			Queue->bTaskInProgress = false;
-			return;
+			FTurboStructLitePendingSave& Pending = **Found;
+			Superseded = MoveTemp(Pending.Request);
+			Pending.SupersededCallbacks.Add(MoveTemp(Superseded.Callback));
+			Pending.Request = MoveTemp(Request);
+			++Queue->Stats.CoalescedSaves;
+			bCoalesced = true;
+		}
+	}
+	if (bCoalesced)
+	{
+		EndMemoryOpMessage(Superseded.SlotName, Superseded.SubSlotIndex, true, false);
+		if (Superseded.bUseWriteAheadLog && !Superseded.WALPath.IsEmpty())
+		{
+			WriteWALEntry(Superseded.WALPath, TEXT("Save superseded by a newer request"));
+			DeleteWALFile(Superseded.WALPath);
 		}
-		Task = MoveTemp(Queue->PendingTasks[0].Payload);
-#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
-		Queue->PendingTasks.RemoveAt(0, 1, EAllowShrinking::Yes);
-#else
-		Queue->PendingTasks.RemoveAt(0, 1, true);
-#endif
+		return;
 	}
-	if (Task)
+
+	const TSharedPtr<FTurboStructLitePendingSave> Pending = MakeShared<FTurboStructLitePendingSave>();
+	Pending->Request = MoveTemp(Request);
+
+	FTurboStructLiteQueuedTask NewTask;
+	NewTask.Priority = Priority;
+	NewTask.Payload = [Queue, Pending]()
+	{
+		TArray<FTurboStructLiteSaveRequest> Batch;
+		TakePendingSaveBatch(*Queue, Pending, true, Batch);
+		if (Batch.Num() == 1)
+		{
+			ExecuteSaveRequest(MoveTemp(Batch[0]));
+			return;
+		}
+		ExecuteSaveBatch(MoveTemp(Batch));
+	};
+	NewTask.CancelCallback = [Queue, Pending]()
 	{
-		Task();
+		TArray<FTurboStructLiteSaveRequest> Batch;
+		TakePendingSaveBatch(*Queue, Pending, false, Batch);
+		FTurboStructLiteSaveRequest& Latest = Batch[0];
+		EndMemoryOpMessage(Latest.SlotName, Latest.SubSlotIndex, true, false);
+		if (Latest.bUseWriteAheadLog && !Latest.WALPath.IsEmpty())
+		{
+			WriteWALEntry(Latest.WALPath, TEXT("Save cancelled"));
+			DeleteWALFile(Latest.WALPath);
+		}
+		if (Latest.Callback)
+		{
+			const FString FilePathCopy = BuildSavePath(Latest.SlotName);
+			Latest.Callback(false, FilePathCopy, Latest.SubSlotIndex);
+		}
+	};
+	{
+		FScopeLock Lock(&Queue->Mutex);
+		Pending->TaskSequence = PushQueuedTask(*Queue, MoveTemp(NewTask));
+		Queue->PendingSaves.Add(SubSlotCopy, Pending);
 	}
+	DispatchReadyTasks(SanitizedName);
 }
 
-void UTurboStructLiteBPLibrary::EnqueueSaveRequest(FTurboStructLiteSaveRequest&& Request)
+void UTurboStructLiteBPLibrary::TakePendingSaveBatch(FTurboStructLiteTaskQueue& Queue, const TSharedPtr<FTurboStructLitePendingSave>& Leader, bool bIncludeFollowers, TArray<FTurboStructLiteSaveRequest>& OutRequests)
 {
-	const FString SlotCopy = Request.SlotName;
-	const int32 SubSlotCopy = Request.SubSlotIndex;
-	const int32 Priority = FMath::Clamp(Request.QueuePriority, 0, 100);
-	const bool bUseWriteAheadLog = Request.bUseWriteAheadLog;
-	const FString WALPath = Request.WALPath;
-	TSharedRef<TFunction<void(bool, FString, int32)>> SharedCallback = MakeShared<TFunction<void(bool, FString, int32)>>(MoveTemp(Request.Callback));
-	Request.Callback = [SharedCallback](bool bSuccess, FString FilePath, int32 CallbackSubSlot) mutable
+	auto Claim = [&OutRequests](FTurboStructLitePendingSave& PendingSave)
 	{
-		if (*SharedCallback)
+		FTurboStructLiteSaveRequest& Claimed = OutRequests.Add_GetRef(MoveTemp(PendingSave.Request));
+		if (PendingSave.SupersededCallbacks.Num() > 0)
 		{
-			(*SharedCallback)(bSuccess, FilePath, CallbackSubSlot);
+			Claimed.Callback = [Callback = MoveTemp(Claimed.Callback), SupersededCallbacks = MoveTemp(PendingSave.SupersededCallbacks)](bool bSuccess, FString FilePath, int32 CallbackSubSlot) mutable
+			{
+				for (TFunction<void(bool, FString, int32)>& Earlier : SupersededCallbacks)
+				{
+					if (Earlier)
+					{
+						Earlier(bSuccess, FilePath, CallbackSubSlot);
+					}
+				}
+				if (Callback)
+				{
+					Callback(bSuccess, FilePath, CallbackSubSlot);
+				}
+			};
 		}
 	};
-	TFunction<void()> CancelCallback = [SharedCallback, SlotCopy, SubSlotCopy, bUseWriteAheadLog, WALPath]() mutable
+
+	FScopeLock Lock(&Queue.Mutex);
+	const int32 SubSlotIndex = Leader->Request.SubSlotIndex;
+	const TSharedPtr<FTurboStructLitePendingSave>* Found = Queue.PendingSaves.Find(SubSlotIndex);
+	const bool bLeaderPending = Found && *Found == Leader;
+	if (bLeaderPending)
 	{
-		EndMemoryOpMessage(SlotCopy, SubSlotCopy, true, false);
-		if (bUseWriteAheadLog && !WALPath.IsEmpty())
+		Queue.PendingSaves.Remove(SubSlotIndex);
+	}
+	Claim(*Leader);
+
+	// Followers are only folded in when nothing but saves is waiting, so no load, delete or query is overtaken.
+	if (!bIncludeFollowers || !bLeaderPending || Queue.PendingSaves.Num() == 0 || Queue.PendingTasks.Num() != Queue.PendingSaves.Num())
+	{
+		return;
+	}
+	const bool bAsync = OutRequests[0].bAsync;
+	TSet<uint64> ClaimedSequences;
+	for (auto It = Queue.PendingSaves.CreateIterator(); It; ++It)
+	{
+		FTurboStructLitePendingSave& Follower = *It->Value;
+		if (Follower.Request.bAsync != bAsync)
 		{
-			WriteWALEntry(WALPath, TEXT("Save cancelled"));
-			DeleteWALFile(WALPath);
+			continue;
 		}
-		if (*SharedCallback)
+		ClaimedSequences.Add(Follower.TaskSequence);
+		Claim(Follower);
+		It.RemoveCurrent();
+	}
+	if (ClaimedSequences.Num() > 0)
+	{
+		Queue.PendingTasks.RemoveAll([&ClaimedSequences](const FTurboStructLiteQueuedTask& Task)
+		{
+			return ClaimedSequences.Contains(Task.Sequence);
+		});
+		Queue.PendingTasks.Heapify();
+		Queue.Stats.BatchedSaves += ClaimedSequences.Num();
+	}
+}
+
+void UTurboStructLiteBPLibrary::ExecuteSaveBatch(TArray<FTurboStructLiteSaveRequest>&& Requests)
+{
+	const FString SlotCopy = Requests[0].SlotName;
+	if (Requests[0].bAsync)
+	{
+		Async(EAsyncExecution::ThreadPool, [SlotCopy, Requests = MoveTemp(Requests)]() mutable
+		{
+			TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveBatchAsync"));
+			TArray<bool> Results;
+			UTurboStructLiteBPLibrary::ExecuteSaveBatchWork(SlotCopy, Requests, Results);
+			AsyncTask(ENamedThreads::GameThread, [SlotCopy, Requests = MoveTemp(Requests), Results = MoveTemp(Results)]() mutable
+			{
+				UTurboStructLiteBPLibrary::FinalizeSaveBatch(SlotCopy, MoveTemp(Requests), Results);
+			});
+		});
+		return;
+	}
+
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_SaveBatchSync"));
+	TArray<bool> Results;
+	ExecuteSaveBatchWork(SlotCopy, Requests, Results);
+	FinalizeSaveBatch(SlotCopy, MoveTemp(Requests), Results);
+}
+
+bool UTurboStructLiteBPLibrary::ExecuteSaveBatchWork(const FString& SlotName, TArray<FTurboStructLiteSaveRequest>& Requests, TArray<bool>& OutResults)
+{
+	BeginSlotOperation(SlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(SlotName);
+	bool bSaved = false;
+	{
+		FWriteScopeLock Lock(*OpLock);
+		bSaved = SaveEntries(SlotName, Requests, OutResults);
+	}
+	EndSlotOperation(SlotName);
+	for (FTurboStructLiteSaveRequest& Request : Requests)
+	{
+		Request.RawBytes.Empty();
+	}
+	return bSaved;
+}
+
+void UTurboStructLiteBPLibrary::FinalizeSaveBatch(const FString& SlotName, TArray<FTurboStructLiteSaveRequest>&& Requests, const TArray<bool>& Results)
+{
+	const FString FilePathCopy = BuildSavePath(SlotName);
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+	{
+		FTurboStructLiteSaveRequest& Request = Requests[RequestIndex];
+		const bool bSaved = Results.IsValidIndex(RequestIndex) && Results[RequestIndex];
+		if (Request.bAsync)
 		{
-			const FString FilePathCopy = BuildSavePath(SlotCopy);
-			(*SharedCallback)(false, FilePathCopy, SubSlotCopy);
+			FinalizeSaveRequestAsync(Request.SlotName, Request.SubSlotIndex, bSaved, FilePathCopy, MoveTemp(Request.Callback), Request.bUseWriteAheadLog, Request.WALPath, false);
 		}
-	};
-	EnqueueTask(SlotCopy, [Request = MoveTemp(Request)]() mutable { ExecuteSaveRequest(MoveTemp(Request)); }, Priority, MoveTemp(CancelCallback));
+		else
+		{
+			FinalizeSaveRequestSync(Request.SlotName, Request.SubSlotIndex, bSaved, FilePathCopy, MoveTemp(Request.Callback), Request.bUseWriteAheadLog, Request.WALPath, false);
+		}
+	}
+	FinishQueuedSave(SlotName);
 }
 
 bool UTurboStructLiteBPLibrary::ExecuteSaveWork(const FString& SlotName, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, bool bUseWriteAheadLog, const FString& WALPath)
 {
 	BeginSlotOperation(SlotName);
-	TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(SlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(SlotName);
 	bool bSaved = false;
 	{
-		FScopeLock Lock(OpLock.Get());
+		FWriteScopeLock Lock(*OpLock);
 		bSaved = SaveEntry(SlotName, SubSlotIndex, Compression, Encryption, EncryptionKey, RawBytes, DebugMeta, MaxParallelThreads, CompressionBatching, bUseWriteAheadLog, WALPath);
 	}
 	EndSlotOperation(SlotName);
 	return bSaved;
 }
 
-void UTurboStructLiteBPLibrary::FinalizeSaveRequestAsync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath)
+void UTurboStructLiteBPLibrary::FinalizeSaveRequestAsync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath, bool bFinishQueuedSave)
 {
 	EndMemoryOpMessage(SlotName, SubSlotIndex, true, false);
 	if (!HasActiveGameWorld())
@@ -467,7 +698,10 @@ void UTurboStructLiteBPLibrary::FinalizeSaveRequestAsync(const FString& SlotName
 		{
 			DeleteWALFile(WALPath);
 		}
-		FinishQueuedSave(SlotName);
+		if (bFinishQueuedSave)
+		{
+			FinishQueuedSave(SlotName);
+		}
 		return;
 	}
 	if (bUseWriteAheadLog)
@@ -482,10 +716,13 @@ void UTurboStructLiteBPLibrary::FinalizeSaveRequestAsync(const FString& SlotName
 	{
 		Callback(bSaved, FilePath, SubSlotIndex);
 	}
-	FinishQueuedSave(SlotName);
+	if (bFinishQueuedSave)
+	{
+		FinishQueuedSave(SlotName);
+	}
 }
 
-void UTurboStructLiteBPLibrary::FinalizeSaveRequestSync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath)
+void UTurboStructLiteBPLibrary::FinalizeSaveRequestSync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath, bool bFinishQueuedSave)
 {
 	EndMemoryOpMessage(SlotName, SubSlotIndex, true, false);
 	if (!HasActiveGameWorld())
@@ -497,7 +734,10 @@ void UTurboStructLiteBPLibrary::FinalizeSaveRequestSync(const FString& SlotName,
 				DeleteWALFile(WALPath);
 			}
 		}
-		FinishQueuedSave(SlotName);
+		if (bFinishQueuedSave)
+		{
+			FinishQueuedSave(SlotName);
+		}
 		return;
 	}
 	if (Callback)
@@ -512,7 +752,10 @@ void UTurboStructLiteBPLibrary::FinalizeSaveRequestSync(const FString& SlotName,
 			DeleteWALFile(WALPath);
 		}
 	}
-	FinishQueuedSave(SlotName);
+	if (bFinishQueuedSave)
+	{
+		FinishQueuedSave(SlotName);
+	}
 }
 
 void UTurboStructLiteBPLibrary::ExecuteSaveAsync(TArray<uint8>&& RawBytes, const FString& SlotName, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath)
@@ -594,7 +837,7 @@ void UTurboStructLiteBPLibrary::EnqueueLoadRequest(FTurboStructLiteLoadRequest&&
 			(*SharedCallback)(false);
 		}
 	};
-	EnqueueTask(SlotCopy, [Request = MoveTemp(Request)]() mutable { ExecuteLoadRequest(MoveTemp(Request)); }, Priority, MoveTemp(CancelCallback));
+	EnqueueTask(SlotCopy, [Request = MoveTemp(Request)]() mutable { ExecuteLoadRequest(MoveTemp(Request)); }, Priority, MoveTemp(CancelCallback), true);
 }
 
 void UTurboStructLiteBPLibrary::ExecuteLoadRequest(FTurboStructLiteLoadRequest&& Request)
@@ -631,9 +874,9 @@ void UTurboStructLiteBPLibrary::ExecuteLoadRequest(FTurboStructLiteLoadRequest&&
 					UpdateMemoryPressureWarning(SlotCopy, SubSlotCopy, ExpectedBytes, false, false);
 				}
 				BeginSlotOperation(SlotCopy);
-				TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(SlotCopy);
+				TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(SlotCopy);
 				{
-					FScopeLock Lock(OpLock.Get());
+					FReadScopeLock Lock(*OpLock);
 					bLoaded = UTurboStructLiteBPLibrary::LoadEntry(SlotCopy, SubSlotCopy, EncryptionKey, DefaultEncryption, RawBytes, bUseWriteAheadLog, WALPath);
 				}
 				EndSlotOperation(SlotCopy);
@@ -815,9 +1058,9 @@ void UTurboStructLiteBPLibrary::ExecuteLoadRequest(FTurboStructLiteLoadRequest&&
 			UpdateMemoryPressureWarning(Request.SlotName, Request.SubSlotIndex, ExpectedBytes, false, false);
 		}
 		BeginSlotOperation(Request.SlotName);
-		TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(Request.SlotName);
+		TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(Request.SlotName);
 		{
-			FScopeLock Lock(OpLock.Get());
+			FReadScopeLock Lock(*OpLock);
 			bLoadedSync = UTurboStructLiteBPLibrary::LoadEntry(Request.SlotName, Request.SubSlotIndex, EncryptionKeyCopy, DefaultEncryptionCopy, RawBytes, bUseWriteAheadLog, WALPath);
 		}
 		EndSlotOperation(Request.SlotName);
@@ -881,5 +1124,195 @@ void UTurboStructLiteBPLibrary::FinishQueuedLoad(const FString& SlotName)
 	ProcessNextTask(SlotName);
 }
 
+void UTurboStructLiteBPLibrary::CompleteBatchProgress(FTurboStructLiteBatchProgress& Progress)
+{
+	if (Progress.OnComplete)
+	{
+		Progress.OnComplete(!Progress.Results.Contains(false), Progress.Results);
+	}
+}
+
+void UTurboStructLiteBPLibrary::EnqueueSaveBatchRequest(TArray<FTurboStructLiteSaveRequest>&& Requests, int32 Priority)
+{
+	const FString SlotCopy = Requests[0].SlotName;
+	TSharedRef<TArray<FTurboStructLiteSaveRequest>> SharedRequests = MakeShared<TArray<FTurboStructLiteSaveRequest>>(MoveTemp(Requests));
+	TFunction<void()> CancelCallback = [SharedRequests]()
+	{
+		for (FTurboStructLiteSaveRequest& Request : *SharedRequests)
+		{
+			EndMemoryOpMessage(Request.SlotName, Request.SubSlotIndex, true, false);
+			if (Request.bUseWriteAheadLog && !Request.WALPath.IsEmpty())
+			{
+				WriteWALEntry(Request.WALPath, TEXT("Save cancelled"));
+				DeleteWALFile(Request.WALPath);
+			}
+			if (Request.Callback)
+			{
+				Request.Callback(false, BuildSavePath(Request.SlotName), Request.SubSlotIndex);
+			}
+		}
+	};
+	EnqueueTask(SlotCopy, [SharedRequests]() { ExecuteSaveBatch(MoveTemp(*SharedRequests)); }, FMath::Clamp(Priority, 0, 100), MoveTemp(CancelCallback));
+}
+
+void UTurboStructLiteBPLibrary::EnqueueLoadBatchRequest(FTurboStructLiteLoadBatchRequest&& Request)
+{
+	const FString SlotCopy = Request.SlotName;
+	const int32 Priority = FMath::Clamp(Request.QueuePriority, 0, 100);
+	TSharedRef<FTurboStructLiteLoadBatchRequest> SharedRequest = MakeShared<FTurboStructLiteLoadBatchRequest>(MoveTemp(Request));
+	TFunction<void()> CancelCallback = [SharedRequest]()
+	{
+		for (const int32 SubSlotIndex : SharedRequest->SubSlotIndices)
+		{
+			EndMemoryOpMessage(SharedRequest->SlotName, SubSlotIndex, false, false);
+		}
+		if (SharedRequest->bUseWriteAheadLog && !SharedRequest->WALPath.IsEmpty())
+		{
+			WriteWALEntry(SharedRequest->WALPath, TEXT("Load cancelled"));
+			DeleteWALFile(SharedRequest->WALPath);
+		}
+		if (SharedRequest->Callback)
+		{
+			TArray<bool> Results;
+			Results.Init(false, SharedRequest->SubSlotIndices.Num());
+			SharedRequest->Callback(false, Results);
+		}
+	};
+	EnqueueTask(SlotCopy, [SharedRequest]() { ExecuteLoadBatchRequest(MoveTemp(*SharedRequest)); }, Priority, MoveTemp(CancelCallback), true);
+}
+
+void UTurboStructLiteBPLibrary::ExecuteLoadBatchWork(const FTurboStructLiteLoadBatchRequest& Request, TArray<TArray<uint8>>& OutRawBytes, TArray<bool>& OutResults)
+{
+	if (Request.bUseWriteAheadLog)
+	{
+		WriteWALEntry(Request.WALPath, FString::Printf(TEXT("Start LoadEntries Slot=%s Count=%d"), *Request.SlotName, Request.SubSlotIndices.Num()));
+	}
+	BeginSlotOperation(Request.SlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(Request.SlotName);
+	{
+		FReadScopeLock Lock(*OpLock);
+		LoadEntries(Request.SlotName, Request.SubSlotIndices, Request.EncryptionKey, Request.DefaultEncryption, OutRawBytes, OutResults);
+	}
+	EndSlotOperation(Request.SlotName);
+	if (Request.bUseWriteAheadLog)
+	{
+		int32 LoadedCount = 0;
+		for (const bool bLoaded : OutResults)
+		{
+			LoadedCount += bLoaded ? 1 : 0;
+		}
+		WriteWALEntry(Request.WALPath, FString::Printf(TEXT("LoadEntries read %d of %d"), LoadedCount, OutResults.Num()));
+	}
+}
+
+void UTurboStructLiteBPLibrary::DeserializeBatchElements(FArrayProperty* ValuesProp, void* ValuesPtr, const TArray<TArray<uint8>>& RawBytes, TArray<bool>& InOutResults, int32 MaxThreads, bool bParallel)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_DeserializeBatch"));
+	FScriptArrayHelper Helper(ValuesProp, ValuesPtr);
+	Helper.EmptyValues(RawBytes.Num());
+	Helper.AddValues(RawBytes.Num());
+	FProperty* Inner = ValuesProp->Inner;
+	// Elements with object references stay on the calling thread; everything else is decoded one element per worker.
+	ParallelFor(RawBytes.Num(), [&](int32 EntryIndex)
+	{
+		if (InOutResults[EntryIndex])
+		{
+			InOutResults[EntryIndex] = DeserializeWildcard(Inner, Helper.GetRawPtr(EntryIndex), RawBytes[EntryIndex], bParallel ? 1 : MaxThreads);
+		}
+	}, bParallel ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+}
+
+void UTurboStructLiteBPLibrary::ExecuteLoadBatchRequest(FTurboStructLiteLoadBatchRequest&& Request)
+{
+	const int32 MaxThreads = FMath::Clamp(Request.MaxParallelThreads, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	TArray<const FStructProperty*> DummyStructProps;
+	const bool bCanBackgroundDeserialize = Request.ValuesProp && !Request.ValuesProp->Inner->ContainsObjectReference(DummyStructProps, EPropertyObjectReferenceType::Strong);
 
+	if (!Request.bAsync)
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadBatchSync"));
+		TArray<TArray<uint8>> RawBytes;
+		TArray<bool> Results;
+		{
+			FScopedParallelLimitLite ThreadGuard(MaxThreads);
+			ExecuteLoadBatchWork(Request, RawBytes, Results);
+		}
+		if (Request.ValuesProp && Request.ValuesPtr)
+		{
+			DeserializeBatchElements(Request.ValuesProp, Request.ValuesPtr, RawBytes, Results, MaxThreads, bCanBackgroundDeserialize);
+		}
+		FinalizeLoadBatch(MoveTemp(Request), Results);
+		return;
+	}
 
+	Async(EAsyncExecution::ThreadPool, [Request = MoveTemp(Request), MaxThreads, bCanBackgroundDeserialize]() mutable
+	{
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadBatchAsync"));
+		TArray<TArray<uint8>> RawBytes;
+		TArray<bool> Results;
+		{
+			FScopedParallelLimitLite ThreadGuard(MaxThreads);
+			ExecuteLoadBatchWork(Request, RawBytes, Results);
+		}
+		// Background-safe elements are decoded into a detached array that is swapped in on the game thread.
+		TArray<uint8> Snapshot;
+		if (bCanBackgroundDeserialize)
+		{
+			Snapshot.SetNumUninitialized(Request.ValuesProp->GetSize());
+			Request.ValuesProp->InitializeValue(Snapshot.GetData());
+			DeserializeBatchElements(Request.ValuesProp, Snapshot.GetData(), RawBytes, Results, MaxThreads, true);
+			RawBytes.Empty();
+		}
+		AsyncTask(ENamedThreads::GameThread, [Request = MoveTemp(Request), RawBytes = MoveTemp(RawBytes), Results = MoveTemp(Results), Snapshot = MoveTemp(Snapshot), MaxThreads]() mutable
+		{
+			if (HasActiveGameWorld() && Request.ValuesProp && Request.ValuesPtr)
+			{
+				if (Snapshot.Num() > 0)
+				{
+					TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_InstantSwap"));
+					FMemory::Memswap(Request.ValuesPtr, Snapshot.GetData(), sizeof(FScriptArray));
+				}
+				else
+				{
+					DeserializeBatchElements(Request.ValuesProp, Request.ValuesPtr, RawBytes, Results, MaxThreads, false);
+				}
+			}
+			if (Snapshot.Num() > 0)
+			{
+				Request.ValuesProp->DestroyValue(Snapshot.GetData());
+			}
+			FinalizeLoadBatch(MoveTemp(Request), Results);
+		});
+	});
+}
+
+void UTurboStructLiteBPLibrary::FinalizeLoadBatch(FTurboStructLiteLoadBatchRequest&& Request, const TArray<bool>& Results)
+{
+	for (const int32 SubSlotIndex : Request.SubSlotIndices)
+	{
+		EndMemoryOpMessage(Request.SlotName, SubSlotIndex, false, false);
+	}
+	const bool bAllLoaded = !Results.Contains(false);
+	if (!HasActiveGameWorld())
+	{
+		if (Request.bUseWriteAheadLog)
+		{
+			DeleteWALFile(Request.WALPath);
+		}
+		FinishQueuedLoad(Request.SlotName);
+		return;
+	}
+	if (Request.bUseWriteAheadLog)
+	{
+		WriteWALEntry(Request.WALPath, bAllLoaded ? TEXT("Load batch completed") : TEXT("Load batch finished with failures"));
+		if (bAllLoaded)
+		{
+			DeleteWALFile(Request.WALPath);
+		}
+	}
+	if (Request.Callback)
+	{
+		Request.Callback(bAllLoaded, Results);
+	}
+	FinishQueuedLoad(Request.SlotName);
+}
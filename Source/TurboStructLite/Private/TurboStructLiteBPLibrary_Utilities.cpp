@@ -3,6 +3,7 @@
 #include "Async/ParallelFor.h"
 #include "Misc/Paths.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
 #include "Misc/ConfigCacheIni.h"
 #include "HAL/CriticalSection.h"
 #include "UObject/Stack.h"
@@ -61,10 +62,10 @@ bool UTurboStructLiteBPLibrary::TurboStructLiteLoadSubSlotBytes(const FString& M
 		}
 	}
 	BeginSlotOperation(MainSlotName);
-	TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(MainSlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(MainSlotName);
 	bool bLoaded = false;
 	{
-		FScopeLock Lock(OpLock.Get());
+		FReadScopeLock Lock(*OpLock);
 		bLoaded = LoadEntry(MainSlotName, SubSlotIndex, KeyToUse, ResolvedEncryption, OutBytes);
 	}
 	EndSlotOperation(MainSlotName);
@@ -90,10 +91,10 @@ bool UTurboStructLiteBPLibrary::TurboStructLiteSaveSubSlotBytes(const FString& M
 		}
 	}
 	BeginSlotOperation(MainSlotName);
-	TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(MainSlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(MainSlotName);
 	bool bSaved = false;
 	{
-		FScopeLock Lock(OpLock.Get());
+		FWriteScopeLock Lock(*OpLock);
 		bSaved = SaveEntry(MainSlotName, SubSlotIndex, ResolvedCompression, ResolvedEncryption, KeyToUse, RawBytes, DebugMetadata, GetParallelThreadLimit(), ETurboStructLiteBatchingSetting::ProjectDefault);
 	}
 	EndSlotOperation(MainSlotName);
@@ -107,10 +108,10 @@ bool UTurboStructLiteBPLibrary::TurboStructLiteRemoveSubSlotImmediate(const FStr
 		return false;
 	}
 	BeginSlotOperation(MainSlotName);
-	TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(MainSlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(MainSlotName);
 	bool bRemoved = false;
 	{
-		FScopeLock Lock(OpLock.Get());
+		FWriteScopeLock Lock(*OpLock);
 		bRemoved = RemoveEntry(MainSlotName, SubSlotIndex);
 	}
 	EndSlotOperation(MainSlotName);
@@ -125,10 +126,10 @@ bool UTurboStructLiteBPLibrary::TurboStructLiteGetSubSlotInfoWithKey(const FStri
 		return false;
 	}
 	BeginSlotOperation(MainSlotName);
-	TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(MainSlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(MainSlotName);
 	bool bRead = false;
 	{
-		FScopeLock Lock(OpLock.Get());
+		FReadScopeLock Lock(*OpLock);
 		bRead = ReadSubSlotInfoInternal(MainSlotName, SubSlotIndex, EncryptionKey, Encryption, OutInfo);
 	}
 	EndSlotOperation(MainSlotName);
@@ -143,10 +144,10 @@ ETurboStructLiteSlotQueryStatus UTurboStructLiteBPLibrary::QuerySubSlotIndices(c
 		return ETurboStructLiteSlotQueryStatus::SlotInvalid;
 	}
 	BeginSlotOperation(SlotName);
-	TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(SlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(SlotName);
 	ETurboStructLiteSlotQueryStatus Status = ETurboStructLiteSlotQueryStatus::SlotInvalid;
 	{
-		FScopeLock Lock(OpLock.Get());
+		FReadScopeLock Lock(*OpLock);
 		const FString FilePath = BuildSavePath(SlotName);
 		if (!FPaths::FileExists(FilePath))
 		{
@@ -173,10 +174,10 @@ ETurboStructLiteSlotQueryStatus UTurboStructLiteBPLibrary::QuerySubSlotInfos(con
 		return ETurboStructLiteSlotQueryStatus::SlotInvalid;
 	}
 	BeginSlotOperation(SlotName);
-	TSharedPtr<FCriticalSection> OpLock = GetSlotOperationLock(SlotName);
+	TSharedPtr<FRWLock> OpLock = GetSlotOperationLock(SlotName);
 	ETurboStructLiteSlotQueryStatus Status = ETurboStructLiteSlotQueryStatus::SlotInvalid;
 	{
-		FScopeLock Lock(OpLock.Get());
+		FReadScopeLock Lock(*OpLock);
 		const FString FilePath = BuildSavePath(SlotName);
 		if (!FPaths::FileExists(FilePath))
 		{
@@ -18,6 +18,7 @@
 
 #include "CoreMinimal.h"
 #include "LatentActions.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "TurboStructLiteTypes.h"
 #include "TurboStructLiteBPLibrary.generated.h"
@@ -26,6 +27,7 @@ class STurboStructLiteDatabaseWidget;
 class FTurboStructLiteDatabaseParser;
 enum class EAsyncExecution;
 class IConsoleVariable;
+class IFileHandle;
 class UTurboStructLiteQueryLibrary;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTurboStructLite, Log, All);
@@ -35,6 +37,7 @@ DECLARE_DYNAMIC_DELEGATE_ThreeParams(FTurboStructLiteSaveComplete, bool, bSucces
 DECLARE_DYNAMIC_DELEGATE_OneParam(FTurboStructLiteLoadComplete, bool, bSuccess);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FTurboStructLiteDeleteComplete, bool, bSuccess);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FTurboStructLiteExistComplete, bool, bSuccess);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FTurboStructLiteBatchComplete, bool, bAllSucceeded, const TArray<bool>&, EntryResults);
 DECLARE_DYNAMIC_DELEGATE_RetVal(FString, FTurboStructLiteKeyProviderDelegate);
 
 // Category: Serialization.
@@ -54,6 +57,41 @@ private:
 	int32 PrevLimit;
 };
 
+// Category: Serialization.
+// Scoped helper to set and restore the thread-local name table used by entry (de)serialization.
+class TURBOSTRUCTLITE_API FScopedNameTableLite
+{
+public:
+	// Category: Serialization.
+	explicit FScopedNameTableLite(FTurboStructLiteNameTable* NewTable);
+	// Category: Serialization.
+	~FScopedNameTableLite();
+
+	FScopedNameTableLite(const FScopedNameTableLite&) = delete;
+	FScopedNameTableLite& operator=(const FScopedNameTableLite&) = delete;
+
+private:
+	FTurboStructLiteNameTable* PrevTable;
+};
+
+// Category: Serialization.
+// Proxy archive that writes FNames as varint indices into an entry name table; without a table it behaves like its base.
+class TURBOSTRUCTLITE_API FTurboStructLiteNameArchive : public FObjectAndNameAsStringProxyArchive
+{
+public:
+	// Category: Serialization.
+	FTurboStructLiteNameArchive(FArchive& InInnerArchive, FTurboStructLiteNameTable* InNameTable);
+
+	using FObjectAndNameAsStringProxyArchive::operator<<;
+	// Category: Serialization.
+	virtual FArchive& operator<<(FName& Value) override;
+
+private:
+	FTurboStructLiteNameTable* NameTable;
+	// Indices already resolved by this archive, so the shared table is locked once per distinct name.
+	TMap<TPair<FNameEntryId, int32>, uint32> LocalIndices;
+};
+
 UCLASS()
 class TURBOSTRUCTLITE_API UTurboStructLiteBPLibrary : public UBlueprintFunctionLibrary
 {
@@ -61,6 +99,16 @@ class TURBOSTRUCTLITE_API UTurboStructLiteBPLibrary : public UBlueprintFunctionL
 
 	friend class UTurboStructLiteQueryLibrary;
 	friend class FScopedParallelLimitLite;
+	friend class FScopedNameTableLite;
+	friend class FTurboStructLiteModule;
+	friend class UTurboStructLiteProjectSettings;
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FTurboStructLiteAesGcmTest;
+	friend class FTurboStructLiteAesGcmPerfTest;
+	friend class FTurboStructLiteZoneMapEncryptionTest;
+	friend class FTurboStructLiteRawArrayEligibilityTest;
+	friend class FTurboStructLiteSecondaryIndexQueryTest;
+#endif
 
 public:
 	// Save wildcard struct data into a slot/subslot.
@@ -79,6 +127,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "TurboStructLite Basic Operations", meta = (AdvancedDisplay = "QueuePriority"))
 	static void TurboStructExistLite(const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, bool bCheckFileOnly, const FTurboStructLiteExistComplete& OnComplete, int32 QueuePriority = 10);
 
+	// Save each element of a wildcard array into the matching subslot with one queued write.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "TurboStructLite Basic Operations", meta = (ArrayParm = "Values", AutoCreateRefTerm = "SubSlotIndices,bUseWriteAheadLog,bSaveOnlyMarked,OnComplete,QueuePriority,MaxParallelThreads,EncryptionKey,CompressionBatching,Compression", AdvancedDisplay = "bUseWriteAheadLog,bSaveOnlyMarked,QueuePriority,MaxParallelThreads,EncryptionKey,Encryption,Compression,CompressionBatching"))
+	static void TurboStructSaveLiteBatch(const FString& MainSlotName, const TArray<int32>& SubSlotIndices, bool bAsync, const TArray<int32>& Values, const FTurboStructLiteBatchComplete& OnComplete, bool bUseWriteAheadLog = false, bool bSaveOnlyMarked = false, int32 QueuePriority = 10, int32 MaxParallelThreads = 4, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault, ETurboStructLiteCompression Compression = ETurboStructLiteCompression::ProjectDefault, ETurboStructLiteBatchingSetting CompressionBatching = ETurboStructLiteBatchingSetting::ProjectDefault);
+
+	// Load several subslots into a wildcard array (one element per subslot, in order) with one queued read.
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "TurboStructLite Basic Operations", meta = (ArrayParm = "Values", AutoCreateRefTerm = "SubSlotIndices,bUseWriteAheadLog,OnComplete,QueuePriority,MaxParallelThreads,EncryptionKey", AdvancedDisplay = "bUseWriteAheadLog,QueuePriority,MaxParallelThreads,EncryptionKey,Encryption"))
+	static void TurboStructLoadLiteBatch(const FString& MainSlotName, const TArray<int32>& SubSlotIndices, bool bAsync, const TArray<int32>& Values, const FTurboStructLiteBatchComplete& OnComplete, bool bUseWriteAheadLog = false, int32 QueuePriority = 10, int32 MaxParallelThreads = 4, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault);
+
+	// Build (or rebuild) a secondary index on a dotted field path so logic queries over the slot can skip non-matching subslots. Not available on AES slots.
+	UFUNCTION(BlueprintCallable, Category = "TurboStructLite Logic Query", meta = (AutoCreateRefTerm = "EncryptionKey", AdvancedDisplay = "EncryptionKey,Encryption"))
+	static bool TurboStructLiteCreateIndex(const FString& MainSlotName, const FString& FieldPath, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault);
+
+	// Remove a slot's secondary index on a field path.
+	UFUNCTION(BlueprintCallable, Category = "TurboStructLite Logic Query")
+	static bool TurboStructLiteDropIndex(const FString& MainSlotName, const FString& FieldPath);
+
+	// List the field paths a slot has secondary indexes on.
+	UFUNCTION(BlueprintCallable, Category = "TurboStructLite Logic Query")
+	static TArray<FString> TurboStructLiteGetIndexedFields(const FString& MainSlotName);
+
+	// Snapshot a slot queue's counters: dispatched, coalesced and batched tasks, queue wait times and slot busy time.
+	UFUNCTION(BlueprintCallable, Category = "TurboStructLite Utilities")
+	static FTurboStructLiteQueueStats TurboStructLiteGetQueueStats(const FString& SlotName);
+
+	// C++ entry point for batch saves: ValuesProp/ValuesPtr describe a TArray whose elements map to SubSlotIndices.
+	static void HandleWildcardSaveBatch(FArrayProperty* ValuesProp, void* ValuesPtr, const FString& MainSlotName, const TArray<int32>& SubSlotIndices, bool bAsync, TFunction<void(bool, const TArray<bool>&)> OnComplete, bool bUseWriteAheadLog = false, bool bSaveOnlyMarked = false, int32 QueuePriority = 10, int32 MaxParallelThreads = 4, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault, ETurboStructLiteCompression Compression = ETurboStructLiteCompression::ProjectDefault, ETurboStructLiteBatchingSetting CompressionBatching = ETurboStructLiteBatchingSetting::ProjectDefault, UObject* OwnerObject = nullptr);
+
+	// C++ entry point for batch loads: the target array is resized to SubSlotIndices.Num(); failed entries keep default values.
+	static void HandleWildcardLoadBatch(FArrayProperty* ValuesProp, void* ValuesPtr, const FString& MainSlotName, const TArray<int32>& SubSlotIndices, bool bAsync, TFunction<void(bool, const TArray<bool>&)> OnComplete, bool bUseWriteAheadLog = false, int32 QueuePriority = 10, int32 MaxParallelThreads = 4, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault);
+
 private:
 	// === Custom thunks ===
 	// Thunk to save wildcard data.
@@ -97,6 +175,10 @@ private:
 	DECLARE_FUNCTION(execTurboStructSaveLiteSet);
 	// Thunk to load wildcard sets.
 	DECLARE_FUNCTION(execTurboStructLoadLiteSet);
+	// Thunk to save wildcard array elements into several subslots.
+	DECLARE_FUNCTION(execTurboStructSaveLiteBatch);
+	// Thunk to load several subslots into a wildcard array.
+	DECLARE_FUNCTION(execTurboStructLoadLiteBatch);
 
 	// Category: Utilities.
 	static int32 TurboStructLiteGetPendingCount(const FString& SlotName);
@@ -132,7 +214,15 @@ private:
 	static void RegisterEncryptionKeyProvider(FTurboStructLiteKeyProviderDelegate NewProvider);
 
 	// Category: Basic Operations.
-	static void HandleWildcardSave(FProperty* DataProp, void* DataPtr, const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FTurboStructLiteSaveComplete& SaveDelegate, bool bUseWriteAheadLog, bool bSaveOnlyMarked, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption, ETurboStructLiteCompression Compression, ETurboStructLiteBatchingSetting CompressionBatching, const TCHAR* OperationName, const TCHAR* WildcardLabelLower, const TCHAR* WildcardLabelUpper, const TCHAR* SaveLabel, bool bEmitDebugPropInfo);
+	static void HandleWildcardSave(FProperty* DataProp, void* DataPtr, const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FTurboStructLiteSaveComplete& SaveDelegate, bool bUseWriteAheadLog, bool bSaveOnlyMarked, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption, ETurboStructLiteCompression Compression, ETurboStructLiteBatchingSetting CompressionBatching, const TCHAR* OperationName, const TCHAR* WildcardLabelLower, const TCHAR* WildcardLabelUpper, const TCHAR* SaveLabel, bool bEmitDebugPropInfo, UObject* OwnerObject = nullptr);
+	// Category: Basic Operations.
+	static bool IsValueOwnedByObject(const FProperty* Property, const void* ValuePtr, const UObject* OwnerObject);
+	// Category: Basic Operations.
+	static void CaptureArraySnapshotTimeSliced(FArrayProperty* ArrayProp, void* DataPtr, TWeakObjectPtr<UObject> Owner, float BudgetMs, TFunction<void(bool, TArray<uint8>&&)> OnCaptured);
+	// Category: Basic Operations.
+	static bool IsValidBatchSubSlots(const FString& MainSlotName, const TArray<int32>& SubSlotIndices);
+	// Category: Basic Operations.
+	static TArray<FTurboStructLiteSaveRequest> BuildSaveBatchRequests(FArrayProperty* ValuesProp, void* ValuesPtr, const TArray<int32>& SubSlotIndices, const TArray<FString>& WALPaths, const FTurboStructLiteSaveRequest& Template, const TSharedRef<FTurboStructLiteBatchProgress>& Progress);
 	// Category: Basic Operations.
 	static void HandleWildcardLoad(FProperty* DataProp, void* DataPtr, const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FTurboStructLiteLoadComplete& LoadDelegate, bool bUseWriteAheadLog, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption, ETurboStructLiteBatchingSetting CompressionBatching, const TCHAR* OperationName, const TCHAR* WildcardLabelLower, const TCHAR* WildcardLabelUpper, const TCHAR* LoadLabel);
 
@@ -179,7 +269,17 @@ private:
 	static inline ETurboStructLiteCompression ConfigDefaultCompression = ETurboStructLiteCompression::Oodle;
 	static inline int32 ConfigDefaultBatchingMB = 4;
 	static inline int32 ActiveDefaultBatchingMB = 4;
+	static inline float ConfigAsyncSnapshotBudgetMs = 0.0f;
+	static inline float ActiveAsyncSnapshotBudgetMs = 0.0f;
 	static inline bool bTurboStructLiteSettingsLoaded = false;
+	static inline FCriticalSection LegacyRedirectsMutex;
+	static inline TSharedPtr<const TMap<FString, FString>> CachedLegacyRedirects;
+	static inline bool bLegacyRedirectsLoaded = false;
+	static inline FCriticalSection DerivedKeyCacheMutex;
+	static inline TArray<FTurboStructLiteDerivedKey> DerivedKeyCache;
+	static inline uint64 DerivedKeyCacheTick = 0;
+	static inline FCriticalSection MasterSaltMutex;
+	static inline TArray<uint8> SessionMasterSalt;
 	static inline const TCHAR* TurboStructLiteSettingsSection = TEXT("/Script/TurboStructLiteProjectSettings.TurboStructLiteProjectSettings");
 
 	// Magic number to identify save files.
@@ -188,7 +288,7 @@ private:
 
 	// Version number to validate save files.
 	UPROPERTY()
-	int32 TurboStructLiteVersion = 4;
+	int32 TurboStructLiteVersion = 5;
 
 	// === Encryption helpers ===
 	// Get active encryption selection.
@@ -199,18 +299,58 @@ private:
 	static void EnsureSettingsLoaded();
 	// Load legacy redirects from config (Category: Serialization).
 	static bool LoadLegacyRedirects(TMap<FString, FString>& OutRedirects);
+	// Legacy redirects parsed once and shared by every load; null when none are configured.
+	static TSharedPtr<const TMap<FString, FString>> GetLegacyRedirects();
+	// Replace the cached legacy redirects after a settings change and drop plans resolved with the old ones.
+	static void SetLegacyRedirects(const TMap<FString, FString>& Redirects);
 	// Resolve ProjectDefault compression to configured value.
 	static ETurboStructLiteCompression ResolveCompression(ETurboStructLiteCompression Method);
 	// Get configured default compression.
 	static ETurboStructLiteCompression GetDefaultCompression();
 	// Resolve batching size in MB (ProjectDefault falls back to settings).
 	static int32 ResolveBatchingMB(ETurboStructLiteBatchingSetting Batching);
+	// Game-thread budget per frame for async save snapshots (0 copies the whole value at once).
+	static float GetAsyncSnapshotBudgetMs();
 	// Encrypt buffer with selected method.
 	static bool EncryptDataBuffer(ETurboStructLiteEncryption Method, const FString& Key, TArray<uint8>& InOutData);
 	// Decrypt buffer with selected method.
 	static bool DecryptDataBuffer(ETurboStructLiteEncryption Method, const FString& Key, TArray<uint8>& InOutData);
+	// Compress and AES-seal each chunk independently on parallel workers.
+	static bool CompressAndEncryptBuffer(ETurboStructLiteCompression Compression, const FString& Key, const TArray<uint8>& In, TArray<uint8>& Out, int32 MaxParallelThreads, int32 ChunkBatchSizeMB);
+	// Compress (and optionally seal) chunk batches while the previous batch is written to the handle.
+	static bool WriteEntryPayloadStreamed(IFileHandle& Handle, ETurboStructLiteCompression Compression, bool bEncrypt, const FString& Key, const TArray<uint8>& RawBytes, int32 MaxParallelThreads, int32 ChunkBatchSizeMB, int32& OutDataSize);
+	// Open a chunked AES payload; decompresses each chunk on the worker that decrypted it, or rebuilds the compressed container.
+	static bool DecryptChunkedBuffer(const FString& Key, const TArray<uint8>& In, ETurboStructLiteCompression Compression, bool bDecompress, TArray<uint8>& Out);
+	// Check whether an encrypted payload uses the per-chunk AES layout.
+	static bool IsChunkedAesPayload(const TArray<uint8>& Data);
+	// Read the little-endian payload tag at the start of an encrypted payload.
+	static uint32 ReadPayloadTag(const uint8* Data);
+	// Byte size of the chunked AES prefix for a payload tag, or 0 when the tag is not a chunked one.
+	static int32 GetChunkedAesPrefixSize(uint32 PayloadTag);
+	// Byte size of the chunked AES prefix plus its sealed header, or -1 when the prefix is invalid.
+	static int64 CalcChunkedAesLayoutSize(const uint8* Prefix);
+	// Derive the entry key and open the sealed header of a chunked AES payload.
+	static bool ReadChunkedAesLayout(const FString& Key, const uint8* Data, int64 DataLen, FTurboStructLiteChunkedLayout& OutLayout);
+	// Build the GCM nonce for a chunk from the base IV and a counter.
+	static void BuildChunkNonce(const uint8* BaseIV, uint32 Counter, uint8 OutIV[12]);
 	// Derive AES key material (64 bytes) from string.
 	static bool DeriveAESKeyFromString(const FString& Key, const TArray<uint8>& Salt, uint8 OutKey[64]);
+	// Get a 256-bit PBKDF2 key for a key string and salt from the LRU cache, deriving it on a miss.
+	static bool GetCachedDerivedKey(const FString& Key, const TArray<uint8>& Salt, uint8 OutKey[32]);
+	// Random master key salt this process seals new AES payloads with, generated on first use.
+	static bool GetSessionMasterSalt(uint8 OutSalt[16]);
+	// Derive a per-entry AES key from the cached master key and an entry salt (HKDF-SHA256); a null master salt selects the legacy fixed salt.
+	static bool DeriveEntryAESKey(const FString& Key, const uint8* MasterSalt, const uint8* Salt, int32 SaltLen, uint8 OutKey[32]);
+	// Zero and drop every cached derived key.
+	static void ClearDerivedKeyCache();
+	// Compute HMAC-SHA256 over a buffer.
+	static bool HmacSha256(const uint8* Key, int32 KeyLen, const uint8* Data, int32 DataLen, uint8 OutHash[32]);
+	// Fill a buffer with cryptographically secure random bytes.
+	static bool FillRandomBytes(uint8* Out, int32 Len);
+	// Encrypt with AES-256-GCM (OpenSSL or fallback), producing ciphertext and a 16-byte tag.
+	static bool EncryptAesGcm(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Plaintext, int32 PlaintextLen, TArray<uint8>& OutCiphertext, uint8 OutTag[16]);
+	// Decrypt and authenticate AES-256-GCM (OpenSSL or fallback).
+	static bool DecryptAesGcm(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Ciphertext, int32 CiphertextLen, const uint8* Tag, TArray<uint8>& OutPlaintext);
 	// Encrypt buffer with AES-256-GCM fallback (FAES CTR + GHASH).
 	static bool EncryptAesGcmFallback(const uint8* Key, const uint8* IV, int32 IVLen, const uint8* Plaintext, int32 PlaintextLen, TArray<uint8>& OutCiphertext, TArray<uint8>& OutTag);
 	// Decrypt buffer with AES-256-GCM fallback (FAES CTR + GHASH).
@@ -219,17 +359,17 @@ private:
 	static void EncryptAesBlock(const uint8* Key, const uint8 InBlock[16], uint8 OutBlock[16]);
 	// Increment the 32-bit counter portion of a GCM block.
 	static void GcmIncrement32(uint8 Counter[16]);
-	// Right shift a 128-bit block by one bit (big-endian).
-	static void GcmRightShift(uint8 Block[16]);
-	// Multiply two 128-bit values in GF(2^128).
-	static void GcmMultiply(const uint8 X[16], const uint8 Y[16], uint8 Out[16]);
+	// Precompute the 4-bit GHASH multiplication table for a hash key.
+	static void GcmInitTable(const uint8 H[16], FTurboStructLiteGhashTable& OutTable);
+	// Multiply a GHASH state by H in GF(2^128) using the precomputed table.
+	static void GcmMultiply(uint8 Xi[16], const FTurboStructLiteGhashTable& Table);
 	// Update GHASH state with data.
-	static void GcmUpdate(uint8 Xi[16], const uint8* Data, int32 DataLen, const uint8 H[16]);
+	static void GcmUpdate(uint8 Xi[16], const uint8* Data, int32 DataLen, const FTurboStructLiteGhashTable& Table);
 	// Finalize GHASH with length block.
-	static void GcmFinalize(uint8 Xi[16], uint64 AadBits, uint64 CipherBits, const uint8 H[16]);
+	static void GcmFinalize(uint8 Xi[16], uint64 AadBits, uint64 CipherBits, const FTurboStructLiteGhashTable& Table);
 	// Build the J0 block from an IV.
-	static void GcmBuildJ0(const uint8* IV, int32 IVLen, const uint8 H[16], uint8 OutJ0[16]);
-	// Apply CTR transform for GCM.
+	static void GcmBuildJ0(const uint8* IV, int32 IVLen, const FTurboStructLiteGhashTable& Table, uint8 OutJ0[16]);
+	// Apply CTR transform for GCM (keystream generated in batches).
 	static void GcmCtrCrypt(const uint8* Key, const uint8 J0[16], const uint8* In, int32 InLen, TArray<uint8>& Out);
 	// Constant-time compare for authentication tags.
 	static bool GcmConstantTimeEqual(const uint8* A, const uint8* B, int32 Len);
@@ -242,7 +382,7 @@ private:
 	// Core buffer decompression entry point.
 	static bool DecompressBuffer(ETurboStructLiteCompression Method, const TArray<uint8>& In, TArray<uint8>& Out);
 	// Serialize property with embedded metadata.
-	static bool SerializePropertyWithMeta(FProperty* Property, void* Address, TArray<uint8>& OutBytes, FString& OutDebugMeta, bool bSaveOnlyMarked = false);
+	static bool SerializePropertyWithMeta(FProperty* Property, void* Address, TArray<uint8>& OutBytes, FString& OutDebugMeta, bool bSaveOnlyMarked = false, bool bShareSchema = false);
 	// Deserialize property using embedded metadata.
 	static bool DeserializePropertyWithMeta(FProperty* Property, void* Address, const TArray<uint8>& InBytes, int32 OverrideMaxThreads = -1, bool bSaveOnlyMarked = false);
 	// Build debug metadata string from serialized bytes.
@@ -256,7 +396,11 @@ private:
 	// Compare metadata names against a property name/authored name. Category: Serialization.
 	static bool NamesMatchForMigration(const FString& MetaName, const FProperty* Property);
 	// Read metadata and data pointers from serialized bytes.
-	static bool ReadMetaFromBytes(const TArray<uint8>& InBytes, TArray<FTurboStructLiteFieldMeta>& OutFields, const uint8*& OutDataPtr, int32& OutDataLen, FString& OutErrorMessage);
+	static bool ReadMetaFromBytes(const TArray<uint8>& InBytes, TArray<FTurboStructLiteFieldMeta>& OutFields, const uint8*& OutDataPtr, int32& OutDataLen, FString& OutErrorMessage, FTurboStructLiteNameTable* OutNameTable = nullptr);
+	// Write an entry name table (count, then each name as a string).
+	static void WriteNameTable(FArchive& Ar, const FTurboStructLiteNameTable& Table);
+	// Read an entry name table; a null table only skips it.
+	static bool ReadNameTable(FArchive& Ar, FTurboStructLiteNameTable* OutTable);
 	// Resolve the metadata field list for a struct root.
 	static const TArray<FTurboStructLiteFieldMeta>* ResolveStructMetaFields(const TArray<FTurboStructLiteFieldMeta>& Fields, const FStructProperty* StructProp);
 	// Find a metadata entry and offset for a property chain.
@@ -279,14 +423,26 @@ private:
 	static int32 SetParallelThreadLimit(int32 MaxThreads);
 	// Get current parallel thread limit for serialization.
 	static int32 GetParallelThreadLimit();
-	// Serialize a wildcard property into bytes (optionally SaveGame-only).
-	static bool SerializeWildcard(FProperty* Property, void* Address, TArray<uint8>& OutBytes, bool bSaveOnlyMarked = false);
+	// Set the name table used by (de)serialization on this thread (returns previous).
+	static FTurboStructLiteNameTable* SetActiveNameTable(FTurboStructLiteNameTable* Table);
+	// Get the name table used by (de)serialization on this thread, if any.
+	static FTurboStructLiteNameTable* GetActiveNameTable();
+	// Serialize a wildcard property into bytes (optionally SaveGame-only, optionally referencing a shared schema).
+	static bool SerializeWildcard(FProperty* Property, void* Address, TArray<uint8>& OutBytes, bool bSaveOnlyMarked = false, bool bShareSchema = false);
 	// Deserialize bytes into a wildcard property (optionally SaveGame-only).
 	static bool DeserializeWildcard(FProperty* Property, void* Address, const TArray<uint8>& InBytes, int32 OverrideMaxThreads = -1, bool bSaveOnlyMarked = false);
 	// Build debug metadata string for a property (name/type/fields).
 	static FString BuildDebugMetadata(FProperty* Property);
 	// Serialize large arrays in parallel to accelerate saves.
 	static bool SerializeArrayParallel(FArrayProperty* ArrayProp, void* Address, TArray<uint8>& OutData, FTurboStructLiteFieldMeta& OutMeta, bool bSaveOnlyMarked = false);
+	// Check if array elements of this type are stored exactly as they sit in memory.
+	static bool IsRawPodElement(const FProperty* Inner);
+	// Check if every value of a struct type serializes to exactly its in-memory bytes.
+	static bool IsRawSerializableStruct(const UScriptStruct* Struct);
+	// Check if an array can be written as one memory block with the same bytes SerializeItem would produce.
+	static bool CanSerializeArrayRaw(FArrayProperty* ArrayProp, void* Address, bool bSaveOnlyMarked);
+	// Write a POD array as its element count followed by one memcpy'd block.
+	static bool SerializeArrayRaw(FArrayProperty* ArrayProp, void* Address, TArray<uint8>& OutData, FTurboStructLiteFieldMeta& OutMeta, bool bSaveOnlyMarked = false);
 	// Access saved magic value.
 	static int32 GetMagic();
 	// Access saved version value.
@@ -301,10 +457,20 @@ private:
 	static bool TurboStructLiteValidateStructLayout(const FProperty* Property, const TArray<FString>& FieldNames);
 	// Internal read of subslot metadata (used by editor helpers).
 	static bool ReadSubSlotInfoInternal(const FString& SlotName, int32 SubSlotIndex, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption, FTurboStructLiteSubSlotInfo& OutInfo);
-	// Serialize field metadata tree into an archive.
-	static void WriteFieldMeta(FArchive& Ar, const FTurboStructLiteFieldMeta& Meta);
+	// Serialize field metadata tree into an archive (sizes written as zero for shared schemas).
+	static void WriteFieldMeta(FArchive& Ar, const FTurboStructLiteFieldMeta& Meta, bool bWriteSizes = true);
 	// Deserialize field metadata tree from an archive.
 	static bool ReadFieldMeta(FArchive& Ar, FTurboStructLiteFieldMeta& OutMeta);
+	// Append the size of every node of a metadata tree in pre-order.
+	static void CollectFieldMetaSizes(const FTurboStructLiteFieldMeta& Meta, TArray<int32>& OutSizes);
+	// Fill the size of every node of a metadata tree in pre-order from a size list.
+	static bool ApplyFieldMetaSizes(FTurboStructLiteFieldMeta& Meta, const TArray<int32>& Sizes, int32& InOutSizeIndex);
+	// Parse schema bytes once and share the result process-wide, keyed by their hash.
+	static TSharedPtr<const FTurboStructLiteSchema> RegisterSchema(const TArray<uint8>& SchemaBytes);
+	// Find a parsed schema registered by a save or by a slot's schema block.
+	static TSharedPtr<const FTurboStructLiteSchema> FindSchema(uint64 SchemaHash);
+	// Read the schema hash of serialized bytes that reference a shared schema.
+	static bool ReadSchemaHashFromBytes(const TArray<uint8>& InBytes, uint64& OutSchemaHash);
 	// Build the debug metadata string (Name/Type/Fields) from field metadata.
 	static bool BuildDebugString(const TArray<FTurboStructLiteFieldMeta>& Fields, FString& Out);
 	// Detect unsupported properties for serialization.
@@ -313,6 +479,16 @@ private:
 	static bool SerializePropertyRecursive(FProperty* Property, void* Address, TArray<uint8>& OutData, FTurboStructLiteFieldMeta& OutMeta, bool bSaveOnlyMarked = false);
 	// Apply metadata back into a struct instance.
 	static bool ApplyMetaToStruct(const TArray<FTurboStructLiteFieldMeta>& MetaFields, const UStruct* Struct, uint8* BasePtr, const uint8* Data, int32 DataLen, int32& Offset, int32 MaxThreads, bool bSaveOnlyMarked, const FString& PathPrefix, const FArchive& VersionSource);
+	// Resolve stored fields against a live struct once: destination property, type match, POD array copies and nested plans.
+	static TSharedPtr<const FTurboStructLiteLoadPlan> BuildLoadPlan(const TArray<FTurboStructLiteFieldMeta>& MetaFields, const UStruct* Struct, const FString& PathPrefix, const TMap<FString, FString>* Redirects);
+	// Find or build the cached load plan of a shared schema applied to a live struct.
+	static TSharedPtr<const FTurboStructLiteLoadPlan> GetLoadPlan(uint64 SchemaHash, const TArray<FTurboStructLiteFieldMeta>& MetaFields, const UStruct* Struct, const FString& PathPrefix);
+	// Check that a load plan still matches the struct layout it was built for.
+	static bool IsLoadPlanCurrent(const FTurboStructLiteLoadPlan& Plan, const UStruct* Struct);
+	// Apply stored fields to a struct instance following a load plan.
+	static bool ApplyLoadPlan(const FTurboStructLiteLoadPlan& Plan, const TArray<FTurboStructLiteFieldMeta>& MetaFields, uint8* BasePtr, const uint8* Data, int32 DataLen, int32& Offset, int32 MaxThreads, bool bSaveOnlyMarked, const FString& PathPrefix, const FArchive& VersionSource);
+	// Drop every cached load plan.
+	static void ClearLoadPlanCache();
 	// Build a comma separated list of struct field names.
 	static FString BuildStructFieldList(const UStruct* Struct);
 	// Compare struct fields against a recorded list (order-sensitive).
@@ -332,6 +508,28 @@ private:
 	static int32 CalcStreamingBufferSize(int64 FileSize);
 	// Write a single entry to an archive.
 	static void WriteEntry(FArchive& Writer, int32 SubSlot, const FTurboStructLiteEntry& Entry);
+	// Read a slot index from an archive (entry scan for legacy files, footer for append-only files).
+	static bool ReadSlotIndexFromArchive(FArchive& Reader, FTurboStructLiteSlotIndex& OutIndex);
+	// Write the footer index that points at the live record of every subslot.
+	static void WriteSlotFooter(FArchive& Writer, const FTurboStructLiteSlotIndex& Index);
+	// Write the schema table block that follows a footer.
+	static void WriteSchemaBlock(FArchive& Writer, const FTurboStructLiteSlotIndex& Index);
+	// Read the schema table block that follows a footer and register its schemas, leaving the reader untouched when it is absent.
+	static void ReadSchemaBlock(FArchive& Reader, FTurboStructLiteSlotIndex& OutIndex);
+	// Write the zone map block that follows a footer.
+	static void WriteZoneMapBlock(FArchive& Writer, const FTurboStructLiteSlotIndex& Index);
+	// Read the zone map block that follows a footer, leaving entries without summaries when it is absent or damaged.
+	static void ReadZoneMapBlock(FArchive& Reader, FTurboStructLiteSlotIndex& OutIndex);
+	// Summarize the scalar top-level fields of serialized struct bytes.
+	static TSharedPtr<const TArray<FTurboStructLiteZoneRange>> BuildZoneMap(const TArray<uint8>& RawBytes);
+	// Append the footer at the end of the file and commit it by patching the header.
+	static bool CommitSlotFooter(IFileHandle& Handle, FTurboStructLiteSlotIndex& Index);
+	// Count the bytes still referenced by a slot index (header, live records, footer).
+	static int64 CalcLiveSlotBytes(const FTurboStructLiteSlotIndex& Index);
+	// Rewrite a slot file without dead records, optionally dropping one subslot.
+	static bool CompactSlotFile(const FString& SlotName, int32 ExcludeSubSlot = INDEX_NONE, bool bUseWriteAheadLog = false, const FString& WALPath = TEXT(""));
+	// Compact a slot file once its dead space crosses the compaction threshold.
+	static void CompactSlotFileIfNeeded(const FString& SlotName, const FTurboStructLiteSlotIndex& Index, bool bUseWriteAheadLog = false, const FString& WALPath = TEXT(""));
 	// List subslot indices in a slot file.
 	static bool ListSubSlotIndices(const FString& SlotName, TArray<int32>& OutSubSlots);
 	// List subslot infos (with metadata) in a slot file.
@@ -358,10 +556,24 @@ private:
 	static bool ReadTurboStructLiteFile(const FString& FilePath, TMap<int32, FTurboStructLiteEntry>& OutEntries);
 	// Write the full turbo struct file from a map.
 	static bool WriteTurboStructLiteFile(const FString& FilePath, const TMap<int32, FTurboStructLiteEntry>& Entries);
-	// Save a single subslot to disk (streaming-friendly).
+	// Check that a payload can be saved with the given encryption.
+	static bool IsSavePayloadValid(ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes);
+	// Create or upgrade the slot file and open it for appending.
+	static bool OpenSlotForAppend(const FString& SlotName, FTurboStructLiteSlotIndex& OutIndex, TUniquePtr<IFileHandle>& OutHandle, bool bUseWriteAheadLog, const FString& WALPath);
+	// Append one record to an open slot file and add it to the index.
+	static bool AppendEntryRecord(IFileHandle& Handle, FTurboStructLiteSlotIndex& Index, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, bool bUseWriteAheadLog, const FString& WALPath, const TArray<uint8>* EncodedPayload = nullptr);
+	// Commit the footer for appended records, close the file and refresh caches.
+	static bool CommitAppendedEntries(const FString& SlotName, TUniquePtr<IFileHandle>& Handle, FTurboStructLiteSlotIndex& Index, bool bUseWriteAheadLog, const FString& WALPath);
+	// Save a single subslot to disk (appends the record and commits a new footer).
 	static bool SaveEntry(const FString& SlotName, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes, const FString& DebugMeta, int32 MaxParallelThreads = -1, ETurboStructLiteBatchingSetting CompressionBatching = ETurboStructLiteBatchingSetting::ProjectDefault, bool bUseWriteAheadLog = false, const FString& WALPath = TEXT(""));
+	// Save several subslots of one slot with a single footer commit.
+	static bool SaveEntries(const FString& SlotName, const TArray<FTurboStructLiteSaveRequest>& Entries, TArray<bool>& OutResults);
+	// Stream an entry from disk, decrypting/decompressing chunk batches while the next batch is read.
+	static bool LoadEntryStreamed(FArchive& Reader, const FTurboStructLiteCachedEntry& Cached, bool bEncrypted, const FString& Key, TArray<uint8>& OutRawBytes, bool& bOutStreamed);
 	// Load a single subslot from disk.
 	static bool LoadEntry(const FString& SlotName, int32 SubSlotIndex, const FString& EncryptionKey, ETurboStructLiteEncryption DefaultEncryption, TArray<uint8>& OutRawBytes, bool bUseWriteAheadLog = false, const FString& WALPath = TEXT(""));
+	// Load several subslots of one slot through a single reader, decoding small entries in parallel.
+	static bool LoadEntries(const FString& SlotName, const TArray<int32>& SubSlotIndices, const FString& EncryptionKey, ETurboStructLiteEncryption DefaultEncryption, TArray<TArray<uint8>>& OutRawBytes, TArray<bool>& OutResults);
 	// Check for existence of a subslot.
 	static bool ExistsEntry(const FString& SlotName, int32 SubSlotIndex);
 	// Remove a subslot from disk.
@@ -393,15 +605,81 @@ private:
 	// Invalidate all cached slot indexes.
 	static void InvalidateAllSlotIndexes();
 
+	// === Secondary indexes ===
+	// Build absolute path to a slot's secondary index sidecar.
+	static FString BuildIndexPath(const FString& SlotName);
+	// Read a slot's secondary index sidecar.
+	static bool ReadSecondaryIndexes(const FString& SlotName, FTurboStructLiteSecondaryIndexSet& OutSet);
+	// Write a slot's secondary index sidecar as stamped by the caller (deletes it when empty).
+	static bool WriteSecondaryIndexes(const FString& SlotName, const FTurboStructLiteSecondaryIndexSet& Set);
+	// Read a slot's secondary indexes only when they match the current slot file.
+	static bool GetFreshSecondaryIndexes(const FString& SlotName, FTurboStructLiteSecondaryIndexSet& OutSet);
+	// Read the size, committed footer offset and commit timestamp of a slot file.
+	static FTurboStructLiteSlotCommitStamp ReadSlotCommitStamp(const FString& SlotName);
+	// Slot commit stamp to hand to UpdateSecondaryIndexes after a write; FileSize is -2 when the slot has no indexes.
+	static FTurboStructLiteSlotCommitStamp GetIndexedSlotStamp(const FString& SlotName);
+	// Apply committed saves (payload) and removals (null payload) when the indexes matched the slot before the write.
+	static void UpdateSecondaryIndexes(const FString& SlotName, const FTurboStructLiteSlotCommitStamp& StampBefore, const TArray<int32>& SubSlots, const TArray<const TArray<uint8>*>& Payloads);
+	// Copy or move the sidecar along with its slot file, dropping any stale target sidecar.
+	static void TransferSecondaryIndexes(const FString& SourceSlotName, const FString& TargetSlotName, bool bMove);
+	// Read a field value from serialized bytes by dotted metadata path.
+	static bool ReadFieldVariantFromBytes(const TArray<uint8>& RawBytes, const FString& FieldPath, FTurboStructLiteVariant& OutVariant);
+	// Hash a string/name index key (case-insensitive, like FString and FName equality).
+	static uint32 HashIndexString(const FString& Value);
+	// Replace the key of one subslot in a field index (null bytes remove the subslot).
+	static void SetIndexEntry(FTurboStructLiteFieldIndex& Index, int32 SubSlot, const TArray<uint8>* RawBytes);
+	// Key one subslot into a field index, either in order or appended for a later sort.
+	static void AddIndexKey(FTurboStructLiteFieldIndex& Index, int32 SubSlot, const TArray<uint8>& RawBytes, bool bKeepSorted);
+	// Rebuild field indexes from every subslot, loading bounded batches and sorting each key list once.
+	static bool RebuildIndexes(TArray<FTurboStructLiteFieldIndex>& Indexes, const FString& SlotName, const TArray<int32>& SubSlots, const FString& EncryptionKey, ETurboStructLiteEncryption DefaultEncryption);
+	// Whether any entry of the slot is AES-encrypted; the plaintext sidecar never covers such slots.
+	static bool HasEncryptedEntries(const FString& SlotName);
+	// Collect subslots whose indexed value may lie in [Min, Max].
+	static void CollectIndexRange(const FTurboStructLiteFieldIndex& Index, double Min, double Max, TSet<int32>& OutSubSlots);
+	// Collect subslots whose indexed string/name may hash to Hash.
+	static void CollectIndexHash(const FTurboStructLiteFieldIndex& Index, uint32 Hash, TSet<int32>& OutSubSlots);
+
 	// === Task queue ===
-	// Enqueue a per-slot task.
-	static void EnqueueTask(const FString& SlotName, TFunction<void()> Task, int32 Priority, TFunction<void()> CancelCallback = TFunction<void()>());
-	// Run the next task for a slot.
+	// Enqueue a per-slot task; read-only tasks may run alongside each other.
+	static void EnqueueTask(const FString& SlotName, TFunction<void()> Task, int32 Priority, TFunction<void()> CancelCallback = TFunction<void()>(), bool bReadOnly = false);
+	// Stamp and push a task onto the slot heap (queue mutex held).
+	static uint64 PushQueuedTask(FTurboStructLiteTaskQueue& Queue, FTurboStructLiteQueuedTask&& Task);
+	// Start every task the slot can currently run.
+	static void DispatchReadyTasks(const FString& SlotName);
+	// Mark a slot task as finished and dispatch what follows.
 	static void ProcessNextTask(const FString& SlotName);
+	// Fire a batch completion with the aggregated per-entry results.
+	static void CompleteBatchProgress(FTurboStructLiteBatchProgress& Progress);
+	// Queue a batch of saves for one slot as a single writer task.
+	static void EnqueueSaveBatchRequest(TArray<FTurboStructLiteSaveRequest>&& Requests, int32 Priority);
+	// Queue a batch load for one slot as a single reader task.
+	static void EnqueueLoadBatchRequest(FTurboStructLiteLoadBatchRequest&& Request);
+	// Execute a batch load request (sync or async).
+	static void ExecuteLoadBatchRequest(FTurboStructLiteLoadBatchRequest&& Request);
+	// Category: Task queue.
+	// Read and decode every subslot of a batch load under the slot read lock.
+	static void ExecuteLoadBatchWork(const FTurboStructLiteLoadBatchRequest& Request, TArray<TArray<uint8>>& OutRawBytes, TArray<bool>& OutResults);
+	// Category: Task queue.
+	// Rebuild a wildcard array from decoded batch payloads.
+	static void DeserializeBatchElements(FArrayProperty* ValuesProp, void* ValuesPtr, const TArray<TArray<uint8>>& RawBytes, TArray<bool>& InOutResults, int32 MaxThreads, bool bParallel);
+	// Category: Task queue.
+	// Report a batch load and release the slot queue.
+	static void FinalizeLoadBatch(FTurboStructLiteLoadBatchRequest&& Request, const TArray<bool>& Results);
 	// Queue a save request.
 	static void EnqueueSaveRequest(FTurboStructLiteSaveRequest&& Request);
 	// Execute a save request (sync or async).
 	static void ExecuteSaveRequest(FTurboStructLiteSaveRequest&& Request);
+	// Claim a queued save plus any other pending saves of the slot that can share its commit.
+	static void TakePendingSaveBatch(FTurboStructLiteTaskQueue& Queue, const TSharedPtr<FTurboStructLitePendingSave>& Leader, bool bIncludeFollowers, TArray<FTurboStructLiteSaveRequest>& OutRequests);
+	// Category: Task queue.
+	// Execute several save requests for one slot with a single commit.
+	static void ExecuteSaveBatch(TArray<FTurboStructLiteSaveRequest>&& Requests);
+	// Category: Task queue.
+	// Execute the core save work for a batch of subslots.
+	static bool ExecuteSaveBatchWork(const FString& SlotName, TArray<FTurboStructLiteSaveRequest>& Requests, TArray<bool>& OutResults);
+	// Category: Task queue.
+	// Report every batched save result and release the slot queue once.
+	static void FinalizeSaveBatch(const FString& SlotName, TArray<FTurboStructLiteSaveRequest>&& Requests, const TArray<bool>& Results);
 	// Category: Task queue.
 	// Execute the core save work for a slot/subslot.
 	static bool ExecuteSaveWork(const FString& SlotName, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const TArray<uint8>& RawBytes, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, bool bUseWriteAheadLog, const FString& WALPath);
@@ -410,10 +688,10 @@ private:
 	static void ExecuteSaveAsync(TArray<uint8>&& RawBytes, const FString& SlotName, int32 SubSlotIndex, ETurboStructLiteCompression Compression, ETurboStructLiteEncryption Encryption, const FString& EncryptionKey, const FString& DebugMeta, int32 MaxParallelThreads, ETurboStructLiteBatchingSetting CompressionBatching, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath);
 	// Category: Task queue.
 	// Finalize an async save on the game thread.
-	static void FinalizeSaveRequestAsync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath);
+	static void FinalizeSaveRequestAsync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath, bool bFinishQueuedSave = true);
 	// Category: Task queue.
 	// Finalize a sync save on the calling thread.
-	static void FinalizeSaveRequestSync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath);
+	static void FinalizeSaveRequestSync(const FString& SlotName, int32 SubSlotIndex, bool bSaved, const FString& FilePath, TFunction<void(bool, FString, int32)>&& Callback, bool bUseWriteAheadLog, const FString& WALPath, bool bFinishQueuedSave = true);
 	// Mark save queue as done for a slot.
 	static void FinishQueuedSave(const FString& SlotName);
 	// Queue a load request.
@@ -431,7 +709,7 @@ private:
 	// Dispatch cancel callbacks on the game thread.
 	static void DispatchCancelCallbacks(TArray<TFunction<void()>>&& Callbacks);
 	// Get or create a per-slot operation lock.
-	static TSharedPtr<FCriticalSection> GetSlotOperationLock(const FString& SlotName);
+	static TSharedPtr<FRWLock> GetSlotOperationLock(const FString& SlotName);
 	// Mark a slot operation as started.
 	static void BeginSlotOperation(const FString& SlotName);
 	// Mark a slot operation as finished.
@@ -446,12 +724,16 @@ private:
 	static FCriticalSection QueuesMutex;
 	static TMap<FString, TSharedPtr<FTurboStructLiteTaskQueue>> QueuesBySlot;
 	static FCriticalSection SlotOperationMutex;
-	static TMap<FString, TSharedPtr<FCriticalSection>> SlotOperationLocks;
+	static TMap<FString, TSharedPtr<FRWLock>> SlotOperationLocks;
 	static FCriticalSection ActiveSlotOpsMutex;
 	static TMap<FString, int32> ActiveSlotOps;
 	static int32 ActiveSlotOpsTotal;
 	static FCriticalSection SlotIndexMutex;
 	static TMap<FString, FTurboStructLiteSlotIndex> CachedSlotIndexes;
+	static inline FCriticalSection SchemaCacheMutex;
+	static inline TMap<uint64, TSharedPtr<const FTurboStructLiteSchema>> SchemaCache;
+	static inline FCriticalSection LoadPlanCacheMutex;
+	static inline TMap<TPair<uint64, const UStruct*>, TSharedPtr<const FTurboStructLiteLoadPlan>> LoadPlanCache;
 	static FCriticalSection MemoryWarningMutex;
 	static TSet<uint32> WarnedMemorySlots;
 	static bool bMemoryWarningsCvarRegistered;
@@ -14,3 +14,75 @@ inline constexpr int32 TurboStructLiteParallelMinBatchSize = 1024;
 inline constexpr int32 TurboStructLiteParallelTargetBytesPerChunk = 256 * 1024;
 // Maximum number of chunks per thread for simple type batching.
 inline constexpr int32 TurboStructLiteParallelMaxChunksPerThread = 4;
+// First file version that uses append-only records with a footer index.
+inline constexpr int32 TurboStructLiteAppendOnlyVersion = 5;
+// Magic number that prefixes the footer index of append-only slot files.
+inline constexpr int32 TurboStructLiteFooterMagic = 0x53534654;
+// Byte size of the append-only file header (Magic, Version, Timestamp, EntryCount, FooterOffset).
+inline constexpr int32 TurboStructLiteAppendHeaderSize = 28;
+// Byte offset of the header fields rewritten on every footer commit (Timestamp onwards).
+inline constexpr int32 TurboStructLiteAppendHeaderCommitOffset = 8;
+// Byte size of an entry record header (SubSlot, Compression, Encryption, UncompressedSize, DataSize, MetaSize).
+inline constexpr int32 TurboStructLiteEntryRecordHeaderSize = 18;
+// Byte size of a single footer descriptor (record header fields plus the data offset).
+inline constexpr int32 TurboStructLiteFooterEntrySize = 26;
+// Magic number of the zone map block written right after a footer (older readers stop before it).
+inline constexpr int32 TurboStructLiteZoneMapMagic = 0x53535A4D;
+// Most top-level fields summarized in one entry's zone map.
+inline constexpr int32 TurboStructLiteZoneMapMaxFields = 64;
+// Serialized payload format that embeds the full field meta tree.
+inline constexpr int32 TurboStructLiteMetaFormatInline = 1;
+// Serialized payload format that references a shared schema by hash and only stores the field sizes.
+inline constexpr int32 TurboStructLiteMetaFormatSchema = 2;
+// Payload format bit: a name table follows the meta header and names in the data are varint indices into it.
+inline constexpr int32 TurboStructLiteMetaFormatNameTableFlag = 0x100;
+// Magic number of the schema table block written between a footer and its zone map block.
+inline constexpr int32 TurboStructLiteSchemaBlockMagic = 0x53534348;
+// Minimum slot file size before dead space is reclaimed by compaction.
+inline constexpr int64 TurboStructLiteCompactionMinFileBytes = 4ll * 1024ll * 1024ll;
+// Percentage of dead bytes in a slot file that triggers compaction.
+inline constexpr int32 TurboStructLiteCompactionDeadPercent = 50;
+// Marker that prefixes AES payloads sealed with a per-entry key derived from the cached master key.
+inline constexpr uint32 TurboStructLiteKeyedPayloadTag = 0x314B5354;
+// Marker that prefixes keyed AES payloads which also store the salt of their PBKDF2 master key.
+inline constexpr uint32 TurboStructLiteSaltedPayloadTag = 0x324B5354;
+// Byte size of the random master key salt stored in salted AES payloads.
+inline constexpr int32 TurboStructLiteMasterSaltSize = 16;
+// Byte size of the salt stored in front of every AES payload.
+inline constexpr int32 TurboStructLiteAesSaltSize = 16;
+// Byte size of the AES-GCM IV stored in every AES payload.
+inline constexpr int32 TurboStructLiteAesIVSize = 12;
+// Byte size of the AES-GCM authentication tag stored in every AES payload.
+inline constexpr int32 TurboStructLiteAesTagSize = 16;
+// Maximum number of PBKDF2-derived master keys kept in memory (legacy per-entry keys are not cached).
+inline constexpr int32 TurboStructLiteDerivedKeyCacheSize = 32;
+// Counter blocks encrypted per FAES call in the AES-GCM fallback CTR stage.
+inline constexpr int32 TurboStructLiteGcmCtrBatchBlocks = 256;
+// Marker that prefixes AES payloads sealed per compression chunk.
+inline constexpr uint32 TurboStructLiteChunkedPayloadTag = 0x31435354;
+// Byte size of the chunked AES prefix (Tag, Salt, BaseIV, Flags, ChunkCount, HeaderTag).
+inline constexpr int32 TurboStructLiteChunkedPayloadPrefixSize = 53;
+// Marker that prefixes chunked AES payloads which also store the salt of their PBKDF2 master key.
+inline constexpr uint32 TurboStructLiteSaltedChunkedPayloadTag = 0x32435354;
+// Byte size of the salted chunked AES prefix (Tag, MasterSalt, Salt, BaseIV, Flags, ChunkCount, HeaderTag).
+inline constexpr int32 TurboStructLiteSaltedChunkedPayloadPrefixSize = TurboStructLiteChunkedPayloadPrefixSize + TurboStructLiteMasterSaltSize;
+// Chunked AES flag: chunks hold raw bytes instead of compressed blocks.
+inline constexpr uint8 TurboStructLiteChunkedFlagRaw = 0x01;
+// Counter used for the sealed container header of chunked AES payloads (chunks use 1..N).
+inline constexpr uint32 TurboStructLiteChunkedHeaderCounter = 0x40000000u;
+// Counter bit set on the last chunk of a chunked AES payload.
+inline constexpr uint32 TurboStructLiteChunkedLastCounterBit = 0x80000000u;
+// Byte offset of the DataSize field inside an appended record header.
+inline constexpr int64 TurboStructLiteRecordDataSizeOffset = 10;
+// Array elements copied between budget checks while capturing a time-sliced snapshot.
+inline constexpr int32 TurboStructLiteSnapshotSliceElements = 256;
+// Largest payload a batch save/load encodes or decodes as one unit so entries run in parallel with each other.
+inline constexpr int32 TurboStructLiteBatchInlineEntryBytes = 4 * 1024 * 1024;
+// Magic number that prefixes a slot's secondary index sidecar file.
+inline constexpr int32 TurboStructLiteIndexMagic = 0x53534649;
+// Format version of the secondary index sidecar file.
+inline constexpr int32 TurboStructLiteIndexVersion = 2;
+// Suffix appended to the slot file path to name its secondary index sidecar.
+inline constexpr const TCHAR* TurboStructLiteIndexFileSuffix = TEXT(".idx");
+// Subslots loaded at once while building a secondary index.
+inline constexpr int32 TurboStructLiteIndexBuildBatchEntries = 64;
@@ -16,9 +16,13 @@
 
 #include "CoreMinimal.h"
 #include "Templates/Function.h"
+#include "HAL/CriticalSection.h"
 #include "UObject/Field.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 #include "TurboStructLiteTypes.generated.h"
 
+class FArrayProperty;
+
 UENUM(BlueprintType)
 enum class ETurboStructLiteCompression : uint8
 {
@@ -173,10 +177,13 @@ struct FTurboStructLiteQueuedTask
 	TFunction<void()> Payload;
 	TFunction<void()> CancelCallback;
 	int32 Priority = 10;
+	bool bReadOnly = false;
+	uint64 Sequence = 0;
+	double EnqueueTime = 0.0;
 
 	bool operator<(const FTurboStructLiteQueuedTask& Other) const
 	{
-		return Priority < Other.Priority;
+		return Priority != Other.Priority ? Priority < Other.Priority : Sequence < Other.Sequence;
 	}
 };
 
@@ -216,11 +223,81 @@ struct FTurboStructLiteLoadRequest
 	TFunction<void(bool)> Callback;
 };
 
+struct FTurboStructLiteLoadBatchRequest
+{
+	FString SlotName;
+	TArray<int32> SubSlotIndices;
+	bool bAsync = false;
+	bool bUseWriteAheadLog = false;
+	ETurboStructLiteEncryption DefaultEncryption = ETurboStructLiteEncryption::ProjectDefault;
+	FString EncryptionKey;
+	FString WALPath;
+	FArrayProperty* ValuesProp = nullptr;
+	void* ValuesPtr = nullptr;
+	int32 QueuePriority = 10;
+	int32 MaxParallelThreads = 4;
+	TFunction<void(bool, const TArray<bool>&)> Callback;
+};
+
+struct FTurboStructLiteBatchProgress
+{
+	TArray<bool> Results;
+	int32 Remaining = 0;
+	TFunction<void(bool, const TArray<bool>&)> OnComplete;
+};
+
+struct FTurboStructLitePendingSave
+{
+	FTurboStructLiteSaveRequest Request;
+	TArray<TFunction<void(bool, FString, int32)>> SupersededCallbacks;
+	uint64 TaskSequence = 0;
+};
+
+USTRUCT(BlueprintType)
+struct TURBOSTRUCTLITE_API FTurboStructLiteQueueStats
+{
+	GENERATED_BODY()
+
+	// Tasks the slot queue has started.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TurboStructLite")
+	int32 DispatchedTasks = 0;
+
+	// Queued saves replaced by a newer save of the same subslot.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TurboStructLite")
+	int32 CoalescedSaves = 0;
+
+	// Queued saves folded into another save's batch write.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TurboStructLite")
+	int32 BatchedSaves = 0;
+
+	// Summed time tasks spent queued before they started.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TurboStructLite")
+	double TotalWaitSeconds = 0.0;
+
+	// Longest time a single task spent queued.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TurboStructLite")
+	double MaxWaitSeconds = 0.0;
+
+	// Wall time the slot had at least one reader or writer running; overlapping readers count once.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "TurboStructLite")
+	double SlotBusySeconds = 0.0;
+};
+
 struct FTurboStructLiteTaskQueue
 {
 	FCriticalSection Mutex;
 	TArray<FTurboStructLiteQueuedTask> PendingTasks;
-	bool bTaskInProgress = false;
+	TMap<int32, TSharedPtr<FTurboStructLitePendingSave>> PendingSaves;
+	int32 ActiveReaders = 0;
+	bool bWriterActive = false;
+	uint64 NextSequence = 0;
+	double BusySince = 0.0;
+	FTurboStructLiteQueueStats Stats;
+
+	bool IsBusy() const
+	{
+		return bWriterActive || ActiveReaders > 0;
+	}
 };
 
 struct FTurboStructLiteFieldMeta
@@ -231,6 +308,26 @@ struct FTurboStructLiteFieldMeta
 	TArray<FTurboStructLiteFieldMeta> Children;
 };
 
+struct FTurboStructLiteSchema
+{
+	uint64 Hash = 0;
+	// Meta tree shape (names, types, child counts) with every size written as zero.
+	TArray<uint8> Bytes;
+	// Parsed tree; loads copy it and fill the sizes stored with each entry.
+	TArray<FTurboStructLiteFieldMeta> Fields;
+	int32 NodeCount = 0;
+};
+
+struct FTurboStructLiteNameTable
+{
+	// Guards saves that add names from several worker threads; loads only read the table.
+	FCriticalSection Mutex;
+	// Distinct names of one entry in first-use order; the data references them by index.
+	TArray<FName> Names;
+	// Keyed by display index and number so case variants stay distinct in editor builds.
+	TMap<TPair<FNameEntryId, int32>, int32> Indices;
+};
+
 struct FTurboStructLiteLoadWorkUnit
 {
 	int32 MetaIndex = 0;
@@ -238,6 +335,40 @@ struct FTurboStructLiteLoadWorkUnit
 	int32 ArrayCount = 0;
 };
 
+struct FTurboStructLiteLoadPlan;
+
+struct FTurboStructLiteLoadPlanField
+{
+	// Destination of the stored field; null when nothing matches and the field is skipped.
+	FProperty* TargetProp = nullptr;
+	// False routes the field through TryMigratePropertyValue.
+	bool bTypeMatch = false;
+	// Matching TArray of plain-old-data elements, copied with memcpy in parallel slices.
+	bool bPodArray = false;
+	int32 ElementSize = 0;
+	// Nested struct with stored children, applied field by field through its own plan.
+	TSharedPtr<const FTurboStructLiteLoadPlan> ChildPlan;
+};
+
+struct FTurboStructLiteLoadPlan
+{
+	// Struct and layout the plan was resolved against; a recompiled struct invalidates it.
+	TWeakObjectPtr<const UStruct> Struct;
+	const FField* FirstProperty = nullptr;
+	int32 PropertiesSize = 0;
+	// One entry per stored field, in stored order.
+	TArray<FTurboStructLiteLoadPlanField> Fields;
+};
+
+struct FTurboStructLiteZoneRange
+{
+	FString FieldName;
+	// Normalized type the value was saved with; summaries of migrated fields are not trusted.
+	FString FieldType;
+	double Min = 0.0;
+	double Max = 0.0;
+};
+
 struct FTurboStructLiteCachedEntry
 {
 	int64 DataOffset = 0;
@@ -247,6 +378,34 @@ struct FTurboStructLiteCachedEntry
 	int32 UncompressedSize = 0;
 	ETurboStructLiteCompression Compression = ETurboStructLiteCompression::None;
 	ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::None;
+	// Min/max of the scalar top-level fields; null when the entry has no summary.
+	TSharedPtr<const TArray<FTurboStructLiteZoneRange>> ZoneMap;
+};
+
+struct FTurboStructLiteGhashTable
+{
+	uint64 High[16] = {};
+	uint64 Low[16] = {};
+};
+
+struct FTurboStructLiteDerivedKey
+{
+	uint8 InputHash[32] = {};
+	uint8 Key[32] = {};
+	uint64 LastUse = 0;
+};
+
+struct FTurboStructLiteChunkedLayout
+{
+	uint8 Key[32] = {};
+	uint8 BaseIV[12] = {};
+	uint8 Flags = 0;
+	// Byte size of the prefix in front of the sealed header (depends on the payload tag).
+	int32 PrefixSize = 0;
+	int32 UncompressedSize = 0;
+	int32 ChunkSize = 0;
+	TArray<int32> ChunkSizes;
+	TArray<uint8> Header;
 };
 
 struct FTurboStructLiteSlotIndex
@@ -254,8 +413,61 @@ struct FTurboStructLiteSlotIndex
 	FDateTime Timestamp;
 	int64 FileSizeBytes = 0;
 	int32 EntryCount = 0;
+	int32 Version = 0;
+	int64 FooterOffset = 0;
 	TMap<int32, FTurboStructLiteCachedEntry> Entries;
 	TArray<int32> OrderedSubSlots;
+	// Schemas referenced by records of this slot, written to the schema block after the footer.
+	TArray<uint64> SchemaHashes;
+};
+
+struct FTurboStructLiteIndexKey
+{
+	double Value = 0.0;
+	int32 SubSlot = 0;
+};
+
+struct FTurboStructLiteIndexHashKey
+{
+	uint32 Hash = 0;
+	int32 SubSlot = 0;
+};
+
+struct FTurboStructLiteFieldIndex
+{
+	FString FieldPath;
+	// Numeric, enum and bool values ordered by Value.
+	TArray<FTurboStructLiteIndexKey> SortedKeys;
+	// Case-insensitive string/name hashes ordered by Hash.
+	TArray<FTurboStructLiteIndexHashKey> HashKeys;
+	// Subslots whose field could not be keyed; every lookup returns them.
+	TArray<int32> UnkeyedSubSlots;
+};
+
+struct FTurboStructLiteSlotCommitStamp
+{
+	// Slot file size (-1 when the slot does not exist).
+	int64 FileSize = -1;
+	// Footer offset the slot header points at.
+	int64 FooterOffset = -1;
+	// Header timestamp written by the slot's last commit.
+	int64 CommitTimestamp = -1;
+
+	bool operator==(const FTurboStructLiteSlotCommitStamp& Other) const
+	{
+		return FileSize == Other.FileSize && FooterOffset == Other.FooterOffset && CommitTimestamp == Other.CommitTimestamp;
+	}
+	bool operator!=(const FTurboStructLiteSlotCommitStamp& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+struct FTurboStructLiteSecondaryIndexSet
+{
+	// Slot commit when the sidecar was written; any other commit means the slot changed without it.
+	FTurboStructLiteSlotCommitStamp SlotStamp;
+	TArray<FTurboStructLiteFieldIndex> Indexes;
 };
 
 UENUM(BlueprintType)
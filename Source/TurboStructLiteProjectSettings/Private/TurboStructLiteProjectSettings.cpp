@@ -1,4 +1,5 @@
 #include "TurboStructLiteProjectSettings.h"
+#include "TurboStructLiteBPLibrary.h"
 
 UTurboStructLiteProjectSettings::UTurboStructLiteProjectSettings()
 {
@@ -10,4 +11,13 @@ FText UTurboStructLiteProjectSettings::GetSectionText() const
 	return NSLOCTEXT("TurboStructLiteProjectSettings", "SectionText", "TurboStructLite");
 }
 
-
+#if WITH_EDITOR
+void UTurboStructLiteProjectSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UTurboStructLiteProjectSettings, LegacyRedirects))
+	{
+		UTurboStructLiteBPLibrary::SetLegacyRedirects(LegacyRedirects);
+	}
+}
+#endif
@@ -42,6 +42,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Serialization")
 	TMap<FString, FString> LegacyRedirects;
 
+	// Per-frame budget for copying arrays before an async save; the copy spans several frames, so edits made meanwhile may or may not be saved.
+	UPROPERTY(EditAnywhere, config, Category = "Serialization", meta = (ClampMin = "0.0", Units = "ms"))
+	float AsyncSnapshotBudgetMs = 0.0f;
+
 	UPROPERTY(EditAnywhere, config, Category = "Logic Query")
 	int32 MaxQueryRecursionDepth = 100;
 
@@ -50,4 +54,7 @@ public:
 
 	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
 	virtual FText GetSectionText() const override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
@@ -0,0 +1,95 @@
+#include "TurboStructLiteQueryLibrary.h"
+#include "TurboStructLiteBPLibrary.h"
+#include "TurboStructLiteConstants.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/PrimaryAssetId.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTurboStructLiteSecondaryIndexQueryTest, "TurboStructLite.Query.SecondaryIndexPrunesAndInvalidates", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTurboStructLiteSecondaryIndexQueryTest::RunTest(const FString& Parameters)
+{
+	const FString SlotName = TEXT("TurboStructLiteSecondaryIndexTest");
+	const FString QueryString = TEXT("SELECT * WHERE PrimaryAssetName == \"Bravo\"");
+	UScriptStruct* IdStruct = TBaseStructure<FPrimaryAssetId>::Get();
+	TSharedPtr<FStructProperty> IdProp = MakeShared<FStructProperty>(FFieldVariant(), NAME_None, RF_NoFlags);
+	IdProp->Struct = IdStruct;
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+	IdProp->SetElementSize(IdStruct->GetStructureSize());
+#else
+	IdProp->ElementSize = IdStruct->GetStructureSize();
+#endif
+
+	auto RemoveSlotFiles = [&SlotName]()
+	{
+		IFileManager::Get().Delete(*UTurboStructLiteBPLibrary::BuildSavePath(SlotName), false, true, true);
+		IFileManager::Get().Delete(*UTurboStructLiteBPLibrary::BuildIndexPath(SlotName), false, true, true);
+		UTurboStructLiteBPLibrary::InvalidateSlotIndex(SlotName);
+	};
+	auto SaveId = [&SlotName, &IdProp](int32 SubSlot, const TCHAR* AssetName) -> bool
+	{
+		FPrimaryAssetId Id(FPrimaryAssetType(FName(TEXT("TurboStructLiteTest"))), FName(AssetName));
+		TArray<uint8> Bytes;
+		FString DebugMeta;
+		return UTurboStructLiteBPLibrary::SerializePropertyWithMeta(IdProp.Get(), &Id, Bytes, DebugMeta)
+			&& UTurboStructLiteBPLibrary::TurboStructLiteSaveSubSlotBytes(SlotName, SubSlot, FString(), ETurboStructLiteEncryption::None, ETurboStructLiteCompression::None, DebugMeta, Bytes);
+	};
+	// Zone maps never cover names, so the scanned count only drops when the index prunes.
+	auto CheckQuery = [this, &SlotName, &QueryString, IdStruct](const TCHAR* Label, int32 ExpectedScanned, int32 ExpectedMatched)
+	{
+		bool bHasAggregates = false;
+		FTurboStructLiteResultBuffer Results;
+		FString Metadata;
+		FDateTime SaveDate;
+		FString StatsText;
+		FString ErrorMessage;
+		const bool bExecuted = UTurboStructLiteQueryLibrary::ExecuteSelectQuery(SlotName, -1, QueryString, nullptr, TArray<FString>(), nullptr, FString(), ETurboStructLiteEncryption::None, 1, false, FString(), IdStruct, bHasAggregates, Results, Metadata, SaveDate, StatsText, ErrorMessage);
+		if (!TestTrue(FString::Printf(TEXT("%s: query runs (%s)"), Label, *ErrorMessage), bExecuted))
+		{
+			return;
+		}
+		const FString ExpectedStats = FString::Printf(TEXT("Scanned: %d, Matched: %d,"), ExpectedScanned, ExpectedMatched);
+		TestTrue(FString::Printf(TEXT("%s: expected \"%s\", got \"%s\""), Label, *ExpectedStats, *StatsText), StatsText.StartsWith(ExpectedStats));
+	};
+
+	RemoveSlotFiles();
+	const TArray<const TCHAR*> AssetNames = { TEXT("Alpha"), TEXT("Bravo"), TEXT("Charlie"), TEXT("Delta") };
+	for (int32 SubSlot = 0; SubSlot < AssetNames.Num(); ++SubSlot)
+	{
+		TestTrue(FString::Printf(TEXT("Subslot %d saved"), SubSlot), SaveId(SubSlot, AssetNames[SubSlot]));
+	}
+	CheckQuery(TEXT("Without an index"), 4, 1);
+
+	TestTrue(TEXT("Index created"), UTurboStructLiteBPLibrary::TurboStructLiteCreateIndex(SlotName, TEXT("PrimaryAssetName"), FString(), ETurboStructLiteEncryption::None));
+	TestTrue(TEXT("Indexed fields list the new index"), UTurboStructLiteBPLibrary::TurboStructLiteGetIndexedFields(SlotName) == TArray<FString>{ TEXT("PrimaryAssetName") });
+	CheckQuery(TEXT("Fresh index"), 1, 1);
+
+	// Saves through the library keep the index current.
+	TestTrue(TEXT("Subslot 2 overwritten"), SaveId(2, TEXT("Bravo")));
+	CheckQuery(TEXT("Index after a library save"), 2, 2);
+
+	// A rewrite behind the library's back with the same file size must still read as a new commit.
+	const FString SlotPath = UTurboStructLiteBPLibrary::BuildSavePath(SlotName);
+	TArray<uint8> SlotBytes;
+	if (TestTrue(TEXT("Slot file read"), FFileHelper::LoadFileToArray(SlotBytes, *SlotPath) && SlotBytes.Num() >= TurboStructLiteAppendHeaderSize))
+	{
+		SlotBytes[TurboStructLiteAppendHeaderCommitOffset] ^= 0x01;
+		TestTrue(TEXT("Slot file rewritten"), FFileHelper::SaveArrayToFile(SlotBytes, *SlotPath));
+		UTurboStructLiteBPLibrary::InvalidateSlotIndex(SlotName);
+		FTurboStructLiteSecondaryIndexSet IndexSet;
+		TestFalse(TEXT("Edited slot invalidates the index"), UTurboStructLiteBPLibrary::GetFreshSecondaryIndexes(SlotName, IndexSet));
+		CheckQuery(TEXT("Stale index"), 4, 2);
+	}
+
+	TestTrue(TEXT("Index dropped"), UTurboStructLiteBPLibrary::TurboStructLiteDropIndex(SlotName, TEXT("PrimaryAssetName")));
+	TestEqual(TEXT("No indexed fields after drop"), UTurboStructLiteBPLibrary::TurboStructLiteGetIndexedFields(SlotName).Num(), 0);
+	TestFalse(TEXT("Sidecar removed after drop"), FPaths::FileExists(UTurboStructLiteBPLibrary::BuildIndexPath(SlotName)));
+	RemoveSlotFiles();
+	return true;
+}
+
+#endif
@@ -0,0 +1,136 @@
+#include "TurboStructLiteQueryLibrary.h"
+#include "Math/NumericLimits.h"
+
+int32 UTurboStructLiteQueryLibrary::FindOrAddAggregateGroup(FTurboStructLiteAggregateTable& Table, const FString& GroupKey, int32 NumOps, bool& bOutAdded)
+{
+	bOutAdded = false;
+	if (const int32* Found = Table.GroupIndexByKey.Find(GroupKey))
+	{
+		return *Found;
+	}
+	const int32 GroupIndex = Table.GroupKeys.Add(GroupKey);
+	Table.GroupIndexByKey.Add(GroupKey, GroupIndex);
+	Table.States.AddDefaulted(NumOps);
+	bOutAdded = true;
+	return GroupIndex;
+}
+
+void UTurboStructLiteQueryLibrary::MergeAggregateTable(const FTurboStructLiteAggregateTable& Source, int32 NumOps, FTurboStructLiteAggregateTable& Dest)
+{
+	TArray<int32> NewRows;
+	for (int32 SourceIndex = 0; SourceIndex < Source.GroupKeys.Num(); ++SourceIndex)
+	{
+		bool bAdded = false;
+		const int32 DestIndex = FindOrAddAggregateGroup(Dest, Source.GroupKeys[SourceIndex], NumOps, bAdded);
+		if (bAdded)
+		{
+			NewRows.Add(SourceIndex);
+		}
+		for (int32 AggIndex = 0; AggIndex < NumOps; ++AggIndex)
+		{
+			const FTurboStructLiteAggregateState& From = Source.States[SourceIndex * NumOps + AggIndex];
+			FTurboStructLiteAggregateState& To = Dest.States[DestIndex * NumOps + AggIndex];
+			To.Count += From.Count;
+			To.Sum += From.Sum;
+			To.Min = FMath::Min(To.Min, From.Min);
+			To.Max = FMath::Max(To.Max, From.Max);
+			To.DistinctValues.Append(From.DistinctValues);
+		}
+	}
+	// New groups were numbered in the order they are appended here, so key rows stay aligned with group indices.
+	if (NewRows.Num() > 0)
+	{
+		AppendResultRows(Source.Keys, NewRows, Dest.Keys);
+	}
+}
+
+void UTurboStructLiteQueryLibrary::BuildAggregateResults(FTurboStructLiteQueryExecutionContext& Context)
+{
+	FTurboStructLiteAggregateTable& Table = Context.Aggregates;
+	const int32 NumOps = Context.ParsedAggregateOps.Num();
+	// Without GROUP BY an aggregate always yields one row, even when nothing matched.
+	if (!Context.bHasGroupBy && Table.GroupKeys.Num() == 0)
+	{
+		bool bAdded = false;
+		FindOrAddAggregateGroup(Table, FString(), NumOps, bAdded);
+		AddResultRow(Table.Keys);
+	}
+
+	FTurboStructLiteResultBuffer Output = MoveTemp(Table.Keys);
+	const int32 NumGroups = Table.GroupKeys.Num();
+	for (int32 AggIndex = 0; AggIndex < NumOps; ++AggIndex)
+	{
+		// Repeated aggregate names share the column of their first occurrence.
+		if (!Context.AggregateOutputColumns.IsValidIndex(AggIndex) || Context.AggregateOutputColumns[AggIndex] < Output.Columns.Num())
+		{
+			continue;
+		}
+		const ETurboStructLiteAggregateOp Op = Context.ParsedAggregateOps[AggIndex];
+		FTurboStructLiteResultColumn& Column = Output.Columns.AddDefaulted_GetRef();
+		Column.ColumnName = Context.ParsedAggregateColumns.IsValidIndex(AggIndex) ? Context.ParsedAggregateColumns[AggIndex] : NAME_None;
+		const bool bIntColumn = Op == ETurboStructLiteAggregateOp::Count || Op == ETurboStructLiteAggregateOp::CountDistinct;
+		Column.Type = bIntColumn ? ETurboStructLiteVariantType::Int : ETurboStructLiteVariantType::Float;
+		for (int32 GroupIndex = 0; GroupIndex < NumGroups; ++GroupIndex)
+		{
+			const FTurboStructLiteAggregateState& State = Table.States[GroupIndex * NumOps + AggIndex];
+			switch (Op)
+			{
+			case ETurboStructLiteAggregateOp::Count:
+				Column.Ints.Add(State.Count);
+				break;
+			case ETurboStructLiteAggregateOp::CountDistinct:
+				Column.Ints.Add(State.DistinctValues.Num());
+				break;
+			case ETurboStructLiteAggregateOp::Sum:
+				Column.Floats.Add(State.Sum);
+				break;
+			case ETurboStructLiteAggregateOp::Avg:
+				Column.Floats.Add(State.Count > 0 ? (State.Sum / static_cast<double>(State.Count)) : 0.0);
+				break;
+			case ETurboStructLiteAggregateOp::Min:
+				Column.Floats.Add(State.Count > 0 ? State.Min : 0.0);
+				break;
+			case ETurboStructLiteAggregateOp::Max:
+				Column.Floats.Add(State.Count > 0 ? State.Max : 0.0);
+				break;
+			}
+		}
+	}
+	Output.NumRows = NumGroups;
+	Context.Results = MoveTemp(Output);
+
+	Context.SortKeys.Reset();
+	if (!Context.bHasOrderBy)
+	{
+		return;
+	}
+	Context.SortKeys.SetNum(NumGroups);
+	for (int32 GroupIndex = 0; GroupIndex < NumGroups; ++GroupIndex)
+	{
+		FTurboStructLiteSortKey& Key = Context.SortKeys[GroupIndex];
+		Key.Sequence = GroupIndex;
+		for (int32 OrderIndex = 0; OrderIndex < Context.AggregateOrderColumns.Num(); ++OrderIndex)
+		{
+			const int32 ColumnIndex = Context.AggregateOrderColumns[OrderIndex];
+			if (!Context.Results.Columns.IsValidIndex(ColumnIndex))
+			{
+				continue;
+			}
+			const FTurboStructLiteResultColumn& Column = Context.Results.Columns[ColumnIndex];
+			if (Context.OrderIsString.IsValidIndex(OrderIndex) && Context.OrderIsString[OrderIndex])
+			{
+				FTurboStructLiteVariant Variant;
+				BuildVariantFromResult(Context.Results, ColumnIndex, GroupIndex, Variant);
+				Key.Strings.Add(MoveTemp(Variant.StringValue));
+			}
+			else if (Column.Type == ETurboStructLiteVariantType::Float)
+			{
+				Key.Numbers.Add(Column.Floats[GroupIndex]);
+			}
+			else
+			{
+				Key.Numbers.Add(static_cast<double>(Column.Ints[GroupIndex]));
+			}
+		}
+	}
+}
@@ -91,7 +91,7 @@ bool UTurboStructLiteQueryLibrary::BuildLogicQueryContextFromStruct(UStruct* Roo
 	return true;
 }
 
-bool UTurboStructLiteQueryLibrary::BindLogicQuery(TSharedPtr<FTurboStructLiteQueryNode>& Root, const FTurboStructLiteLogicQueryContext& Context, FString& OutErrorMessage, int32& OutErrorPos)
+bool UTurboStructLiteQueryLibrary::BindLogicQuery(TSharedPtr<FTurboStructLiteQueryNode>& Root, const FTurboStructLiteLogicQueryContext& Context, FString& OutErrorMessage, int32& OutErrorPos, bool bAllowParameters)
 {
 	if (!Root.IsValid())
 	{
@@ -438,10 +438,16 @@ bool UTurboStructLiteQueryLibrary::BindLogicQuery(TSharedPtr<FTurboStructLiteQue
 				return MakeTypeError(TEXT("CONTAINS is only valid for String/Array/Set/Map"), Node->Comparison.OperatorPosition);
 			}
 
+			// Parameters keep their placeholder until values are bound for an execution.
+			const bool bParameter = Node->Comparison.Rhs.Type == ETurboStructLiteQueryLiteralType::Parameter;
+			if (bParameter && !bAllowParameters)
+			{
+				return MakeError(TEXT("Query parameters ('?') require a prepared query"), Node->Comparison.LiteralPosition);
+			}
 			FTurboStructLiteQueryLiteral ConvertedLiteral;
 			if (Node->Comparison.Lhs.bIsContainer)
 			{
-				if (!ConvertLiteralForProperty(Node->Comparison.Lhs.ContainerElementProperty, Node->Comparison.Rhs, ConvertedLiteral, Node->Comparison.LiteralPosition, true))
+				if (!bParameter && !ConvertLiteralForProperty(Node->Comparison.Lhs.ContainerElementProperty, Node->Comparison.Rhs, ConvertedLiteral, Node->Comparison.LiteralPosition, true))
 				{
 					return false;
 				}
@@ -449,7 +455,7 @@ bool UTurboStructLiteQueryLibrary::BindLogicQuery(TSharedPtr<FTurboStructLiteQue
 			else
 			{
 				const bool bAllowNumeric = Node->Comparison.Op != ETurboStructLiteQueryCompareOp::Contains;
-				if (!ConvertLiteralForProperty(Leaf, Node->Comparison.Rhs, ConvertedLiteral, Node->Comparison.LiteralPosition, bAllowNumeric))
+				if (!bParameter && !ConvertLiteralForProperty(Leaf, Node->Comparison.Rhs, ConvertedLiteral, Node->Comparison.LiteralPosition, bAllowNumeric))
 				{
 					return false;
 				}
@@ -462,7 +468,10 @@ bool UTurboStructLiteQueryLibrary::BindLogicQuery(TSharedPtr<FTurboStructLiteQue
 					}
 				}
 			}
-			Node->Comparison.Rhs = MoveTemp(ConvertedLiteral);
+			if (!bParameter)
+			{
+				Node->Comparison.Rhs = MoveTemp(ConvertedLiteral);
+			}
 			return true;
 		}
 		if (Node->Left.IsValid())
@@ -482,7 +491,214 @@ bool UTurboStructLiteQueryLibrary::BindLogicQuery(TSharedPtr<FTurboStructLiteQue
 		return true;
 	};
 
-	return BindNode(Root);
+	Root->Program.Reset();
+	if (!BindNode(Root))
+	{
+		return false;
+	}
+	TSharedPtr<FTurboStructLiteQueryProgram> Program = MakeShared<FTurboStructLiteQueryProgram>();
+	if (CompileLogicQuery(*Root, *Program))
+	{
+		Root->Program = Program;
+	}
+	return true;
+}
+
+bool UTurboStructLiteQueryLibrary::CompileLogicQuery(const FTurboStructLiteQueryNode& Root, FTurboStructLiteQueryProgram& OutProgram)
+{
+	OutProgram.Instructions.Reset();
+
+	auto ResolveIntegerOpCode = [](const FProperty* Prop, ETurboStructLiteQueryOpCode& OutOpCode) -> bool
+	{
+		if (CastField<FInt8Property>(Prop))
+		{
+			OutOpCode = ETurboStructLiteQueryOpCode::CmpInt8;
+		}
+		else if (CastField<FByteProperty>(Prop))
+		{
+			OutOpCode = ETurboStructLiteQueryOpCode::CmpUInt8;
+		}
+		else if (CastField<FInt16Property>(Prop))
+		{
+			OutOpCode = ETurboStructLiteQueryOpCode::CmpInt16;
+		}
+		else if (CastField<FUInt16Property>(Prop))
+		{
+			OutOpCode = ETurboStructLiteQueryOpCode::CmpUInt16;
+		}
+		else if (CastField<FIntProperty>(Prop))
+		{
+			OutOpCode = ETurboStructLiteQueryOpCode::CmpInt32;
+		}
+		else if (CastField<FUInt32Property>(Prop))
+		{
+			OutOpCode = ETurboStructLiteQueryOpCode::CmpUInt32;
+		}
+		else if (CastField<FInt64Property>(Prop) || CastField<FUInt64Property>(Prop))
+		{
+			OutOpCode = ETurboStructLiteQueryOpCode::CmpInt64;
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	};
+
+	auto EmitComparison = [&](const FTurboStructLiteQueryNode& Node)
+	{
+		const FTurboStructLiteQueryComparison& Comparison = Node.Comparison;
+		const FTurboStructLiteQueryLiteral& Literal = Comparison.Rhs;
+		FTurboStructLiteQueryInstruction& Instruction = OutProgram.Instructions.AddDefaulted_GetRef();
+		Instruction.OpCode = ETurboStructLiteQueryOpCode::EvalNode;
+		Instruction.Op = Comparison.Op;
+		Instruction.Root = Comparison.Lhs.Root;
+		Instruction.Node = &Node;
+
+		const FProperty* Leaf = Comparison.Lhs.LeafProperty;
+		if (!Leaf || Comparison.Lhs.bIsContainer)
+		{
+			return;
+		}
+		int32 Offset = 0;
+		for (const FProperty* Prop : Comparison.Lhs.PropertyChain)
+		{
+			if (!Prop)
+			{
+				return;
+			}
+			Offset += Prop->GetOffset_ForInternal();
+		}
+		Instruction.Offset = Offset;
+
+		auto SetConstant = [&Instruction](bool bValue)
+		{
+			Instruction.OpCode = ETurboStructLiteQueryOpCode::Constant;
+			Instruction.IntValue = bValue ? 1 : 0;
+		};
+		const bool bEquality = Comparison.Op == ETurboStructLiteQueryCompareOp::Equal || Comparison.Op == ETurboStructLiteQueryCompareOp::NotEqual;
+
+		if (CastField<FStrProperty>(Leaf))
+		{
+			if (Literal.Type != ETurboStructLiteQueryLiteralType::String)
+			{
+				SetConstant(false);
+			}
+			else if (Comparison.Op == ETurboStructLiteQueryCompareOp::Contains)
+			{
+				Instruction.OpCode = ETurboStructLiteQueryOpCode::CmpStrContains;
+			}
+			else if (bEquality)
+			{
+				Instruction.OpCode = Comparison.Op == ETurboStructLiteQueryCompareOp::Equal ? ETurboStructLiteQueryOpCode::CmpStrEq : ETurboStructLiteQueryOpCode::CmpStrNe;
+			}
+			else
+			{
+				SetConstant(false);
+			}
+			Instruction.StringValue = Literal.StringValue;
+			return;
+		}
+		if (CastField<FNameProperty>(Leaf))
+		{
+			if (Literal.Type != ETurboStructLiteQueryLiteralType::Name || !bEquality)
+			{
+				SetConstant(false);
+				return;
+			}
+			Instruction.OpCode = Comparison.Op == ETurboStructLiteQueryCompareOp::Equal ? ETurboStructLiteQueryOpCode::CmpNameEq : ETurboStructLiteQueryOpCode::CmpNameNe;
+			Instruction.NameValue = Literal.NameValue;
+			return;
+		}
+		if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Leaf))
+		{
+			if (Literal.Type != ETurboStructLiteQueryLiteralType::Boolean || !bEquality)
+			{
+				SetConstant(false);
+				return;
+			}
+			Instruction.OpCode = ETurboStructLiteQueryOpCode::CmpBool;
+			Instruction.Offset += BoolProp->GetByteOffset();
+			Instruction.BoolMask = BoolProp->GetFieldMask();
+			Instruction.IntValue = Literal.BoolValue ? 1 : 0;
+			return;
+		}
+		if (const FNumericProperty* NumProp = CastField<FNumericProperty>(Leaf))
+		{
+			if (NumProp->IsFloatingPoint())
+			{
+				if (CastField<FFloatProperty>(Leaf))
+				{
+					Instruction.OpCode = ETurboStructLiteQueryOpCode::CmpFloat;
+				}
+				else if (CastField<FDoubleProperty>(Leaf))
+				{
+					Instruction.OpCode = ETurboStructLiteQueryOpCode::CmpDouble;
+				}
+				Instruction.FloatValue = (Literal.Type == ETurboStructLiteQueryLiteralType::Integer) ? static_cast<double>(Literal.IntValue) : Literal.FloatValue;
+				return;
+			}
+			if (Literal.Type == ETurboStructLiteQueryLiteralType::Integer && ResolveIntegerOpCode(Leaf, Instruction.OpCode))
+			{
+				Instruction.IntValue = Literal.IntValue;
+			}
+			return;
+		}
+		if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Leaf))
+		{
+			if (Literal.Type != ETurboStructLiteQueryLiteralType::Integer || !bEquality)
+			{
+				SetConstant(false);
+				return;
+			}
+			if (ResolveIntegerOpCode(EnumProp->GetUnderlyingProperty(), Instruction.OpCode))
+			{
+				Instruction.IntValue = Literal.IntValue;
+			}
+		}
+	};
+
+	TFunction<bool(const FTurboStructLiteQueryNode&)> EmitNode;
+	EmitNode = [&](const FTurboStructLiteQueryNode& Node) -> bool
+	{
+		switch (Node.Type)
+		{
+			case ETurboStructLiteQueryNodeType::And:
+			case ETurboStructLiteQueryNodeType::Or:
+			{
+				if (!Node.Left.IsValid() || !Node.Right.IsValid() || !EmitNode(*Node.Left))
+				{
+					return false;
+				}
+				// Short-circuit: skip the right side when the left side already decides the result.
+				const int32 JumpIndex = OutProgram.Instructions.AddDefaulted();
+				OutProgram.Instructions[JumpIndex].OpCode = Node.Type == ETurboStructLiteQueryNodeType::And ? ETurboStructLiteQueryOpCode::JumpIfFalse : ETurboStructLiteQueryOpCode::JumpIfTrue;
+				if (!EmitNode(*Node.Right))
+				{
+					return false;
+				}
+				OutProgram.Instructions[JumpIndex].JumpTarget = OutProgram.Instructions.Num();
+				return true;
+			}
+			case ETurboStructLiteQueryNodeType::Not:
+			{
+				if (!Node.Left.IsValid() || !EmitNode(*Node.Left))
+				{
+					return false;
+				}
+				OutProgram.Instructions.AddDefaulted_GetRef().OpCode = ETurboStructLiteQueryOpCode::Not;
+				return true;
+			}
+			case ETurboStructLiteQueryNodeType::Comparison:
+				EmitComparison(Node);
+				return true;
+			default:
+				OutProgram.Instructions.AddDefaulted();
+				return true;
+		}
+	};
+
+	return EmitNode(Root);
 }
 
 void UTurboStructLiteQueryLibrary::CollectQueryBoundProperties(const TSharedPtr<FTurboStructLiteQueryNode>& Root, TArray<const FTurboStructLiteQueryBoundProperty*>& OutProperties)
@@ -0,0 +1,111 @@
+#include "TurboStructLiteQueryLibrary.h"
+#include "TurboStructLiteBPLibrary.h"
+#include "TurboStructLite.h"
+#include "UObject/Stack.h"
+#include "UObject/UnrealType.h"
+#include "TurboStructLiteDebugMacros.h"
+
+bool UTurboStructLiteQueryLibrary::TurboStructLiteOpenQueryCursor(const FString& MainSlotName, int32 SubSlotIndex, const FString& QueryString, int32 PageSize, FTurboStructLiteQueryCursor& OutCursor, FString& OutErrorMessage, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_OpenQueryCursor"));
+	OutCursor = FTurboStructLiteQueryCursor();
+	OutErrorMessage.Reset();
+	if (MainSlotName.IsEmpty() || SubSlotIndex < -1)
+	{
+		OutErrorMessage = TEXT("IO Error: Invalid slot parameters");
+		return false;
+	}
+	if (PageSize <= 0)
+	{
+		OutErrorMessage = TEXT("Query Error: Cursor page size must be positive");
+		return false;
+	}
+	FString TrimmedQuery = QueryString;
+	TrimmedQuery.TrimStartAndEndInline();
+	if (!TrimmedQuery.StartsWith(TEXT("SELECT"), ESearchCase::IgnoreCase))
+	{
+		OutErrorMessage = TEXT("Syntax Error: Cursor queries must be SELECT statements");
+		return false;
+	}
+	UStruct* ContextStruct = nullptr;
+	if (!ResolveContextStructFromSlot(MainSlotName, SubSlotIndex, EncryptionKey, Encryption, ContextStruct, OutErrorMessage))
+	{
+		return false;
+	}
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan;
+	if (!GetQueryPlan(QueryString, ContextStruct, Plan, OutErrorMessage))
+	{
+		return false;
+	}
+	if (Plan->bHasAggregates || Plan->bHasOrderBy || Plan->ParsedLimit > 0 || Plan->ParsedOffset > 0)
+	{
+		OutErrorMessage = TEXT("Query Error: Cursor queries cannot use aggregates, GROUP BY, ORDER BY, LIMIT or OFFSET");
+		return false;
+	}
+	if (Plan->ParameterCount > 0)
+	{
+		OutErrorMessage = TEXT("Binder Error: Cursor queries cannot use '?' parameters");
+		return false;
+	}
+	OutCursor.SlotName = MainSlotName;
+	OutCursor.SubSlotIndex = SubSlotIndex;
+	OutCursor.QueryString = QueryString;
+	OutCursor.PageSize = PageSize;
+	OutCursor.bIsValid = true;
+	OutCursor.Plan = Plan;
+	return true;
+}
+
+DEFINE_FUNCTION(UTurboStructLiteQueryLibrary::execTurboStructLiteFetchQueryPage)
+{
+	P_GET_STRUCT_REF(FTurboStructLiteQueryCursor, Cursor);
+	P_GET_UBOOL(bAsync);
+
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FArrayProperty>(nullptr);
+	FProperty* DataProp = Stack.MostRecentProperty;
+	void* DataPtr = Stack.MostRecentPropertyAddress;
+
+	P_GET_PROPERTY(FDelegateProperty, OnComplete);
+	P_GET_UBOOL(bUseWriteAheadLog);
+	P_GET_PROPERTY(FIntProperty, QueuePriority);
+	P_GET_PROPERTY(FIntProperty, MaxParallelThreads);
+	P_GET_PROPERTY(FStrProperty, EncryptionKey);
+	P_GET_ENUM(ETurboStructLiteEncryption, Encryption);
+	P_GET_ENUM(ETurboStructLiteBatchingSetting, CompressionBatching);
+
+	P_FINISH;
+
+	FTurboStructLiteLogicLoadComplete LoadDelegate;
+	if (OnComplete.IsBound())
+	{
+		LoadDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
+	}
+
+	const int32 SaveVersion = UTurboStructLiteBPLibrary::GetVersion();
+	FArrayProperty* ArrayProp = CastField<FArrayProperty>(DataProp);
+	if (!ArrayProp || !DataPtr)
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLiteFetchQueryPage: Invalid data type"), ELogVerbosity::Error);
+		LoadDelegate.ExecuteIfBound(false, TEXT("Type Error: Data must be an array"), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
+	if (!Cursor.bIsValid || Cursor.SlotName.IsEmpty())
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLiteFetchQueryPage: Cursor is not open"), ELogVerbosity::Error);
+		LoadDelegate.ExecuteIfBound(false, TEXT("Binder Error: Cursor is not open"), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
+	if (Cursor.bFinished)
+	{
+		// Past the last page: hand back an empty page without touching the slot file.
+		FScriptArrayHelper Helper(ArrayProp, DataPtr);
+		Helper.EmptyValues();
+		LoadDelegate.ExecuteIfBound(true, FString(), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
+
+	UTurboStructLiteBPLibrary::BeginMemoryOpMessage(Cursor.SlotName, Cursor.SubSlotIndex, false, true);
+	EnqueueSelectLogicLoad(Cursor.SlotName, Cursor.SubSlotIndex, bAsync, Cursor.QueryString, Cursor.Plan, TArray<FString>(), &Cursor, DataProp, DataPtr, LoadDelegate, bUseWriteAheadLog, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), CompressionBatching, SaveVersion);
+}
@@ -29,6 +29,167 @@
 #include "Misc/Guid.h"
 #include "TurboStructLiteDebugMacros.h"
 
+bool UTurboStructLiteQueryLibrary::EvaluateLogicQuery(const FTurboStructLiteQueryNode& Root, const uint8* RootPtr, const uint8* KeyPtr, const uint8* ValuePtr)
+{
+	if (Root.Program.IsValid())
+	{
+		return EvaluateLogicQueryProgram(*Root.Program, RootPtr, KeyPtr, ValuePtr);
+	}
+	return EvaluateLogicQueryNode(Root, RootPtr, KeyPtr, ValuePtr);
+}
+
+bool UTurboStructLiteQueryLibrary::EvaluateLogicQueryProgram(const FTurboStructLiteQueryProgram& Program, const uint8* RootPtr, const uint8* KeyPtr, const uint8* ValuePtr)
+{
+	const FTurboStructLiteQueryInstruction* Instructions = Program.Instructions.GetData();
+	const int32 Count = Program.Instructions.Num();
+	bool bResult = false;
+	int32 Pc = 0;
+	while (Pc < Count)
+	{
+		const FTurboStructLiteQueryInstruction& Instruction = Instructions[Pc++];
+		switch (Instruction.OpCode)
+		{
+			case ETurboStructLiteQueryOpCode::JumpIfFalse:
+				if (!bResult)
+				{
+					Pc = Instruction.JumpTarget;
+				}
+				continue;
+			case ETurboStructLiteQueryOpCode::JumpIfTrue:
+				if (bResult)
+				{
+					Pc = Instruction.JumpTarget;
+				}
+				continue;
+			case ETurboStructLiteQueryOpCode::Not:
+				bResult = !bResult;
+				continue;
+			case ETurboStructLiteQueryOpCode::Constant:
+				bResult = Instruction.IntValue != 0;
+				continue;
+			case ETurboStructLiteQueryOpCode::EvalNode:
+				bResult = Instruction.Node && EvaluateLogicQueryNode(*Instruction.Node, RootPtr, KeyPtr, ValuePtr);
+				continue;
+			default:
+				break;
+		}
+
+		const uint8* BasePtr = RootPtr;
+		if (Instruction.Root == ETurboStructLiteQueryValueRoot::MapKey)
+		{
+			BasePtr = KeyPtr;
+		}
+		else if (Instruction.Root == ETurboStructLiteQueryValueRoot::MapValue)
+		{
+			BasePtr = ValuePtr;
+		}
+		if (!BasePtr)
+		{
+			bResult = false;
+			continue;
+		}
+		const uint8* Ptr = BasePtr + Instruction.Offset;
+
+		auto CompareInt = [&Instruction](int64 Value) -> bool
+		{
+			switch (Instruction.Op)
+			{
+				case ETurboStructLiteQueryCompareOp::Equal:
+					return Value == Instruction.IntValue;
+				case ETurboStructLiteQueryCompareOp::NotEqual:
+					return Value != Instruction.IntValue;
+				case ETurboStructLiteQueryCompareOp::Greater:
+					return Value > Instruction.IntValue;
+				case ETurboStructLiteQueryCompareOp::Less:
+					return Value < Instruction.IntValue;
+				case ETurboStructLiteQueryCompareOp::GreaterEqual:
+					return Value >= Instruction.IntValue;
+				case ETurboStructLiteQueryCompareOp::LessEqual:
+					return Value <= Instruction.IntValue;
+				default:
+					return false;
+			}
+		};
+
+		auto CompareFloat = [&Instruction](double Value) -> bool
+		{
+			switch (Instruction.Op)
+			{
+				case ETurboStructLiteQueryCompareOp::Equal:
+					return Value == Instruction.FloatValue;
+				case ETurboStructLiteQueryCompareOp::NotEqual:
+					return Value != Instruction.FloatValue;
+				case ETurboStructLiteQueryCompareOp::Greater:
+					return Value > Instruction.FloatValue;
+				case ETurboStructLiteQueryCompareOp::Less:
+					return Value < Instruction.FloatValue;
+				case ETurboStructLiteQueryCompareOp::GreaterEqual:
+					return Value >= Instruction.FloatValue;
+				case ETurboStructLiteQueryCompareOp::LessEqual:
+					return Value <= Instruction.FloatValue;
+				default:
+					return false;
+			}
+		};
+
+		switch (Instruction.OpCode)
+		{
+			case ETurboStructLiteQueryOpCode::CmpInt8:
+				bResult = CompareInt(*reinterpret_cast<const int8*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpUInt8:
+				bResult = CompareInt(*Ptr);
+				break;
+			case ETurboStructLiteQueryOpCode::CmpInt16:
+				bResult = CompareInt(*reinterpret_cast<const int16*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpUInt16:
+				bResult = CompareInt(*reinterpret_cast<const uint16*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpInt32:
+				bResult = CompareInt(*reinterpret_cast<const int32*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpUInt32:
+				bResult = CompareInt(*reinterpret_cast<const uint32*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpInt64:
+				bResult = CompareInt(*reinterpret_cast<const int64*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpFloat:
+				bResult = CompareFloat(*reinterpret_cast<const float*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpDouble:
+				bResult = CompareFloat(*reinterpret_cast<const double*>(Ptr));
+				break;
+			case ETurboStructLiteQueryOpCode::CmpBool:
+			{
+				const int64 Value = (*Ptr & Instruction.BoolMask) != 0 ? 1 : 0;
+				bResult = Instruction.Op == ETurboStructLiteQueryCompareOp::Equal ? Value == Instruction.IntValue : Value != Instruction.IntValue;
+				break;
+			}
+			case ETurboStructLiteQueryOpCode::CmpStrEq:
+				bResult = *reinterpret_cast<const FString*>(Ptr) == Instruction.StringValue;
+				break;
+			case ETurboStructLiteQueryOpCode::CmpStrNe:
+				bResult = *reinterpret_cast<const FString*>(Ptr) != Instruction.StringValue;
+				break;
+			case ETurboStructLiteQueryOpCode::CmpStrContains:
+				bResult = reinterpret_cast<const FString*>(Ptr)->Contains(Instruction.StringValue, ESearchCase::CaseSensitive);
+				break;
+			case ETurboStructLiteQueryOpCode::CmpNameEq:
+				bResult = *reinterpret_cast<const FName*>(Ptr) == Instruction.NameValue;
+				break;
+			case ETurboStructLiteQueryOpCode::CmpNameNe:
+				bResult = *reinterpret_cast<const FName*>(Ptr) != Instruction.NameValue;
+				break;
+			default:
+				bResult = false;
+				break;
+		}
+	}
+	return bResult;
+}
+
 bool UTurboStructLiteQueryLibrary::EvaluateLogicQueryNode(const FTurboStructLiteQueryNode& Root, const uint8* RootPtr, const uint8* KeyPtr, const uint8* ValuePtr)
 {
 	auto ResolvePtr = [&](const FTurboStructLiteQueryBoundProperty& Bound, const uint8*& OutPtr, const FProperty*& OutProp) -> bool
@@ -302,7 +463,7 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 	{
 		OutStats.Scanned = 1;
 		const uint8* BasePtr = SourceValueBuffer.GetData();
-		const bool bMatch = EvaluateLogicQueryNode(*Root, BasePtr, nullptr, nullptr);
+		const bool bMatch = EvaluateLogicQuery(*Root, BasePtr, nullptr, nullptr);
 		OutStats.Matched = bMatch ? 1 : 0;
 		const int32 ValueSize = StructProp->GetSize();
 		OutValueBuffer.SetNumUninitialized(ValueSize);
@@ -328,6 +489,69 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 		const int32 ElementSize = ArrayProp->Inner->GetSize();
 		const int64 EstimatedBytes = static_cast<int64>(Num) * ElementSize;
 		const bool bParallel = EstimatedBytes >= TurboStructLiteQueryParallelMinBytes && Num > 1 && MaxThreads > 1;
+
+		// Numeric predicates on fixed offsets are evaluated block-wise into a selection bitmap, then matches are compacted in order.
+		FTurboStructLiteVectorPredicate VectorPredicate;
+		if (Num >= TurboStructLiteQueryVectorMinElements && BuildVectorPredicate(*Root, VectorPredicate))
+		{
+			const int32 WordCount = FMath::DivideAndRoundUp(Num, TurboStructLiteQueryVectorBlockSize);
+			TArray<uint64> Selection;
+			Selection.SetNumZeroed(WordCount);
+			const uint8* SourceData = SourceHelper.GetRawPtr(0);
+			if (bParallel)
+			{
+				const int32 TaskCount = FMath::Min(MaxThreads, WordCount);
+				const int32 WordsPerTask = FMath::DivideAndRoundUp(WordCount, TaskCount);
+				ParallelFor(TaskCount, [&](int32 TaskIndex)
+				{
+					const int32 FirstWord = TaskIndex * WordsPerTask;
+					const int32 LastWord = FMath::Min(FirstWord + WordsPerTask, WordCount);
+					if (FirstWord >= LastWord)
+					{
+						return;
+					}
+					const int32 Start = FirstWord * TurboStructLiteQueryVectorBlockSize;
+					const int32 End = FMath::Min(LastWord * TurboStructLiteQueryVectorBlockSize, Num);
+					EvaluateVectorPredicate(VectorPredicate, SourceData + static_cast<SIZE_T>(Start) * ElementSize, ElementSize, End - Start, Selection.GetData() + FirstWord);
+				});
+			}
+			else
+			{
+				EvaluateVectorPredicate(VectorPredicate, SourceData, ElementSize, Num, Selection.GetData());
+			}
+
+			int32 MatchCount = 0;
+			for (const uint64 Word : Selection)
+			{
+				MatchCount += static_cast<int32>(FMath::CountBits(Word));
+			}
+			if (MatchCount > 0)
+			{
+				const bool bPlainData = ArrayProp->Inner->HasAnyPropertyFlags(CPF_IsPlainOldData);
+				int32 OutIndex = bPlainData ? OutHelper.AddUninitializedValues(MatchCount) : OutHelper.AddValues(MatchCount);
+				for (int32 Word = 0; Word < WordCount; ++Word)
+				{
+					uint64 Bits = Selection[Word];
+					while (Bits)
+					{
+						const int32 Index = Word * TurboStructLiteQueryVectorBlockSize + static_cast<int32>(FMath::CountTrailingZeros64(Bits));
+						Bits &= Bits - 1;
+						if (bPlainData)
+						{
+							FMemory::Memcpy(OutHelper.GetRawPtr(OutIndex), SourceHelper.GetRawPtr(Index), ElementSize);
+						}
+						else
+						{
+							ArrayProp->Inner->CopyCompleteValue(OutHelper.GetRawPtr(OutIndex), SourceHelper.GetRawPtr(Index));
+						}
+						++OutIndex;
+					}
+				}
+			}
+			OutStats.Matched = MatchCount;
+			return true;
+		}
+
 		if (bParallel)
 		{
 			const int32 TaskCount = FMath::Min(MaxThreads, Num);
@@ -346,7 +570,7 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 				for (int32 Index = Start; Index < End; ++Index)
 				{
 					const uint8* ElemPtr = SourceHelper.GetRawPtr(Index);
-					if (EvaluateLogicQueryNode(*Root, ElemPtr, nullptr, nullptr))
+					if (EvaluateLogicQuery(*Root, ElemPtr, nullptr, nullptr))
 					{
 						Buckets[TaskIndex].Indices.Add(Index);
 					}
@@ -368,7 +592,7 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 		for (int32 Index = 0; Index < Num; ++Index)
 		{
 			const uint8* ElemPtr = SourceHelper.GetRawPtr(Index);
-			if (EvaluateLogicQueryNode(*Root, ElemPtr, nullptr, nullptr))
+			if (EvaluateLogicQuery(*Root, ElemPtr, nullptr, nullptr))
 			{
 				const int32 NewIndex = OutHelper.AddValue();
 				ArrayProp->Inner->CopyCompleteValue(OutHelper.GetRawPtr(NewIndex), SourceHelper.GetRawPtr(Index));
@@ -420,7 +644,7 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 				{
 					const int32 SourceIndex = ValidIndices[LocalIndex];
 					const uint8* ElemPtr = SourceHelper.GetElementPtr(SourceIndex);
-					if (EvaluateLogicQueryNode(*Root, ElemPtr, nullptr, nullptr))
+					if (EvaluateLogicQuery(*Root, ElemPtr, nullptr, nullptr))
 					{
 						Buckets[TaskIndex].Indices.Add(SourceIndex);
 					}
@@ -441,7 +665,7 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 		for (int32 Index : ValidIndices)
 		{
 			const uint8* ElemPtr = SourceHelper.GetElementPtr(Index);
-			if (EvaluateLogicQueryNode(*Root, ElemPtr, nullptr, nullptr))
+			if (EvaluateLogicQuery(*Root, ElemPtr, nullptr, nullptr))
 			{
 				OutHelper.AddElement(SourceHelper.GetElementPtr(Index));
 				OutStats.Matched++;
@@ -494,7 +718,7 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 					const uint8* KeyPtr = SourceHelper.GetKeyPtr(SourceIndex);
 					const uint8* ValuePtr = SourceHelper.GetValuePtr(SourceIndex);
 					const uint8* RootPtr = ValuePtr;
-					if (EvaluateLogicQueryNode(*Root, RootPtr, KeyPtr, ValuePtr))
+					if (EvaluateLogicQuery(*Root, RootPtr, KeyPtr, ValuePtr))
 					{
 						Buckets[TaskIndex].Indices.Add(SourceIndex);
 					}
@@ -517,7 +741,7 @@ bool UTurboStructLiteQueryLibrary::ApplyLogicFilter(FProperty* DataProp, const T
 			const uint8* KeyPtr = SourceHelper.GetKeyPtr(Index);
 			const uint8* ValuePtr = SourceHelper.GetValuePtr(Index);
 			const uint8* RootPtr = ValuePtr;
-			if (EvaluateLogicQueryNode(*Root, RootPtr, KeyPtr, ValuePtr))
+			if (EvaluateLogicQuery(*Root, RootPtr, KeyPtr, ValuePtr))
 			{
 				OutHelper.AddPair(SourceHelper.GetKeyPtr(Index), SourceHelper.GetValuePtr(Index));
 				OutStats.Matched++;
@@ -557,243 +781,578 @@ bool UTurboStructLiteQueryLibrary::DeserializeLogicValue(FProperty* DataProp, co
 	return true;
 }
 
-FString UTurboStructLiteQueryLibrary::FormatLogicStats(const FTurboStructLiteLogicQueryStats& Stats)
-{
-	return FString::Printf(TEXT("Scanned: %d, Matched: %d, Time: %.2fms"), Stats.Scanned, Stats.Matched, Stats.ElapsedMs);
-}
-
-bool UTurboStructLiteQueryLibrary::ApplyRowToStruct(const FTurboStructLiteRow& Row, UStruct* Struct, void* StructPtr, FString& OutErrorMessage)
+bool UTurboStructLiteQueryLibrary::DeserializeLogicValueProjected(FStructProperty* StructProp, const TArray<uint8>& RawBytes, const TArray<TArray<FProperty*>>& Chains, int32 MaxThreads, TArray<uint8>& OutValueBuffer, FString& OutErrorMessage)
 {
+	OutValueBuffer.Reset();
 	OutErrorMessage.Reset();
-	if (!Struct || !StructPtr)
+	if (!StructProp)
 	{
-		OutErrorMessage = TEXT("Type Error: Invalid struct output");
+		OutErrorMessage = TEXT("Type Error: Invalid data property");
 		return false;
 	}
-	auto FindPropertyByName = [&](UStruct* InStruct, const FString& Segment) -> FProperty*
+
+	TArray<FTurboStructLiteFieldMeta> Fields;
+	const uint8* DataPtr = nullptr;
+	int32 DataLen = 0;
+	FString MetaError;
+	FTurboStructLiteNameTable NameTable;
+	const TArray<FTurboStructLiteFieldMeta>* StructFields = nullptr;
+	if (UTurboStructLiteBPLibrary::ReadMetaFromBytes(RawBytes, Fields, DataPtr, DataLen, MetaError, &NameTable))
 	{
-		if (!InStruct)
-		{
-			return nullptr;
-		}
-		FProperty* Found = FindFProperty<FProperty>(InStruct, *Segment);
-		if (Found)
-		{
-			return Found;
-		}
-		FProperty* Match = nullptr;
-		for (TFieldIterator<FProperty> It(InStruct); It; ++It)
-		{
-			FProperty* Prop = *It;
-			const FString DisplayName = Prop->GetDisplayNameText().ToString();
-			if (DisplayName.Equals(Segment, ESearchCase::IgnoreCase))
-			{
-				if (Match)
-				{
-					return nullptr;
-				}
-				Match = Prop;
-			}
-		}
-		return Match;
-	};
-	for (const TPair<FName, FTurboStructLiteVariant>& Pair : Row.Columns)
+		StructFields = UTurboStructLiteBPLibrary::ResolveStructMetaFields(Fields, StructProp);
+	}
+
+	TArray<int32> SliceOffsets;
+	TArray<int32> SliceSizes;
+	SliceOffsets.Reserve(Chains.Num());
+	SliceSizes.Reserve(Chains.Num());
+	bool bResolved = StructFields != nullptr;
+	for (int32 ChainIndex = 0; bResolved && ChainIndex < Chains.Num(); ++ChainIndex)
 	{
-		FString ColumnName = Pair.Key.ToString();
-		ColumnName.TrimStartAndEndInline();
-		if (ColumnName.IsEmpty())
+		int32 SliceOffset = 0;
+		const FTurboStructLiteFieldMeta* Meta = nullptr;
+		if (!UTurboStructLiteBPLibrary::FindMetaByPropertyChain(*StructFields, Chains[ChainIndex], SliceOffset, Meta) || !Meta || Meta->Size < 0 || static_cast<int64>(SliceOffset) + Meta->Size > DataLen)
 		{
-			continue;
+			bResolved = false;
+			break;
 		}
-		TArray<FString> Segments;
-		ColumnName.ParseIntoArray(Segments, TEXT("."), true);
-		if (Segments.Num() == 0)
+		SliceOffsets.Add(SliceOffset);
+		SliceSizes.Add(Meta->Size);
+	}
+	if (!bResolved)
+	{
+		// Renamed, retyped or missing fields need the migration-aware full load.
+		return DeserializeLogicValue(StructProp, RawBytes, MaxThreads, OutValueBuffer, OutErrorMessage);
+	}
+
+	const int32 ValueSize = StructProp->GetSize();
+	if (ValueSize <= 0)
+	{
+		OutErrorMessage = TEXT("Type Error: Invalid data size");
+		return false;
+	}
+	OutValueBuffer.SetNumUninitialized(ValueSize);
+	StructProp->InitializeValue(OutValueBuffer.GetData());
+	FMemoryReader VersionSource(RawBytes, true);
+	FScopedNameTableLite NameGuard(NameTable.Names.Num() > 0 ? &NameTable : nullptr);
+	for (int32 ChainIndex = 0; ChainIndex < Chains.Num(); ++ChainIndex)
+	{
+		if (SliceSizes[ChainIndex] == 0)
 		{
 			continue;
 		}
-		UStruct* CurrentStruct = Struct;
-		uint8* CurrentPtr = static_cast<uint8*>(StructPtr);
-		FProperty* TargetProp = nullptr;
-		for (int32 Index = 0; Index < Segments.Num(); ++Index)
-		{
-			FProperty* Found = FindPropertyByName(CurrentStruct, Segments[Index]);
-			if (!Found)
-			{
-				TargetProp = nullptr;
-				break;
-			}
-			CurrentPtr = Found->ContainerPtrToValuePtr<uint8>(CurrentPtr);
-			if (Index < Segments.Num() - 1)
-			{
-				FStructProperty* NextStruct = CastField<FStructProperty>(Found);
-				if (!NextStruct)
-				{
-					TargetProp = nullptr;
-					break;
-				}
-				CurrentStruct = NextStruct->Struct;
-			}
-			else
-			{
-				TargetProp = Found;
-			}
-		}
-		if (!TargetProp || !CurrentPtr)
+		const TArray<FProperty*>& Chain = Chains[ChainIndex];
+		uint8* TargetPtr = OutValueBuffer.GetData();
+		for (FProperty* Prop : Chain)
 		{
-			continue;
+			TargetPtr = Prop->ContainerPtrToValuePtr<uint8>(TargetPtr);
 		}
-		if (!UTurboStructLiteBPLibrary::TryApplyVariantToProperty(TargetProp, CurrentPtr, Pair.Value))
+		if (!UTurboStructLiteBPLibrary::DeserializePropertyFromSlice(Chain.Last(), TargetPtr, DataPtr + SliceOffsets[ChainIndex], SliceSizes[ChainIndex], false, VersionSource))
 		{
-			OutErrorMessage = TEXT("Type Error: Failed to apply query result");
+			StructProp->DestroyValue(OutValueBuffer.GetData());
+			OutValueBuffer.Reset();
+			OutErrorMessage = TEXT("IO Error: Failed to deserialize data");
 			return false;
 		}
 	}
 	return true;
 }
 
-bool UTurboStructLiteQueryLibrary::ApplyRowsToOutput(const TArray<FTurboStructLiteRow>& Rows, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage)
+void UTurboStructLiteQueryLibrary::BuildQueryProjection(FTurboStructLiteQueryExecutionContext& Context)
 {
-	OutErrorMessage.Reset();
-	if (!OutputProp || !OutputPtr)
-	{
-		OutErrorMessage = TEXT("Type Error: Invalid output");
-		return false;
-	}
-	if (FStructProperty* StructProp = CastField<FStructProperty>(OutputProp))
+	Context.ProjectionChains.Reset();
+	Context.bUseProjection = false;
+	if (!Context.ContextStructProp || !Context.ContextStructProp->Struct)
 	{
-		TArray<uint8> TempValue;
-		TempValue.SetNumUninitialized(StructProp->GetSize());
-		StructProp->InitializeValue(TempValue.GetData());
-		if (Rows.Num() > 0)
-		{
-			if (!ApplyRowToStruct(Rows[0], StructProp->Struct, TempValue.GetData(), OutErrorMessage))
-			{
-				StructProp->DestroyValue(TempValue.GetData());
-				return false;
-			}
-		}
-		StructProp->CopyCompleteValue(OutputPtr, TempValue.GetData());
-		StructProp->DestroyValue(TempValue.GetData());
-		return true;
+		return;
 	}
-	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(OutputProp))
+
+	auto AddChain = [&Context](const TArray<FProperty*>& Chain)
 	{
-		FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner);
-		if (!InnerStruct)
+		if (Chain.Num() == 0)
 		{
-			OutErrorMessage = TEXT("Type Error: Array output must be struct");
-			return false;
+			return;
 		}
-		ArrayProp->DestroyValue(OutputPtr);
-		ArrayProp->InitializeValue(OutputPtr);
-		FScriptArrayHelper Helper(ArrayProp, OutputPtr);
-		for (const FTurboStructLiteRow& Row : Rows)
+		for (int32 Index = Context.ProjectionChains.Num() - 1; Index >= 0; --Index)
 		{
-			TArray<uint8> TempValue;
-			TempValue.SetNumUninitialized(InnerStruct->GetSize());
-			InnerStruct->InitializeValue(TempValue.GetData());
-			if (!ApplyRowToStruct(Row, InnerStruct->Struct, TempValue.GetData(), OutErrorMessage))
+			const TArray<FProperty*>& Existing = Context.ProjectionChains[Index];
+			const int32 SharedNum = FMath::Min(Existing.Num(), Chain.Num());
+			bool bSharesPrefix = true;
+			for (int32 PropIndex = 0; PropIndex < SharedNum; ++PropIndex)
 			{
-				InnerStruct->DestroyValue(TempValue.GetData());
-				return false;
+				if (Existing[PropIndex] != Chain[PropIndex])
+				{
+					bSharesPrefix = false;
+					break;
+				}
 			}
-			const int32 NewIndex = Helper.AddValue();
-			ArrayProp->Inner->CopyCompleteValue(Helper.GetRawPtr(NewIndex), TempValue.GetData());
-			InnerStruct->DestroyValue(TempValue.GetData());
+			if (!bSharesPrefix)
+			{
+				continue;
+			}
+			if (Existing.Num() <= Chain.Num())
+			{
+				return;
+			}
+			Context.ProjectionChains.RemoveAtSwap(Index);
 		}
-		return true;
-	}
-	if (FSetProperty* SetProp = CastField<FSetProperty>(OutputProp))
+		Context.ProjectionChains.Add(Chain);
+	};
+
+	TArray<const FTurboStructLiteQueryBoundProperty*> BoundProperties;
+	CollectQueryBoundProperties(Context.Root, BoundProperties);
+	for (const FTurboStructLiteQueryBoundProperty* Bound : BoundProperties)
 	{
-		FStructProperty* InnerStruct = CastField<FStructProperty>(SetProp->ElementProp);
-		if (!InnerStruct)
-		{
-			OutErrorMessage = TEXT("Type Error: Set output must be struct");
-			return false;
-		}
-		SetProp->DestroyValue(OutputPtr);
-		SetProp->InitializeValue(OutputPtr);
-		FScriptSetHelper Helper(SetProp, OutputPtr);
-		for (const FTurboStructLiteRow& Row : Rows)
+		if (!Bound || Bound->Root != ETurboStructLiteQueryValueRoot::Root)
 		{
-			TArray<uint8> TempValue;
-			TempValue.SetNumUninitialized(InnerStruct->GetSize());
-			InnerStruct->InitializeValue(TempValue.GetData());
-			if (!ApplyRowToStruct(Row, InnerStruct->Struct, TempValue.GetData(), OutErrorMessage))
-			{
-				InnerStruct->DestroyValue(TempValue.GetData());
-				return false;
-			}
-			Helper.AddElement(TempValue.GetData());
-			InnerStruct->DestroyValue(TempValue.GetData());
+			Context.ProjectionChains.Reset();
+			return;
 		}
-		return true;
+		AddChain(Bound->PropertyChain);
 	}
-	if (CastField<FMapProperty>(OutputProp))
+	for (const FTurboStructLiteSelectFieldInfo& FieldInfo : Context.SelectFieldInfos)
 	{
-		OutErrorMessage = TEXT("Type Error: Select projection is not supported for map outputs");
-		return false;
+		AddChain(FieldInfo.PropertyChain);
 	}
-	OutErrorMessage = TEXT("Type Error: Invalid output type for select query");
-	return false;
-}
-
-bool UTurboStructLiteQueryLibrary::ApplyAggregateToOutput(const TArray<FTurboStructLiteRow>& Rows, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage)
-{
-	OutErrorMessage.Reset();
-	if (!OutputProp || !OutputPtr)
+	for (const FTurboStructLiteSelectFieldInfo& FieldInfo : Context.OrderFieldInfos)
 	{
-		OutErrorMessage = TEXT("Type Error: Invalid output");
-		return false;
+		AddChain(FieldInfo.PropertyChain);
 	}
-	const bool bNumeric = CastField<FNumericProperty>(OutputProp) || CastField<FEnumProperty>(OutputProp);
-	if (!bNumeric)
+	for (const FTurboStructLiteSelectFieldInfo& FieldInfo : Context.AggregateFieldInfos)
 	{
-		OutErrorMessage = TEXT("Type Error: Aggregate output must be numeric");
-		return false;
+		AddChain(FieldInfo.PropertyChain);
 	}
-	if (Rows.Num() == 0)
+	for (const FTurboStructLiteSelectFieldInfo& FieldInfo : Context.GroupFieldInfos)
 	{
-		OutErrorMessage = TEXT("IO Error: Aggregate result is empty");
-		return false;
+		AddChain(FieldInfo.PropertyChain);
 	}
-	const FTurboStructLiteRow& Row = Rows[0];
-	if (Row.Columns.Num() != 1)
+
+	TSet<const FProperty*> TopLevelProperties;
+	for (const TArray<FProperty*>& Chain : Context.ProjectionChains)
 	{
-		OutErrorMessage = TEXT("Type Error: Aggregate output requires a single value");
-		return false;
+		TopLevelProperties.Add(Chain[0]);
 	}
-	const FTurboStructLiteVariant& Variant = Row.Columns.CreateConstIterator().Value();
-	if (!UTurboStructLiteBPLibrary::TryApplyVariantToProperty(OutputProp, OutputPtr, Variant))
+	int32 FieldCount = 0;
+	for (TFieldIterator<FProperty> It(Context.ContextStructProp->Struct); It; ++It)
 	{
-		OutErrorMessage = TEXT("Type Error: Failed to apply aggregate output");
-		return false;
+		++FieldCount;
 	}
-	return true;
+	Context.bUseProjection = TopLevelProperties.Num() < FieldCount;
 }
 
-bool UTurboStructLiteQueryLibrary::ExecuteSelectQueryToValue(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, FProperty* OutputProp, TArray<uint8>& OutValue, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage)
+void UTurboStructLiteQueryLibrary::BuildIndexCandidates(FTurboStructLiteQueryExecutionContext& Context)
 {
-	OutValue.Reset();
-	OutMetadata.Reset();
-	OutSaveDate = FDateTime(0);
-	OutStatsText.Reset();
-	OutErrorMessage.Reset();
-	if (!OutputProp)
+	Context.IndexCandidates.Reset();
+	Context.bUseIndexCandidates = false;
+	if (!Context.SlotName || Context.SubSlotIndex != -1 || Context.bQueryIsTrue || !Context.Root.IsValid())
 	{
-		OutErrorMessage = TEXT("Type Error: Invalid output");
-		return false;
+		return;
 	}
-	UStruct* ContextStruct = nullptr;
-	if (!ResolveContextStructFromSlot(SlotName, SubSlotIndex, EncryptionKey, SelectedEncryption, ContextStruct, OutErrorMessage))
+	FTurboStructLiteSecondaryIndexSet IndexSet;
+	if (!UTurboStructLiteBPLibrary::GetFreshSecondaryIndexes(*Context.SlotName, IndexSet))
 	{
-		return false;
+		return;
 	}
-	bool bHasAggregates = false;
-	TArray<FTurboStructLiteRow> Rows;
-	if (!ExecuteSelectQuery(SlotName, SubSlotIndex, QueryString, EncryptionKey, SelectedEncryption, MaxParallelThreads, bUseWriteAheadLog, WALPath, ContextStruct, bHasAggregates, Rows, OutMetadata, OutSaveDate, OutStatsText, OutErrorMessage))
+
+	auto FindIndex = [&IndexSet](const TArray<FProperty*>& Chain) -> const FTurboStructLiteFieldIndex*
 	{
-		return false;
+		for (const FTurboStructLiteFieldIndex& Index : IndexSet.Indexes)
+		{
+			TArray<FString> Segments;
+			Index.FieldPath.ParseIntoArray(Segments, TEXT("."), true);
+			if (Segments.Num() != Chain.Num())
+			{
+				continue;
+			}
+			bool bMatches = true;
+			for (int32 SegmentIndex = 0; SegmentIndex < Segments.Num() && bMatches; ++SegmentIndex)
+			{
+				bMatches = Chain[SegmentIndex] && UTurboStructLiteBPLibrary::NamesMatchForMigration(Segments[SegmentIndex].TrimStartAndEnd(), Chain[SegmentIndex]);
+			}
+			if (bMatches)
+			{
+				return &Index;
+			}
+		}
+		return nullptr;
+	};
+
+	// Only top-level AND terms can narrow the scan; every candidate is still checked against the full query.
+	TArray<const FTurboStructLiteQueryNode*> Pending;
+	Pending.Add(Context.Root.Get());
+	TSet<int32> Candidates;
+	bool bHasCandidates = false;
+	while (Pending.Num() > 0)
+	{
+		const FTurboStructLiteQueryNode* Node = Pending.Pop();
+		if (!Node)
+		{
+			continue;
+		}
+		if (Node->Type == ETurboStructLiteQueryNodeType::And)
+		{
+			Pending.Add(Node->Left.Get());
+			Pending.Add(Node->Right.Get());
+			continue;
+		}
+		if (Node->Type != ETurboStructLiteQueryNodeType::Comparison)
+		{
+			continue;
+		}
+		const FTurboStructLiteQueryComparison& Comparison = Node->Comparison;
+		const FTurboStructLiteQueryBoundProperty& Lhs = Comparison.Lhs;
+		if (Lhs.Root != ETurboStructLiteQueryValueRoot::Root || Lhs.bIsContainer || Lhs.PropertyChain.Num() == 0)
+		{
+			continue;
+		}
+		const FTurboStructLiteFieldIndex* Index = FindIndex(Lhs.PropertyChain);
+		if (!Index)
+		{
+			continue;
+		}
+
+		const FTurboStructLiteQueryLiteral& Literal = Comparison.Rhs;
+		TSet<int32> Matches;
+		if (Literal.Type == ETurboStructLiteQueryLiteralType::Boolean || Literal.Type == ETurboStructLiteQueryLiteralType::Integer || Literal.Type == ETurboStructLiteQueryLiteralType::Float)
+		{
+			const double Value = Literal.Type == ETurboStructLiteQueryLiteralType::Boolean ? (Literal.BoolValue ? 1.0 : 0.0)
+				: Literal.Type == ETurboStructLiteQueryLiteralType::Integer ? static_cast<double>(Literal.IntValue) : Literal.FloatValue;
+			if (FMath::IsNaN(Value))
+			{
+				continue;
+			}
+			// Bounds stay inclusive: strict operators are settled by the predicate itself.
+			switch (Comparison.Op)
+			{
+			case ETurboStructLiteQueryCompareOp::Equal:
+				UTurboStructLiteBPLibrary::CollectIndexRange(*Index, Value, Value, Matches);
+				break;
+			case ETurboStructLiteQueryCompareOp::Greater:
+			case ETurboStructLiteQueryCompareOp::GreaterEqual:
+				UTurboStructLiteBPLibrary::CollectIndexRange(*Index, Value, TNumericLimits<double>::Max(), Matches);
+				break;
+			case ETurboStructLiteQueryCompareOp::Less:
+			case ETurboStructLiteQueryCompareOp::LessEqual:
+				UTurboStructLiteBPLibrary::CollectIndexRange(*Index, TNumericLimits<double>::Lowest(), Value, Matches);
+				break;
+			default:
+				continue;
+			}
+		}
+		else if ((Literal.Type == ETurboStructLiteQueryLiteralType::String || Literal.Type == ETurboStructLiteQueryLiteralType::Name) && Comparison.Op == ETurboStructLiteQueryCompareOp::Equal)
+		{
+			const FString Key = Literal.Type == ETurboStructLiteQueryLiteralType::Name ? Literal.NameValue.ToString() : Literal.StringValue;
+			UTurboStructLiteBPLibrary::CollectIndexHash(*Index, UTurboStructLiteBPLibrary::HashIndexString(Key), Matches);
+		}
+		else
+		{
+			continue;
+		}
+		Candidates = bHasCandidates ? Candidates.Intersect(Matches) : MoveTemp(Matches);
+		bHasCandidates = true;
+	}
+	if (bHasCandidates)
+	{
+		Context.IndexCandidates = MoveTemp(Candidates);
+		Context.bUseIndexCandidates = true;
+	}
+}
+
+void UTurboStructLiteQueryLibrary::PruneSubSlotsByZoneMap(FTurboStructLiteQueryExecutionContext& Context)
+{
+	if (!Context.SlotName || Context.SubSlots.Num() == 0 || Context.bQueryIsTrue || !Context.Root.IsValid())
+	{
+		return;
+	}
+
+	struct FZoneTerm
+	{
+		const FProperty* Property = nullptr;
+		FString PropertyType;
+		ETurboStructLiteQueryCompareOp Op = ETurboStructLiteQueryCompareOp::Equal;
+		double Value = 0.0;
+	};
+	TArray<FZoneTerm> Terms;
+	TArray<const FTurboStructLiteQueryNode*> Pending;
+	Pending.Add(Context.Root.Get());
+	while (Pending.Num() > 0)
+	{
+		const FTurboStructLiteQueryNode* Node = Pending.Pop();
+		if (!Node)
+		{
+			continue;
+		}
+		if (Node->Type == ETurboStructLiteQueryNodeType::And)
+		{
+			Pending.Add(Node->Left.Get());
+			Pending.Add(Node->Right.Get());
+			continue;
+		}
+		if (Node->Type != ETurboStructLiteQueryNodeType::Comparison)
+		{
+			continue;
+		}
+		const FTurboStructLiteQueryComparison& Comparison = Node->Comparison;
+		const FTurboStructLiteQueryBoundProperty& Lhs = Comparison.Lhs;
+		if (Lhs.Root != ETurboStructLiteQueryValueRoot::Root || Lhs.bIsContainer || Lhs.PropertyChain.Num() != 1 || !Lhs.PropertyChain[0])
+		{
+			continue;
+		}
+		const FTurboStructLiteQueryLiteral& Literal = Comparison.Rhs;
+		if (Literal.Type != ETurboStructLiteQueryLiteralType::Boolean && Literal.Type != ETurboStructLiteQueryLiteralType::Integer && Literal.Type != ETurboStructLiteQueryLiteralType::Float)
+		{
+			continue;
+		}
+		if (Comparison.Op != ETurboStructLiteQueryCompareOp::Equal && Comparison.Op != ETurboStructLiteQueryCompareOp::Greater && Comparison.Op != ETurboStructLiteQueryCompareOp::GreaterEqual
+			&& Comparison.Op != ETurboStructLiteQueryCompareOp::Less && Comparison.Op != ETurboStructLiteQueryCompareOp::LessEqual)
+		{
+			continue;
+		}
+		FZoneTerm& Term = Terms.AddDefaulted_GetRef();
+		Term.Property = Lhs.PropertyChain[0];
+		Term.PropertyType = UTurboStructLiteBPLibrary::NormalizeTypeName(Term.Property->GetCPPType(nullptr, 0));
+		Term.Op = Comparison.Op;
+		Term.Value = Literal.Type == ETurboStructLiteQueryLiteralType::Boolean ? (Literal.BoolValue ? 1.0 : 0.0)
+			: Literal.Type == ETurboStructLiteQueryLiteralType::Integer ? static_cast<double>(Literal.IntValue) : Literal.FloatValue;
+		if (FMath::IsNaN(Term.Value))
+		{
+			Terms.Pop();
+		}
+	}
+	if (Terms.Num() == 0)
+	{
+		return;
+	}
+	FTurboStructLiteSlotIndex SlotIndex;
+	if (!UTurboStructLiteBPLibrary::GetSlotIndex(*Context.SlotName, SlotIndex))
+	{
+		return;
+	}
+
+	// Bounds are compared inclusively so int64 values rounded to double are never wrongly excluded.
+	auto CanMatch = [](const FZoneTerm& Term, const FTurboStructLiteZoneRange& Range) -> bool
+	{
+		switch (Term.Op)
+		{
+		case ETurboStructLiteQueryCompareOp::Equal:
+			return Range.Min <= Term.Value && Term.Value <= Range.Max;
+		case ETurboStructLiteQueryCompareOp::Greater:
+		case ETurboStructLiteQueryCompareOp::GreaterEqual:
+			return Range.Max >= Term.Value;
+		case ETurboStructLiteQueryCompareOp::Less:
+		case ETurboStructLiteQueryCompareOp::LessEqual:
+			return Range.Min <= Term.Value;
+		default:
+			return true;
+		}
+	};
+	Context.SubSlots.RemoveAll([&](int32 SubSlot)
+	{
+		const FTurboStructLiteCachedEntry* Cached = SlotIndex.Entries.Find(SubSlot);
+		if (!Cached || !Cached->ZoneMap.IsValid())
+		{
+			return false;
+		}
+		for (const FZoneTerm& Term : Terms)
+		{
+			for (const FTurboStructLiteZoneRange& Range : *Cached->ZoneMap)
+			{
+				if (Range.FieldType == Term.PropertyType && UTurboStructLiteBPLibrary::NamesMatchForMigration(Range.FieldName, Term.Property))
+				{
+					if (!CanMatch(Term, Range))
+					{
+						return true;
+					}
+					break;
+				}
+			}
+		}
+		return false;
+	});
+}
+
+bool UTurboStructLiteQueryLibrary::SortKeyLess(const FTurboStructLiteQueryExecutionContext& Context, const FTurboStructLiteSortKey& A, const FTurboStructLiteSortKey& B)
+{
+	int32 NumberIndex = 0;
+	int32 StringIndex = 0;
+	for (int32 OrderIndex = 0; OrderIndex < Context.OrderIsString.Num(); ++OrderIndex)
+	{
+		int32 Compare = 0;
+		if (Context.OrderIsString[OrderIndex])
+		{
+			if (A.Strings.IsValidIndex(StringIndex) && B.Strings.IsValidIndex(StringIndex))
+			{
+				Compare = A.Strings[StringIndex].Compare(B.Strings[StringIndex], ESearchCase::IgnoreCase);
+			}
+			++StringIndex;
+		}
+		else
+		{
+			if (A.Numbers.IsValidIndex(NumberIndex) && B.Numbers.IsValidIndex(NumberIndex))
+			{
+				const double ValueA = A.Numbers[NumberIndex];
+				const double ValueB = B.Numbers[NumberIndex];
+				Compare = ValueA < ValueB ? -1 : (ValueA > ValueB ? 1 : 0);
+			}
+			++NumberIndex;
+		}
+		if (Compare != 0)
+		{
+			const bool bDescending = Context.ParsedOrderDesc.IsValidIndex(OrderIndex) && Context.ParsedOrderDesc[OrderIndex];
+			return bDescending ? Compare > 0 : Compare < 0;
+		}
+	}
+	return A.Sequence < B.Sequence;
+}
+
+FString UTurboStructLiteQueryLibrary::FormatLogicStats(const FTurboStructLiteLogicQueryStats& Stats)
+{
+	return FString::Printf(TEXT("Scanned: %d, Matched: %d, Time: %.2fms"), Stats.Scanned, Stats.Matched, Stats.ElapsedMs);
+}
+
+bool UTurboStructLiteQueryLibrary::ApplyRowsToOutput(const FTurboStructLiteResultBuffer& Results, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage)
+{
+	OutErrorMessage.Reset();
+	if (!OutputProp || !OutputPtr)
+	{
+		OutErrorMessage = TEXT("Type Error: Invalid output");
+		return false;
+	}
+	if (FStructProperty* StructProp = CastField<FStructProperty>(OutputProp))
+	{
+		TArray<uint8> TempValue;
+		TempValue.SetNumUninitialized(StructProp->GetSize());
+		StructProp->InitializeValue(TempValue.GetData());
+		if (Results.NumRows > 0)
+		{
+			TArray<TArray<FProperty*>> ColumnTargets;
+			ResolveResultColumnTargets(Results, StructProp->Struct, ColumnTargets);
+			if (!ApplyResultRowToStruct(Results, 0, ColumnTargets, TempValue.GetData(), OutErrorMessage))
+			{
+				StructProp->DestroyValue(TempValue.GetData());
+				return false;
+			}
+		}
+		StructProp->CopyCompleteValue(OutputPtr, TempValue.GetData());
+		StructProp->DestroyValue(TempValue.GetData());
+		return true;
+	}
+	if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(OutputProp))
+	{
+		FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProp->Inner);
+		if (!InnerStruct)
+		{
+			OutErrorMessage = TEXT("Type Error: Array output must be struct");
+			return false;
+		}
+		ArrayProp->DestroyValue(OutputPtr);
+		ArrayProp->InitializeValue(OutputPtr);
+		FScriptArrayHelper Helper(ArrayProp, OutputPtr);
+		TArray<TArray<FProperty*>> ColumnTargets;
+		ResolveResultColumnTargets(Results, InnerStruct->Struct, ColumnTargets);
+		Helper.AddValues(Results.NumRows);
+		for (int32 RowIndex = 0; RowIndex < Results.NumRows; ++RowIndex)
+		{
+			if (!ApplyResultRowToStruct(Results, RowIndex, ColumnTargets, Helper.GetRawPtr(RowIndex), OutErrorMessage))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	if (FSetProperty* SetProp = CastField<FSetProperty>(OutputProp))
+	{
+		FStructProperty* InnerStruct = CastField<FStructProperty>(SetProp->ElementProp);
+		if (!InnerStruct)
+		{
+			OutErrorMessage = TEXT("Type Error: Set output must be struct");
+			return false;
+		}
+		SetProp->DestroyValue(OutputPtr);
+		SetProp->InitializeValue(OutputPtr);
+		FScriptSetHelper Helper(SetProp, OutputPtr);
+		TArray<TArray<FProperty*>> ColumnTargets;
+		ResolveResultColumnTargets(Results, InnerStruct->Struct, ColumnTargets);
+		TArray<uint8> TempValue;
+		TempValue.SetNumUninitialized(InnerStruct->GetSize());
+		for (int32 RowIndex = 0; RowIndex < Results.NumRows; ++RowIndex)
+		{
+			InnerStruct->InitializeValue(TempValue.GetData());
+			if (!ApplyResultRowToStruct(Results, RowIndex, ColumnTargets, TempValue.GetData(), OutErrorMessage))
+			{
+				InnerStruct->DestroyValue(TempValue.GetData());
+				return false;
+			}
+			Helper.AddElement(TempValue.GetData());
+			InnerStruct->DestroyValue(TempValue.GetData());
+		}
+		return true;
+	}
+	if (CastField<FMapProperty>(OutputProp))
+	{
+		OutErrorMessage = TEXT("Type Error: Select projection is not supported for map outputs");
+		return false;
+	}
+	OutErrorMessage = TEXT("Type Error: Invalid output type for select query");
+	return false;
+}
+
+bool UTurboStructLiteQueryLibrary::ApplyAggregateToOutput(const FTurboStructLiteResultBuffer& Results, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage)
+{
+	OutErrorMessage.Reset();
+	if (!OutputProp || !OutputPtr)
+	{
+		OutErrorMessage = TEXT("Type Error: Invalid output");
+		return false;
+	}
+	const bool bNumeric = CastField<FNumericProperty>(OutputProp) || CastField<FEnumProperty>(OutputProp);
+	if (!bNumeric)
+	{
+		OutErrorMessage = TEXT("Type Error: Aggregate output must be numeric");
+		return false;
+	}
+	if (Results.NumRows == 0)
+	{
+		OutErrorMessage = TEXT("IO Error: Aggregate result is empty");
+		return false;
+	}
+	if (Results.Columns.Num() != 1)
+	{
+		OutErrorMessage = TEXT("Type Error: Aggregate output requires a single value");
+		return false;
+	}
+	FTurboStructLiteVariant Variant;
+	if (!BuildVariantFromResult(Results, 0, 0, Variant) || !UTurboStructLiteBPLibrary::TryApplyVariantToProperty(OutputProp, OutputPtr, Variant))
+	{
+		OutErrorMessage = TEXT("Type Error: Failed to apply aggregate output");
+		return false;
+	}
+	return true;
+}
+
+bool UTurboStructLiteQueryLibrary::ExecuteSelectQueryToValue(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const TSharedPtr<const FTurboStructLiteQueryPlan>& PreparedPlan, const TArray<FString>& Parameters, FTurboStructLiteQueryPageState* Page, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, FProperty* OutputProp, TArray<uint8>& OutValue, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage)
+{
+	OutValue.Reset();
+	OutMetadata.Reset();
+	OutSaveDate = FDateTime(0);
+	OutStatsText.Reset();
+	OutErrorMessage.Reset();
+	if (!OutputProp)
+	{
+		OutErrorMessage = TEXT("Type Error: Invalid output");
+		return false;
+	}
+	// A current prepared plan already knows the stored struct type, so the subslot header is not decrypted again.
+	UStruct* ContextStruct = PreparedPlan.IsValid() && IsQueryPlanCurrent(*PreparedPlan, nullptr) ? PreparedPlan->ContextStruct.Get() : nullptr;
+	if (!ContextStruct && !ResolveContextStructFromSlot(SlotName, SubSlotIndex, EncryptionKey, SelectedEncryption, ContextStruct, OutErrorMessage))
+	{
+		return false;
+	}
+	bool bHasAggregates = false;
+	FTurboStructLiteResultBuffer Results;
+	if (!ExecuteSelectQuery(SlotName, SubSlotIndex, QueryString, PreparedPlan, Parameters, Page, EncryptionKey, SelectedEncryption, MaxParallelThreads, bUseWriteAheadLog, WALPath, ContextStruct, bHasAggregates, Results, OutMetadata, OutSaveDate, OutStatsText, OutErrorMessage))
+	{
+		return false;
 	}
 	const int32 ValueSize = OutputProp->GetSize();
 	if (ValueSize <= 0)
@@ -803,7 +1362,9 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQueryToValue(const FString& Slot
 	}
 	OutValue.SetNumUninitialized(ValueSize);
 	OutputProp->InitializeValue(OutValue.GetData());
-	const bool bApplied = bHasAggregates ? ApplyAggregateToOutput(Rows, OutputProp, OutValue.GetData(), OutErrorMessage) : ApplyRowsToOutput(Rows, OutputProp, OutValue.GetData(), OutErrorMessage);
+	// Aggregate rows fill struct outputs by column name like plain rows; only a numeric output takes the single scalar value.
+	const bool bScalarAggregate = bHasAggregates && (CastField<FNumericProperty>(OutputProp) || CastField<FEnumProperty>(OutputProp));
+	const bool bApplied = bScalarAggregate ? ApplyAggregateToOutput(Results, OutputProp, OutValue.GetData(), OutErrorMessage) : ApplyRowsToOutput(Results, OutputProp, OutValue.GetData(), OutErrorMessage);
 	if (!bApplied)
 	{
 		OutputProp->DestroyValue(OutValue.GetData());
@@ -821,9 +1382,9 @@ bool UTurboStructLiteQueryLibrary::PrepareSelectQueryExecution(FTurboStructLiteQ
 	}
 
 	FString& OutErrorMessage = *Context.OutErrorMessage;
-	if (Context.OutRows)
+	if (Context.OutResults)
 	{
-		Context.OutRows->Reset();
+		*Context.OutResults = FTurboStructLiteResultBuffer();
 	}
 	if (Context.OutMetadata)
 	{
@@ -843,161 +1404,111 @@ bool UTurboStructLiteQueryLibrary::PrepareSelectQueryExecution(FTurboStructLiteQ
 		*Context.bOutHasAggregates = false;
 	}
 
-	Context.Results.Reset();
+	Context.Results = FTurboStructLiteResultBuffer();
 	Context.SortKeys.Reset();
-	Context.AggregateCounts.Reset();
-	Context.AggregateSums.Reset();
+	Context.Aggregates = FTurboStructLiteAggregateTable();
 	Context.SubSlots.Reset();
 	Context.SelectFieldInfos.Reset();
+	Context.OrderFieldInfos.Reset();
+	Context.OrderIsString.Reset();
 	Context.AggregateFieldInfos.Reset();
 	Context.AggregateFieldIndices.Reset();
-	Context.Tokens.Reset();
+	Context.GroupFieldInfos.Reset();
+	Context.AggregateOutputColumns.Reset();
+	Context.AggregateOrderColumns.Reset();
+	Context.ProjectionChains.Reset();
+	Context.bUseProjection = false;
+	Context.IndexCandidates.Reset();
+	Context.bUseIndexCandidates = false;
 	Context.Root.Reset();
 
-	if (!Context.ContextStruct || !Context.ContextStructProp)
+	if (!Context.Plan.IsValid() || !Context.ContextStruct || !Context.ContextStructProp)
 	{
 		OutErrorMessage = TEXT("Type Error: Invalid query context");
 		return false;
 	}
 
-	TArray<FString> EmptySelectFields;
-	if (!ParseSelectQueryString(*Context.QueryString, EmptySelectFields, Context.ParsedQueryString, Context.ParsedSelectFields, Context.ParsedLimit, Context.ParsedOffset, Context.ParsedOrderBy, Context.bParsedOrderDesc, Context.ParsedAggregateOps, Context.ParsedAggregateFields, Context.ParsedAggregateColumns, OutErrorMessage))
-	{
-		return false;
-	}
-	Context.bHasAggregates = Context.ParsedAggregateOps.Num() > 0;
+	const FTurboStructLiteQueryPlan& Plan = *Context.Plan;
+	Context.ParsedQueryString = Plan.ParsedQueryString;
+	Context.ParsedSelectFields = Plan.ParsedSelectFields;
+	Context.ParsedLimit = Plan.ParsedLimit;
+	Context.ParsedOffset = Plan.ParsedOffset;
+	Context.ParsedOrderBy = Plan.ParsedOrderBy;
+	Context.ParsedOrderDesc = Plan.ParsedOrderDesc;
+	Context.ParsedAggregateOps = Plan.ParsedAggregateOps;
+	Context.ParsedAggregateFields = Plan.ParsedAggregateFields;
+	Context.ParsedAggregateColumns = Plan.ParsedAggregateColumns;
+	Context.ParsedGroupBy = Plan.ParsedGroupBy;
+	Context.bHasAggregates = Plan.bHasAggregates;
+	Context.bHasGroupBy = Plan.bHasGroupBy;
+	Context.bHasOrderBy = Plan.bHasOrderBy;
+	Context.bQueryIsTrue = Plan.bQueryIsTrue;
+	Context.bAggregateCountOnly = Plan.bAggregateCountOnly;
 	if (Context.bOutHasAggregates)
 	{
 		*Context.bOutHasAggregates = Context.bHasAggregates;
 	}
-	Context.bHasOrderBy = !Context.ParsedOrderBy.IsEmpty();
-	FString TrimmedQuery = Context.ParsedQueryString;
-	TrimmedQuery.TrimStartAndEndInline();
-	Context.bQueryIsTrue = TrimmedQuery.Equals(TEXT("true"), ESearchCase::IgnoreCase);
-	Context.bAggregateCountOnly = Context.bHasAggregates;
-	if (Context.bAggregateCountOnly)
+	Context.QueryContext = Plan.QueryContext;
+	Context.SelectFieldInfos = Plan.SelectFieldInfos;
+	Context.OrderFieldInfos = Plan.OrderFieldInfos;
+	Context.OrderIsString = Plan.OrderIsString;
+	Context.AggregateFieldInfos = Plan.AggregateFieldInfos;
+	Context.AggregateFieldIndices = Plan.AggregateFieldIndices;
+	Context.GroupFieldInfos = Plan.GroupFieldInfos;
+	Context.AggregateOutputColumns = Plan.AggregateOutputColumns;
+	Context.AggregateOrderColumns = Plan.AggregateOrderColumns;
+	if (Plan.ParameterCount > 0 || (Context.Parameters && Context.Parameters->Num() > 0))
 	{
-		for (const ETurboStructLiteAggregateOp Op : Context.ParsedAggregateOps)
+		if (!BindQueryParameters(Plan, Context.Parameters ? *Context.Parameters : TArray<FString>(), Context.Root, OutErrorMessage))
 		{
-			if (Op != ETurboStructLiteAggregateOp::Count)
-			{
-				Context.bAggregateCountOnly = false;
-				break;
-			}
+			return false;
 		}
 	}
-	if (!BuildLogicQueryContext(Context.ContextStructProp, Context.QueryContext, OutErrorMessage))
-	{
-		return false;
-	}
-	Context.ErrorPos = 0;
-	if (!TokenizeLogicQuery(Context.ParsedQueryString, Context.Tokens, OutErrorMessage, Context.ErrorPos))
-	{
-		return false;
-	}
-	if (!ParseLogicQuery(Context.Tokens, Context.Root, OutErrorMessage, Context.ErrorPos))
-	{
-		return false;
-	}
-	if (!BindLogicQuery(Context.Root, Context.QueryContext, OutErrorMessage, Context.ErrorPos))
-	{
-		return false;
-	}
-	if (Context.ParsedSelectFields.IsEmpty() && !Context.bHasAggregates)
+	else
 	{
-		if (Context.QueryContext.RootStruct)
-		{
-			for (TFieldIterator<FProperty> It(Context.QueryContext.RootStruct); It; ++It)
-			{
-				Context.ParsedSelectFields.Add(It->GetName());
-			}
-		}
+		Context.Root = Plan.Root;
 	}
 	if (!Context.bHasAggregates)
 	{
-		if (!BuildSelectFieldInfos(Context.ParsedSelectFields, Context.QueryContext.RootStruct, Context.SelectFieldInfos, OutErrorMessage))
-		{
-			return false;
-		}
-		if (Context.SelectFieldInfos.Num() == 0)
-		{
-			OutErrorMessage = TEXT("Type Error: No valid select fields");
-			return false;
-		}
+		InitResultBuffer(Context.SelectFieldInfos, Context.Results);
 	}
-	if (Context.bHasOrderBy)
+	BuildQueryProjection(Context);
+	BuildIndexCandidates(Context);
+	Context.ClampedParallel = FMath::Clamp(Context.MaxParallelThreads, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Context.StartSeconds = FPlatformTime::Seconds();
+	Context.Stats = FTurboStructLiteLogicQueryStats();
+	if (Context.Page)
 	{
-		TArray<FString> OrderFields;
-		OrderFields.Add(Context.ParsedOrderBy);
-		TArray<FTurboStructLiteSelectFieldInfo> OrderFieldInfos;
-		if (!BuildSelectFieldInfos(OrderFields, Context.QueryContext.RootStruct, OrderFieldInfos, OutErrorMessage))
+		// Pages stream rows in subslot order, so anything that needs the whole result first cannot be paged.
+		if (Context.bHasAggregates || Context.bHasOrderBy || Context.ParsedLimit > 0 || Context.ParsedOffset > 0)
 		{
+			OutErrorMessage = TEXT("Query Error: Cursor queries cannot use aggregates, GROUP BY, ORDER BY, LIMIT or OFFSET");
 			return false;
 		}
-		if (OrderFieldInfos.Num() == 0)
+		if (Context.Page->PageSize <= 0)
 		{
-			OutErrorMessage = TEXT("Type Error: Invalid ORDER BY field");
+			OutErrorMessage = TEXT("Query Error: Cursor page size must be positive");
 			return false;
 		}
-		Context.OrderFieldInfo = MoveTemp(OrderFieldInfos[0]);
-	}
-	if (Context.bHasAggregates)
-	{
-		TArray<FString> AggregatePaths;
-		for (int32 Index = 0; Index < Context.ParsedAggregateOps.Num(); ++Index)
-		{
-			if (Context.ParsedAggregateOps[Index] != ETurboStructLiteAggregateOp::Count)
-			{
-				const FString& FieldPath = Context.ParsedAggregateFields[Index];
-				if (!FieldPath.IsEmpty())
-				{
-					AggregatePaths.AddUnique(FieldPath);
-				}
-			}
-		}
-		if (AggregatePaths.Num() > 0)
-		{
-			if (!BuildSelectFieldInfos(AggregatePaths, Context.QueryContext.RootStruct, Context.AggregateFieldInfos, OutErrorMessage))
-			{
-				return false;
-			}
-		}
-		TMap<FName, int32> AggregateIndexMap;
-		for (int32 Index = 0; Index < Context.AggregateFieldInfos.Num(); ++Index)
-		{
-			AggregateIndexMap.Add(Context.AggregateFieldInfos[Index].ColumnName, Index);
-		}
-		Context.AggregateFieldIndices.Init(INDEX_NONE, Context.ParsedAggregateOps.Num());
-		for (int32 Index = 0; Index < Context.ParsedAggregateOps.Num(); ++Index)
-		{
-			if (Context.ParsedAggregateOps[Index] != ETurboStructLiteAggregateOp::Count)
-			{
-				const FName FieldName = FName(*Context.ParsedAggregateFields[Index]);
-				const int32* FoundIndex = AggregateIndexMap.Find(FieldName);
-				if (!FoundIndex)
-				{
-					OutErrorMessage = TEXT("Type Error: Invalid aggregate field");
-					return false;
-				}
-				Context.AggregateFieldIndices[Index] = *FoundIndex;
-			}
-		}
+		Context.ParsedLimit = Context.Page->PageSize;
+		Context.Page->LastSubSlot = Context.Page->ResumeAfterSubSlot;
+		Context.Page->bFinished = false;
 	}
-	Context.ClampedParallel = FMath::Clamp(Context.MaxParallelThreads, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
-	Context.StartSeconds = FPlatformTime::Seconds();
-	Context.Stats = FTurboStructLiteLogicQueryStats();
+	Context.PageStopIndex = INDEX_NONE;
 	Context.bHasLimit = Context.ParsedLimit > 0;
 	Context.bHasOffset = Context.ParsedOffset > 0;
-	Context.bForceSingleThread = (Context.bHasLimit || Context.bHasOffset) && !Context.bHasAggregates;
+	// Ordered queries trim after the merge, so they scan in parallel and keep only the top OFFSET + LIMIT rows per task.
+	Context.bForceSingleThread = (Context.bHasLimit || Context.bHasOffset) && !Context.bHasAggregates && !Context.bHasOrderBy;
 	Context.bAllowEarlyExit = Context.bForceSingleThread && Context.bHasLimit && !Context.bHasOrderBy;
+	Context.bUseTopK = Context.bHasOrderBy && Context.bHasLimit && !Context.bHasAggregates;
+	Context.TopKCount = Context.bUseTopK ? static_cast<int32>(FMath::Min<int64>(static_cast<int64>(Context.ParsedOffset) + Context.ParsedLimit, MAX_int32)) : 0;
 	Context.MaxMatchIndex = Context.bHasLimit ? Context.ParsedOffset + Context.ParsedLimit : 0;
 	Context.bOffsetAppliedInLoop = false;
 	Context.bLimitAppliedInLoop = false;
 	Context.FastCountValue = 0;
 	if (Context.bHasAggregates)
 	{
-		Context.AggregateCounts.Init(0, Context.ParsedAggregateOps.Num());
-		Context.AggregateSums.Init(0.0, Context.ParsedAggregateOps.Num());
+		InitResultBuffer(Context.GroupFieldInfos, Context.Aggregates.Keys);
 	}
 	return true;
 }
@@ -1109,6 +1620,89 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQueryScan(FTurboStructLiteQueryE
 		return false;
 	};
 
+	// Group and DISTINCT keys are the text of each value, each prefixed by a separator so adjacent fields cannot run together.
+	auto AppendValueKey = [&TryGetNumericValue](const FTurboStructLiteSelectFieldInfo& FieldInfo, uint8* ValuePtr, FString& OutKey)
+	{
+		OutKey.AppendChar(TCHAR(0x1F));
+		FProperty* Leaf = FieldInfo.LeafProperty;
+		double CountValue = 0.0;
+		if (FieldInfo.bCountOnly && TryGetNumericValue(Leaf, ValuePtr, true, false, CountValue))
+		{
+			OutKey += LexToString(static_cast<int64>(CountValue));
+		}
+		else if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Leaf))
+		{
+			OutKey += EnumProp->GetUnderlyingProperty()->GetNumericPropertyValueToString(ValuePtr);
+		}
+		else if (const FNumericProperty* NumProp = CastField<FNumericProperty>(Leaf))
+		{
+			OutKey += NumProp->GetNumericPropertyValueToString(ValuePtr);
+		}
+		else if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Leaf))
+		{
+			OutKey.AppendChar(BoolProp->GetPropertyValue(ValuePtr) ? TEXT('1') : TEXT('0'));
+		}
+		else if (const FStrProperty* StrProp = CastField<FStrProperty>(Leaf))
+		{
+			OutKey += StrProp->GetPropertyValue(ValuePtr);
+		}
+		else if (const FNameProperty* NameProp = CastField<FNameProperty>(Leaf))
+		{
+			OutKey += NameProp->GetPropertyValue(ValuePtr).ToString();
+		}
+		else if (const FTextProperty* TextProp = CastField<FTextProperty>(Leaf))
+		{
+			OutKey += TextProp->GetPropertyValue(ValuePtr).ToString();
+		}
+		else if (Leaf)
+		{
+			Leaf->ExportTextItem_Direct(OutKey, ValuePtr, nullptr, nullptr, PPF_None);
+		}
+	};
+
+	auto BuildSortKey = [&](uint8* ValuePtr, int32 Sequence, FTurboStructLiteSortKey& OutKey, FString& OutError) -> bool
+	{
+		OutKey.Numbers.Reset();
+		OutKey.Strings.Reset();
+		OutKey.Sequence = Sequence;
+		for (int32 OrderIndex = 0; OrderIndex < Context.OrderFieldInfos.Num(); ++OrderIndex)
+		{
+			const FTurboStructLiteSelectFieldInfo& OrderInfo = Context.OrderFieldInfos[OrderIndex];
+			uint8* SortPtr = ResolvePropertyPtr(OrderInfo.PropertyChain, ValuePtr);
+			if (!SortPtr)
+			{
+				OutError = TEXT("Type Error: Invalid ORDER BY field pointer");
+				return false;
+			}
+			if (Context.OrderIsString[OrderIndex])
+			{
+				if (const FStrProperty* StrProp = CastField<FStrProperty>(OrderInfo.LeafProperty))
+				{
+					OutKey.Strings.Add(StrProp->GetPropertyValue(SortPtr));
+				}
+				else if (const FNameProperty* NameProp = CastField<FNameProperty>(OrderInfo.LeafProperty))
+				{
+					OutKey.Strings.Add(NameProp->GetPropertyValue(SortPtr).ToString());
+				}
+				else if (const FTextProperty* TextProp = CastField<FTextProperty>(OrderInfo.LeafProperty))
+				{
+					OutKey.Strings.Add(TextProp->GetPropertyValue(SortPtr).ToString());
+				}
+				continue;
+			}
+			double NumericValue = 0.0;
+			const bool bSortOk = TryGetNumericValue(OrderInfo.LeafProperty, SortPtr, OrderInfo.bCountOnly, true, NumericValue);
+			const double Fallback = Context.ParsedOrderDesc[OrderIndex] ? -TNumericLimits<double>::Max() : TNumericLimits<double>::Max();
+			OutKey.Numbers.Add(bSortOk ? NumericValue : Fallback);
+		}
+		return true;
+	};
+	// Heap order that keeps the entry that sorts last on top, ready to be evicted.
+	auto TopKHeapOrder = [&Context](const FTurboStructLiteTopKEntry& A, const FTurboStructLiteTopKEntry& B)
+	{
+		return SortKeyLess(Context, B.Key, A.Key);
+	};
+
 	const bool bFastCount = Context.bAggregateCountOnly && Context.bQueryIsTrue;
 	Context.SubSlots.Reset();
 	if (!bFastCount)
@@ -1120,11 +1714,29 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQueryScan(FTurboStructLiteQueryE
 				OutErrorMessage = TEXT("IO Error: No subslots found");
 				return false;
 			}
+			if (Context.bUseIndexCandidates)
+			{
+				Context.SubSlots.RemoveAll([&Context](int32 CandidateSubSlot)
+				{
+					return !Context.IndexCandidates.Contains(CandidateSubSlot);
+				});
+			}
+			PruneSubSlotsByZoneMap(Context);
 		}
 		else
 		{
 			Context.SubSlots.Add(SubSlotIndex);
 		}
+		if (Context.Page)
+		{
+			// Pages walk subslots in ascending order so the continuation stays valid if the file is rewritten between pages.
+			const int32 ResumeAfter = Context.Page->ResumeAfterSubSlot;
+			Context.SubSlots.RemoveAll([ResumeAfter](int32 CandidateSubSlot)
+			{
+				return CandidateSubSlot <= ResumeAfter;
+			});
+			Context.SubSlots.Sort();
+		}
 	}
 	else
 	{
@@ -1147,9 +1759,15 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQueryScan(FTurboStructLiteQueryE
 		}
 		if (Context.FastCountValue > 0)
 		{
+			bool bAdded = false;
+			const int32 GroupIndex = FindOrAddAggregateGroup(Context.Aggregates, FString(), Context.ParsedAggregateOps.Num(), bAdded);
+			if (bAdded)
+			{
+				AddResultRow(Context.Aggregates.Keys);
+			}
 			for (int32 AggIndex = 0; AggIndex < Context.ParsedAggregateOps.Num(); ++AggIndex)
 			{
-				Context.AggregateCounts[AggIndex] = Context.FastCountValue;
+				Context.Aggregates.States[GroupIndex * Context.ParsedAggregateOps.Num() + AggIndex].Count = Context.FastCountValue;
 			}
 			Context.Stats.Scanned = Context.FastCountValue;
 			Context.Stats.Matched = Context.FastCountValue;
@@ -1230,6 +1848,10 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQueryScan(FTurboStructLiteQueryE
 					{
 						return false;
 					}
+					if (UTurboStructLiteBPLibrary::IsChunkedAesPayload(Entry.Data))
+					{
+						return UTurboStructLiteBPLibrary::DecryptChunkedBuffer(KeyToUse, Entry.Data, Entry.Compression, true, OutRawBytes);
+					}
 					if (!UTurboStructLiteBPLibrary::DecryptDataBuffer(ETurboStructLiteEncryption::AES, KeyToUse, Entry.Data))
 					{
 						return false;
@@ -1240,30 +1862,40 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 			};
 			const int32 TaskCount = (bUseWriteAheadLog || Context.bForceSingleThread) ? 1 : FMath::Min(Context.ClampedParallel, Context.SubSlots.Num());
 			const int32 PerTaskThreads = FMath::Max(1, Context.ClampedParallel / TaskCount);
-			TArray<FTurboStructLiteRow> SubRows;
-			TArray<bool> SubMatched;
-			TArray<double> SubSortKeys;
 			TArray<FTurboStructLiteLogicQueryStats> SubStats;
 			TArray<FString> SubErrors;
-			SubRows.SetNum(Context.SubSlots.Num());
-			SubMatched.Init(false, Context.SubSlots.Num());
-			if (Context.bHasOrderBy)
-			{
-				SubSortKeys.SetNum(Context.SubSlots.Num());
-			}
 			SubStats.SetNum(Context.SubSlots.Num());
 			SubErrors.SetNum(Context.SubSlots.Num());
 			const int32 ItemsPerTask = FMath::DivideAndRoundUp(Context.SubSlots.Num(), TaskCount);
-			TArray<TArray<int64>> TaskAggregateCounts;
-			TArray<TArray<double>> TaskAggregateSums;
+			// Tasks own contiguous subslot ranges, so appending their buffers in task order keeps scan order.
+			TArray<FTurboStructLiteResultBuffer> TaskResults;
+			TArray<TArray<FTurboStructLiteSortKey>> TaskSortKeys;
+			TArray<TArray<FTurboStructLiteTopKEntry>> TaskTopK;
+			if (!Context.bHasAggregates)
+			{
+				TaskResults.SetNum(TaskCount);
+				for (FTurboStructLiteResultBuffer& TaskBuffer : TaskResults)
+				{
+					InitResultBuffer(Context.SelectFieldInfos, TaskBuffer);
+				}
+			}
+			if (Context.bUseTopK)
+			{
+				TaskTopK.SetNum(TaskCount);
+			}
+			else if (Context.bHasOrderBy)
+			{
+				TaskSortKeys.SetNum(TaskCount);
+			}
+			// Each task hashes its rows into its own group table; tables are merged in task order once the scan finishes.
+			const int32 NumAggregateOps = Context.ParsedAggregateOps.Num();
+			TArray<FTurboStructLiteAggregateTable> TaskAggregates;
 			if (Context.bHasAggregates)
 			{
-				TaskAggregateCounts.SetNum(TaskCount);
-				TaskAggregateSums.SetNum(TaskCount);
-				for (int32 TaskIndex = 0; TaskIndex < TaskCount; ++TaskIndex)
+				TaskAggregates.SetNum(TaskCount);
+				for (FTurboStructLiteAggregateTable& TaskTable : TaskAggregates)
 				{
-					TaskAggregateCounts[TaskIndex].Init(0, Context.ParsedAggregateOps.Num());
-					TaskAggregateSums[TaskIndex].Init(0.0, Context.ParsedAggregateOps.Num());
+					InitResultBuffer(Context.GroupFieldInfos, TaskTable.Keys);
 				}
 			}
 			int32 MatchesFound = 0;
@@ -1291,18 +1923,15 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 					UTurboStructLiteBPLibrary::SetParallelThreadLimit(PrevTaskParallel);
 					return;
 				}
-				TArray<int64>* LocalAggCounts = Context.bHasAggregates ? &TaskAggregateCounts[TaskIndex] : nullptr;
-				TArray<double>* LocalAggSums = Context.bHasAggregates ? &TaskAggregateSums[TaskIndex] : nullptr;
+				FTurboStructLiteAggregateTable* LocalAggregates = Context.bHasAggregates ? &TaskAggregates[TaskIndex] : nullptr;
 				for (int32 SubSlotIdx = Start; SubSlotIdx < End; ++SubSlotIdx)
 				{
 					FTurboStructLiteLogicQueryStats LocalStats;
 					FString LocalError;
 					bool bLocalSuccess = true;
 					bool bLocalMatch = false;
-					bool bStoreRow = false;
-					double LocalSortValue = 0.0;
+					FTurboStructLiteSortKey LocalSortKey;
 					bool bStopEarly = false;
-					FTurboStructLiteRow LocalRow;
 					const int32 CurrentSubSlot = Context.SubSlots[SubSlotIdx];
 					if (bUseWriteAheadLog)
 					{
@@ -1331,7 +1960,8 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 						{
 							TArray<uint8> FullValue;
 							FString DeserializeError;
-							if (!DeserializeLogicValue(ContextStructProp, RawBytes, PerTaskThreads, FullValue, DeserializeError))
+							const bool bDeserialized = Context.bUseProjection ? DeserializeLogicValueProjected(ContextStructProp, RawBytes, Context.ProjectionChains, PerTaskThreads, FullValue, DeserializeError) : DeserializeLogicValue(ContextStructProp, RawBytes, PerTaskThreads, FullValue, DeserializeError);
+							if (!bDeserialized)
 							{
 								LocalError = DeserializeError;
 								bLocalSuccess = false;
@@ -1339,7 +1969,7 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 							else
 							{
 								LocalStats.Scanned = 1;
-								bLocalMatch = EvaluateLogicQueryNode(*Context.Root, FullValue.GetData(), nullptr, nullptr);
+								bLocalMatch = EvaluateLogicQuery(*Context.Root, FullValue.GetData(), nullptr, nullptr);
 								LocalStats.Matched = bLocalMatch ? 1 : 0;
 								if (bLocalMatch)
 								{
@@ -1354,13 +1984,42 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 									}
 									if (Context.bHasAggregates)
 									{
-										if (LocalAggCounts && LocalAggSums)
+										if (LocalAggregates)
 										{
-											for (int32 AggIndex = 0; AggIndex < Context.ParsedAggregateOps.Num(); ++AggIndex)
+											FString GroupKey;
+											for (const FTurboStructLiteSelectFieldInfo& GroupInfo : Context.GroupFieldInfos)
+											{
+												uint8* GroupPtr = ResolvePropertyPtr(GroupInfo.PropertyChain, FullValue.GetData());
+												if (!GroupPtr)
+												{
+													LocalError = TEXT("Type Error: Invalid GROUP BY field pointer");
+													bLocalSuccess = false;
+													break;
+												}
+												AppendValueKey(GroupInfo, GroupPtr, GroupKey);
+											}
+											int32 GroupIndex = INDEX_NONE;
+											if (bLocalSuccess)
+											{
+												bool bAdded = false;
+												GroupIndex = FindOrAddAggregateGroup(*LocalAggregates, GroupKey, NumAggregateOps, bAdded);
+												if (bAdded)
+												{
+													const int32 RowIndex = AddResultRow(LocalAggregates->Keys);
+													for (int32 GroupField = 0; GroupField < Context.GroupFieldInfos.Num(); ++GroupField)
+													{
+														const FTurboStructLiteSelectFieldInfo& GroupInfo = Context.GroupFieldInfos[GroupField];
+														WriteResultCell(LocalAggregates->Keys, GroupField, RowIndex, GroupInfo, ResolvePropertyPtr(GroupInfo.PropertyChain, FullValue.GetData()));
+													}
+												}
+											}
+											for (int32 AggIndex = 0; bLocalSuccess && AggIndex < NumAggregateOps; ++AggIndex)
 											{
-												if (Context.ParsedAggregateOps[AggIndex] == ETurboStructLiteAggregateOp::Count)
+												FTurboStructLiteAggregateState& State = LocalAggregates->States[GroupIndex * NumAggregateOps + AggIndex];
+												const ETurboStructLiteAggregateOp Op = Context.ParsedAggregateOps[AggIndex];
+												if (Op == ETurboStructLiteAggregateOp::Count)
 												{
-													(*LocalAggCounts)[AggIndex] += 1;
+													State.Count += 1;
 													continue;
 												}
 												const int32 FieldIndex = Context.AggregateFieldIndices[AggIndex];
@@ -1378,6 +2037,14 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 													bLocalSuccess = false;
 													break;
 												}
+												if (Op == ETurboStructLiteAggregateOp::CountDistinct)
+												{
+													FString DistinctKey;
+													AppendValueKey(FieldInfo, FieldPtr, DistinctKey);
+													State.DistinctValues.Add(MoveTemp(DistinctKey));
+													State.Count += 1;
+													continue;
+												}
 												double NumericValue = 0.0;
 												if (!TryGetNumericValue(FieldInfo.LeafProperty, FieldPtr, FieldInfo.bCountOnly, false, NumericValue))
 												{
@@ -1385,43 +2052,38 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 													bLocalSuccess = false;
 													break;
 												}
-												(*LocalAggSums)[AggIndex] += NumericValue;
-												(*LocalAggCounts)[AggIndex] += 1;
+												State.Count += 1;
+												State.Sum += NumericValue;
+												State.Min = FMath::Min(State.Min, NumericValue);
+												State.Max = FMath::Max(State.Max, NumericValue);
 											}
 										}
 									}
 									else if (bShouldStore)
 									{
-										for (const FTurboStructLiteSelectFieldInfo& FieldInfo : Context.SelectFieldInfos)
+										if (Context.bHasOrderBy)
 										{
-											if (FieldInfo.bCountOnly)
+											bLocalSuccess = BuildSortKey(FullValue.GetData(), SubSlotIdx, LocalSortKey, LocalError);
+										}
+										// With a full top-K heap, rows that would be evicted immediately are never built.
+										TArray<FTurboStructLiteTopKEntry>* TopK = Context.bUseTopK ? &TaskTopK[TaskIndex] : nullptr;
+										const bool bAdmit = bLocalSuccess && (!TopK || (Context.TopKCount > 0 && (TopK->Num() < Context.TopKCount || SortKeyLess(Context, LocalSortKey, TopK->HeapTop().Key))));
+										if (bAdmit)
+										{
+											FTurboStructLiteResultBuffer& TaskBuffer = TaskResults[TaskIndex];
+											int32 RowIndex = INDEX_NONE;
+											if (TopK && TopK->Num() >= Context.TopKCount)
 											{
-												int32 CountValue = 0;
-												FArrayProperty* ArrayProp = CastField<FArrayProperty>(FieldInfo.LeafProperty);
-												if (!ArrayProp)
-												{
-													LocalError = TEXT("Type Error: Invalid array field");
-													bLocalSuccess = false;
-													break;
-												}
-												uint8* FieldPtr = ResolvePropertyPtr(FieldInfo.PropertyChain, FullValue.GetData());
-												if (!FieldPtr)
-												{
-													LocalError = TEXT("Type Error: Invalid field pointer");
-													bLocalSuccess = false;
-													break;
-												}
-												FScriptArrayHelper Helper(ArrayProp, FieldPtr);
-												CountValue = Helper.Num();
-												FTurboStructLiteVariant Variant;
-												Variant.Type = ETurboStructLiteVariantType::Int;
-												Variant.IntValue = CountValue;
-												Variant.FloatValue = static_cast<double>(CountValue);
-												Variant.StringValue = LexToString(CountValue);
-												LocalRow.Columns.Add(FieldInfo.ColumnName, Variant);
+												RowIndex = TopK->HeapTop().RowIndex;
+												TopK->HeapPopDiscard(TopKHeapOrder);
 											}
 											else
 											{
+												RowIndex = AddResultRow(TaskBuffer);
+											}
+											for (int32 FieldIndex = 0; FieldIndex < Context.SelectFieldInfos.Num(); ++FieldIndex)
+											{
+												const FTurboStructLiteSelectFieldInfo& FieldInfo = Context.SelectFieldInfos[FieldIndex];
 												uint8* FieldPtr = ResolvePropertyPtr(FieldInfo.PropertyChain, FullValue.GetData());
 												if (!FieldPtr)
 												{
@@ -1429,40 +2091,33 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 													bLocalSuccess = false;
 													break;
 												}
-												FTurboStructLiteVariant Variant;
-												if (!UTurboStructLiteBPLibrary::BuildVariantFromProperty(FieldInfo.LeafProperty, FieldPtr, Variant))
+												if (!WriteResultCell(TaskBuffer, FieldIndex, RowIndex, FieldInfo, FieldPtr))
 												{
-													LocalError = TEXT("Type Error: Failed to build variant");
+													LocalError = FieldInfo.bCountOnly ? TEXT("Type Error: Invalid array field") : TEXT("Type Error: Failed to build variant");
 													bLocalSuccess = false;
-													break;
-												}
-												LocalRow.Columns.Add(FieldInfo.ColumnName, Variant);
-											}
-										}
-										if (bLocalSuccess && Context.bHasOrderBy)
-										{
-											uint8* SortPtr = ResolvePropertyPtr(Context.OrderFieldInfo.PropertyChain, FullValue.GetData());
-											if (!SortPtr)
-											{
-												LocalError = TEXT("Type Error: Invalid ORDER BY field pointer");
-												bLocalSuccess = false;
+													break;
+												}
 											}
-											else
+											if (bLocalSuccess)
 											{
-												double NumericValue = 0.0;
-												const bool bSortOk = TryGetNumericValue(Context.OrderFieldInfo.LeafProperty, SortPtr, Context.OrderFieldInfo.bCountOnly, true, NumericValue);
-												const double Fallback = Context.bParsedOrderDesc ? -TNumericLimits<double>::Max() : TNumericLimits<double>::Max();
-												LocalSortValue = bSortOk ? NumericValue : Fallback;
+												if (TopK)
+												{
+													FTurboStructLiteTopKEntry Entry;
+													Entry.Key = MoveTemp(LocalSortKey);
+													Entry.RowIndex = RowIndex;
+													TopK->HeapPush(MoveTemp(Entry), TopKHeapOrder);
+												}
+												else if (Context.bHasOrderBy)
+												{
+													TaskSortKeys[TaskIndex].Add(MoveTemp(LocalSortKey));
+												}
 											}
 										}
-										if (bLocalSuccess)
-										{
-											bStoreRow = true;
-										}
 									}
 									if (Context.bAllowEarlyExit && bApplyOffsetInLoop && MatchesFound >= Context.MaxMatchIndex)
 									{
 										bStopEarly = true;
+										Context.PageStopIndex = SubSlotIdx;
 									}
 								}
 								ContextStructProp->DestroyValue(FullValue.GetData());
@@ -1472,15 +2127,6 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 					if (bLocalSuccess)
 					{
 						SubStats[SubSlotIdx] = LocalStats;
-						if (bStoreRow)
-						{
-							SubMatched[SubSlotIdx] = true;
-							SubRows[SubSlotIdx] = MoveTemp(LocalRow);
-							if (Context.bHasOrderBy)
-							{
-								SubSortKeys[SubSlotIdx] = LocalSortValue;
-							}
-						}
 					}
 					else
 					{
@@ -1493,24 +2139,9 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 				}
 				UTurboStructLiteBPLibrary::SetParallelThreadLimit(PrevTaskParallel);
 			}, EParallelForFlags::Unbalanced);
-			if (Context.bHasAggregates)
+			for (const FTurboStructLiteAggregateTable& TaskTable : TaskAggregates)
 			{
-				for (int32 TaskIndex = 0; TaskIndex < TaskAggregateCounts.Num(); ++TaskIndex)
-				{
-					const TArray<int64>& TaskCounts = TaskAggregateCounts[TaskIndex];
-					const TArray<double>& TaskSums = TaskAggregateSums[TaskIndex];
-					for (int32 AggIndex = 0; AggIndex < Context.ParsedAggregateOps.Num(); ++AggIndex)
-					{
-						if (TaskCounts.IsValidIndex(AggIndex))
-						{
-							Context.AggregateCounts[AggIndex] += TaskCounts[AggIndex];
-						}
-						if (TaskSums.IsValidIndex(AggIndex))
-						{
-							Context.AggregateSums[AggIndex] += TaskSums[AggIndex];
-						}
-					}
-				}
+				MergeAggregateTable(TaskTable, NumAggregateOps, Context.Aggregates);
 			}
 			for (int32 MergeIndex = 0; MergeIndex < Context.SubSlots.Num(); ++MergeIndex)
 			{
@@ -1530,13 +2161,33 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 						OutMetadata = SubInfo.DebugMetadata;
 					}
 				}
-				if (!Context.bHasAggregates && SubMatched[MergeIndex])
+			}
+			if (OutErrorMessage.IsEmpty())
+			{
+				for (int32 TaskIndex = 0; TaskIndex < TaskResults.Num(); ++TaskIndex)
 				{
-					Context.Results.Add(MoveTemp(SubRows[MergeIndex]));
-					if (Context.bHasOrderBy)
+					TArray<int32> RowIndices;
+					if (Context.bUseTopK)
+					{
+						for (FTurboStructLiteTopKEntry& Entry : TaskTopK[TaskIndex])
+						{
+							RowIndices.Add(Entry.RowIndex);
+							Context.SortKeys.Add(MoveTemp(Entry.Key));
+						}
+					}
+					else
 					{
-						Context.SortKeys.Add(SubSortKeys[MergeIndex]);
+						RowIndices.SetNumUninitialized(TaskResults[TaskIndex].NumRows);
+						for (int32 RowIndex = 0; RowIndex < RowIndices.Num(); ++RowIndex)
+						{
+							RowIndices[RowIndex] = RowIndex;
+						}
+						if (Context.bHasOrderBy)
+						{
+							Context.SortKeys.Append(MoveTemp(TaskSortKeys[TaskIndex]));
+						}
 					}
+					AppendResultRows(TaskResults[TaskIndex], RowIndices, Context.Results);
 				}
 			}
 		}
@@ -1546,12 +2197,22 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 	{
 		return false;
 	}
+	if (Context.Page)
+	{
+		// A page that filled up before the last subslot resumes after the one it stopped on.
+		const bool bStopped = Context.PageStopIndex != INDEX_NONE && Context.PageStopIndex < Context.SubSlots.Num() - 1;
+		if (Context.SubSlots.Num() > 0)
+		{
+			Context.Page->LastSubSlot = bStopped ? Context.SubSlots[Context.PageStopIndex] : Context.SubSlots.Last();
+		}
+		Context.Page->bFinished = !bStopped;
+	}
 	return true;
 }
 
 bool UTurboStructLiteQueryLibrary::FinalizeSelectQueryResults(FTurboStructLiteQueryExecutionContext& Context)
 {
-	if (!Context.OutErrorMessage || !Context.OutRows || !Context.OutMetadata || !Context.OutSaveDate || !Context.OutStatsText)
+	if (!Context.OutErrorMessage || !Context.OutResults || !Context.OutMetadata || !Context.OutSaveDate || !Context.OutStatsText)
 	{
 		return false;
 	}
@@ -1561,82 +2222,48 @@ bool UTurboStructLiteQueryLibrary::FinalizeSelectQueryResults(FTurboStructLiteQu
 	{
 		return false;
 	}
+	// Aggregate queries become one row per group, then share the ORDER BY / OFFSET / LIMIT pass with plain rows.
 	if (Context.bHasAggregates)
 	{
-		FTurboStructLiteRow AggregateRow;
-		for (int32 AggIndex = 0; AggIndex < Context.ParsedAggregateOps.Num(); ++AggIndex)
-		{
-			const ETurboStructLiteAggregateOp Op = Context.ParsedAggregateOps[AggIndex];
-			FTurboStructLiteVariant Variant;
-			if (Op == ETurboStructLiteAggregateOp::Count)
-			{
-				const int64 CountValue = Context.AggregateCounts.IsValidIndex(AggIndex) ? Context.AggregateCounts[AggIndex] : 0;
-				Variant.Type = ETurboStructLiteVariantType::Int;
-				Variant.IntValue = CountValue;
-				Variant.FloatValue = static_cast<double>(CountValue);
-				Variant.StringValue = LexToString(CountValue);
-			}
-			else if (Op == ETurboStructLiteAggregateOp::Sum)
-			{
-				const double SumValue = Context.AggregateSums.IsValidIndex(AggIndex) ? Context.AggregateSums[AggIndex] : 0.0;
-				Variant.Type = ETurboStructLiteVariantType::Float;
-				Variant.FloatValue = SumValue;
-				Variant.StringValue = LexToString(SumValue);
-			}
-			else
-			{
-				const double SumValue = Context.AggregateSums.IsValidIndex(AggIndex) ? Context.AggregateSums[AggIndex] : 0.0;
-				const int64 CountValue = Context.AggregateCounts.IsValidIndex(AggIndex) ? Context.AggregateCounts[AggIndex] : 0;
-				const double AvgValue = CountValue > 0 ? (SumValue / static_cast<double>(CountValue)) : 0.0;
-				Variant.Type = ETurboStructLiteVariantType::Float;
-				Variant.FloatValue = AvgValue;
-				Variant.StringValue = LexToString(AvgValue);
-			}
-			if (Context.ParsedAggregateColumns.IsValidIndex(AggIndex))
-			{
-				AggregateRow.Columns.Add(Context.ParsedAggregateColumns[AggIndex], Variant);
-			}
-		}
-		Context.Results.Reset();
-		Context.Results.Add(MoveTemp(AggregateRow));
+		BuildAggregateResults(Context);
 	}
-	else
+	const int32 NumRows = Context.Results.NumRows;
+	TArray<int32> Order;
+	Order.SetNumUninitialized(NumRows);
+	for (int32 Index = 0; Index < NumRows; ++Index)
 	{
-		if (Context.bHasOrderBy && Context.SortKeys.Num() == Context.Results.Num() && Context.Results.Num() > 1)
-		{
-			TArray<int32> Order;
-			Order.SetNum(Context.Results.Num());
-			for (int32 Index = 0; Index < Context.Results.Num(); ++Index)
-			{
-				Order[Index] = Index;
-			}
-			Order.Sort([&](int32 A, int32 B)
-			{
-				return Context.bParsedOrderDesc ? (Context.SortKeys[A] > Context.SortKeys[B]) : (Context.SortKeys[A] < Context.SortKeys[B]);
-			});
-			TArray<FTurboStructLiteRow> SortedResults;
-			SortedResults.Reserve(Context.Results.Num());
-			for (int32 Index : Order)
-			{
-				SortedResults.Add(MoveTemp(Context.Results[Index]));
-			}
-			Context.Results = MoveTemp(SortedResults);
-		}
-		if (Context.bHasOffset && !Context.bOffsetAppliedInLoop)
+		Order[Index] = Index;
+	}
+	const bool bSort = Context.bHasOrderBy && Context.SortKeys.Num() == NumRows && NumRows > 1;
+	if (bSort)
+	{
+		Order.Sort([&](int32 A, int32 B)
 		{
-			if (Context.ParsedOffset >= Context.Results.Num())
-			{
-				Context.Results.Reset();
-			}
-			else if (Context.ParsedOffset > 0)
-			{
-				Context.Results.RemoveAt(0, Context.ParsedOffset);
-			}
-		}
-		if (Context.bHasLimit && !Context.bLimitAppliedInLoop && Context.Results.Num() > Context.ParsedLimit)
+			return SortKeyLess(Context, Context.SortKeys[A], Context.SortKeys[B]);
+		});
+	}
+	int32 First = 0;
+	int32 Count = NumRows;
+	if (Context.bHasOffset && !Context.bOffsetAppliedInLoop)
+	{
+		First = FMath::Min(FMath::Max(Context.ParsedOffset, 0), NumRows);
+		Count = NumRows - First;
+	}
+	if (Context.bHasLimit && !Context.bLimitAppliedInLoop && Count > Context.ParsedLimit)
+	{
+		Count = FMath::Max(Context.ParsedLimit, 0);
+	}
+	// Gather the surviving rows in output order; untouched results are kept as they are.
+	if (bSort || First > 0 || Count < NumRows)
+	{
+		TArray<int32> Selected(Order.GetData() + First, Count);
+		FTurboStructLiteResultBuffer Gathered;
+		if (!Context.bHasAggregates)
 		{
-			Context.Results.SetNum(Context.ParsedLimit);
+			InitResultBuffer(Context.SelectFieldInfos, Gathered);
 		}
+		AppendResultRows(Context.Results, Selected, Gathered);
+		Context.Results = MoveTemp(Gathered);
 	}
 	Context.Stats.ElapsedMs = (FPlatformTime::Seconds() - Context.StartSeconds) * 1000.0;
 	*Context.OutStatsText = FormatLogicStats(Context.Stats);
@@ -1645,13 +2272,13 @@ bool UTurboStructLiteQueryLibrary::FinalizeSelectQueryResults(FTurboStructLiteQu
 	{
 		*Context.OutSaveDate = SlotInfo.Timestamp;
 	}
-	*Context.OutRows = MoveTemp(Context.Results);
+	*Context.OutResults = MoveTemp(Context.Results);
 	return true;
 }
 
-bool UTurboStructLiteQueryLibrary::ExecuteSelectQuery(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, UStruct* ContextStruct, bool& bOutHasAggregates, TArray<FTurboStructLiteRow>& OutRows, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage)
+bool UTurboStructLiteQueryLibrary::ExecuteSelectQuery(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const TSharedPtr<const FTurboStructLiteQueryPlan>& PreparedPlan, const TArray<FString>& Parameters, FTurboStructLiteQueryPageState* Page, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, UStruct* ContextStruct, bool& bOutHasAggregates, FTurboStructLiteResultBuffer& OutResults, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage)
 {
-	OutRows.Reset();
+	OutResults = FTurboStructLiteResultBuffer();
 	OutMetadata.Reset();
 	OutSaveDate = FDateTime(0);
 	OutStatsText.Reset();
@@ -1662,20 +2289,14 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQuery(const FString& SlotName, i
 		OutErrorMessage = TEXT("Type Error: Invalid query context");
 		return false;
 	}
-	UScriptStruct* ScriptStruct = Cast<UScriptStruct>(ContextStruct);
-	if (!ScriptStruct)
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan = PreparedPlan;
+	if (!Plan.IsValid() || !IsQueryPlanCurrent(*Plan, ContextStruct))
 	{
-		OutErrorMessage = TEXT("Type Error: Context struct is invalid");
-		return false;
+		if (!GetQueryPlan(QueryString, ContextStruct, Plan, OutErrorMessage))
+		{
+			return false;
+		}
 	}
-	TUniquePtr<FStructProperty> ContextStructPropOwner;
-	ContextStructPropOwner = MakeUnique<FStructProperty>(FFieldVariant(), NAME_None, RF_NoFlags);
-	ContextStructPropOwner->Struct = ScriptStruct;
-#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
-	ContextStructPropOwner->SetElementSize(ScriptStruct->GetStructureSize());
-#else
-	ContextStructPropOwner->ElementSize = ScriptStruct->GetStructureSize();
-#endif
 
 	FTurboStructLiteQueryExecutionContext Context;
 	Context.SlotName = &SlotName;
@@ -1687,9 +2308,12 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQuery(const FString& SlotName, i
 	Context.bUseWriteAheadLog = bUseWriteAheadLog;
 	Context.WALPath = &WALPath;
 	Context.ContextStruct = ContextStruct;
-	Context.ContextStructProp = ContextStructPropOwner.Get();
+	Context.ContextStructProp = Plan->ContextStructProp.Get();
+	Context.Plan = Plan;
+	Context.Parameters = &Parameters;
+	Context.Page = Page;
 	Context.bOutHasAggregates = &bOutHasAggregates;
-	Context.OutRows = &OutRows;
+	Context.OutResults = &OutResults;
 	Context.OutMetadata = &OutMetadata;
 	Context.OutSaveDate = &OutSaveDate;
 	Context.OutStatsText = &OutStatsText;
@@ -1705,228 +2329,75 @@ bool UTurboStructLiteQueryLibrary::ExecuteSelectQuery(const FString& SlotName, i
 	}
 	if (!FinalizeSelectQueryResults(Context))
 	{
-		return false;
-	}
-	return true;
-}
-DEFINE_FUNCTION(UTurboStructLiteQueryLibrary::execTurboStructLoadArrayLogicLite)
-{
-	P_GET_PROPERTY(FStrProperty, MainSlotName);
-	P_GET_PROPERTY(FIntProperty, SubSlotIndex);
-	P_GET_UBOOL(bAsync);
-	P_GET_PROPERTY(FStrProperty, QueryString);
-
-	Stack.MostRecentProperty = nullptr;
-	Stack.MostRecentPropertyAddress = nullptr;
-	Stack.StepCompiledIn<FArrayProperty>(nullptr);
-	FProperty* DataProp = Stack.MostRecentProperty;
-	void* DataPtr = Stack.MostRecentPropertyAddress;
-
-	P_GET_PROPERTY(FDelegateProperty, OnComplete);
-	P_GET_UBOOL(bUseWriteAheadLog);
-	P_GET_PROPERTY(FIntProperty, QueuePriority);
-	P_GET_PROPERTY(FIntProperty, MaxParallelThreads);
-	P_GET_PROPERTY(FStrProperty, EncryptionKey);
-	P_GET_ENUM(ETurboStructLiteEncryption, Encryption);
-	P_GET_ENUM(ETurboStructLiteBatchingSetting, CompressionBatching);
-
-	P_FINISH;
-
-	FTurboStructLiteLogicLoadComplete LoadDelegate;
-	if (OnComplete.IsBound())
-	{
-		LoadDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
-	}
-
-auto EmitResult = [LoadDelegate, MainSlotName, SubSlotIndex](bool bSuccess, const FString& ErrorMessage, const FString& Metadata, const FDateTime& SaveDate, int32 SaveVersion, const FString& StatsText) mutable
-{
-	FTurboStructLiteLogicLoadComplete Local = LoadDelegate;
-	Local.ExecuteIfBound(bSuccess, ErrorMessage, Metadata, SaveDate, SaveVersion, StatsText);
-	UTurboStructLiteBPLibrary::EndMemoryOpMessage(MainSlotName, SubSlotIndex, false, true);
-};
-
-	const int32 SaveVersion = UTurboStructLiteBPLibrary::GetVersion();
-
-	if (!DataProp || !DataPtr)
-	{
-		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicLite: Invalid data type"), ELogVerbosity::Error);
-		EmitResult(false, TEXT("Type Error: Data must be an array"), FString(), FDateTime(0), SaveVersion, FString());
-		return;
-	}
-	FString TrimmedQuery = QueryString;
-	TrimmedQuery.TrimStartAndEndInline();
-	const bool bSelectMode = TrimmedQuery.StartsWith(TEXT("SELECT"), ESearchCase::IgnoreCase);
-	if (!bSelectMode && !CastField<FArrayProperty>(DataProp))
-	{
-		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicLite: Invalid data type"), ELogVerbosity::Error);
-		EmitResult(false, TEXT("Type Error: Data must be an array"), FString(), FDateTime(0), SaveVersion, FString());
-		return;
-	}
-
-if (MainSlotName.IsEmpty() || SubSlotIndex < -1)
-{
-	FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicLite: Invalid slot parameters"), ELogVerbosity::Error);
-	EmitResult(false, TEXT("IO Error: Invalid slot parameters"), FString(), FDateTime(0), SaveVersion, FString());
-	return;
-}
-
-UTurboStructLiteBPLibrary::BeginMemoryOpMessage(MainSlotName, SubSlotIndex, false, true);
-if (bSelectMode)
-{
-	const ETurboStructLiteEncryption SelectedEncryption = static_cast<ETurboStructLiteEncryption>(Encryption);
-	const ETurboStructLiteEncryption ResolvedEncryption = SelectedEncryption == ETurboStructLiteEncryption::ProjectDefault ? UTurboStructLiteBPLibrary::GetActiveEncryptionMode() : SelectedEncryption;
-	const int32 ClampedPriority = FMath::Clamp(QueuePriority, TurboStructLiteQueryQueuePriorityMin, TurboStructLiteQueryQueuePriorityMax);
-	const int32 ClampedParallel = FMath::Clamp(MaxParallelThreads, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
-	FString WALPath;
-	if (bUseWriteAheadLog)
-	{
-		const FString LoadOpLabel = FString::Printf(TEXT("LoadArrayLogic_Enc%d"), static_cast<int32>(ResolvedEncryption));
-		WALPath = UTurboStructLiteBPLibrary::GenerateWALPath(MainSlotName, SubSlotIndex, LoadOpLabel);
-		UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, FString::Printf(TEXT("Queued LoadArrayLogic Slot=%s SubSlot=%d Async=%s Encryption=%d Queue=%d Threads=%d Batching=%d"), *MainSlotName, SubSlotIndex, bAsync ? TEXT("true") : TEXT("false"), static_cast<int32>(ResolvedEncryption), ClampedPriority, ClampedParallel, static_cast<int32>(CompressionBatching)));
-		UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, FString::Printf(TEXT("Query=%s"), *QueryString));
-	}
-
-	const FString SlotCopy = MainSlotName;
-	const FString EncryptionKeyCopy = EncryptionKey;
-	const FString QueryCopy = QueryString;
-
-	auto RunSelectLoad = [SlotCopy, SubSlotIndex, QueryCopy, DataProp, DataPtr, LoadDelegate, bUseWriteAheadLog, WALPath, EncryptionKeyCopy, SelectedEncryption, ClampedParallel, SaveVersion](bool bApplyOnGameThread) mutable
-	{
-		int64 ExpectedBytes = 0;
-		if (UTurboStructLiteBPLibrary::GetExpectedRawSize(SlotCopy, SubSlotIndex, ExpectedBytes))
-		{
-			UTurboStructLiteBPLibrary::UpdateMemoryPressureWarning(SlotCopy, SubSlotIndex, ExpectedBytes, false, true);
-		}
-		bool bSuccess = false;
-		FString ErrorMessage;
-		FString Metadata;
-		FDateTime SaveDate;
-		FString StatsText;
-		TArray<uint8> CombinedValue;
-		if (ExecuteSelectQueryToValue(SlotCopy, SubSlotIndex, QueryCopy, EncryptionKeyCopy, SelectedEncryption, ClampedParallel, bUseWriteAheadLog, WALPath, DataProp, CombinedValue, Metadata, SaveDate, StatsText, ErrorMessage))
-		{
-			bSuccess = true;
-		}
-		if (bUseWriteAheadLog && !ErrorMessage.IsEmpty())
-		{
-			UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, ErrorMessage);
-		}
-		auto ApplyResults = [SlotCopy, DataProp, DataPtr, LoadDelegate, bUseWriteAheadLog, WALPath, bSuccess, ErrorMessage, Metadata, SaveDate, SaveVersion, StatsText, CombinedValue = MoveTemp(CombinedValue)]() mutable
-		{
-			if (!UTurboStructLiteBPLibrary::HasActiveGameWorld())
-			{
-				if (bUseWriteAheadLog)
-				{
-					UTurboStructLiteBPLibrary::DeleteWALFile(WALPath);
-				}
-				UTurboStructLiteBPLibrary::FinishQueuedLoad(SlotCopy);
-				return;
-			}
-			if (!DataProp || !DataPtr)
-			{
-				if (bUseWriteAheadLog)
-				{
-					UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, TEXT("LoadArrayLogic skipped: invalid target pointer"));
-				}
-				FTurboStructLiteLogicLoadComplete Local = LoadDelegate;
-				Local.ExecuteIfBound(false, TEXT("Type Error: Invalid target pointer"), FString(), FDateTime(0), SaveVersion, FString());
-				UTurboStructLiteBPLibrary::FinishQueuedLoad(SlotCopy);
-				return;
-			}
-			bool bApplied = false;
-			if (bSuccess && CombinedValue.Num() > 0)
-			{
-				bool bSwapped = false;
-				if (CastField<FArrayProperty>(DataProp))
-				{
-					FScriptArray* DestArray = static_cast<FScriptArray*>(DataPtr);
-					FScriptArray* SrcArray = reinterpret_cast<FScriptArray*>(CombinedValue.GetData());
-					FMemory::Memswap(DestArray, SrcArray, sizeof(FScriptArray));
-					bSwapped = true;
-				}
-				else if (CastField<FMapProperty>(DataProp))
-				{
-					FScriptMap* DestMap = static_cast<FScriptMap*>(DataPtr);
-					FScriptMap* SrcMap = reinterpret_cast<FScriptMap*>(CombinedValue.GetData());
-					FMemory::Memswap(DestMap, SrcMap, sizeof(FScriptMap));
-					bSwapped = true;
-				}
-				else if (CastField<FSetProperty>(DataProp))
-				{
-					FScriptSet* DestSet = static_cast<FScriptSet*>(DataPtr);
-					FScriptSet* SrcSet = reinterpret_cast<FScriptSet*>(CombinedValue.GetData());
-					FMemory::Memswap(DestSet, SrcSet, sizeof(FScriptSet));
-					bSwapped = true;
-				}
-				else if (CastField<FStructProperty>(DataProp))
-				{
-					FMemory::Memswap(DataPtr, CombinedValue.GetData(), DataProp->GetSize());
-					bSwapped = true;
-				}
-				if (!bSwapped)
-				{
-					DataProp->CopyCompleteValue(DataPtr, CombinedValue.GetData());
-				}
-				DataProp->DestroyValue(CombinedValue.GetData());
-				bApplied = true;
-			}
-			else if (CombinedValue.Num() > 0 && DataProp)
-			{
-				DataProp->DestroyValue(CombinedValue.GetData());
-			}
-			if (bUseWriteAheadLog)
-			{
-				UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, bApplied && bSuccess ? TEXT("LoadArrayLogic completed") : TEXT("LoadArrayLogic failed"));
-				if (bApplied && bSuccess)
-				{
-					UTurboStructLiteBPLibrary::DeleteWALFile(WALPath);
-				}
-			}
-			FTurboStructLiteLogicLoadComplete Local = LoadDelegate;
-			Local.ExecuteIfBound(bApplied && bSuccess, ErrorMessage, Metadata, SaveDate, SaveVersion, StatsText);
-			UTurboStructLiteBPLibrary::FinishQueuedLoad(SlotCopy);
-		};
+		return false;
+	}
+	return true;
+}
+DEFINE_FUNCTION(UTurboStructLiteQueryLibrary::execTurboStructLoadArrayLogicLite)
+{
+	P_GET_PROPERTY(FStrProperty, MainSlotName);
+	P_GET_PROPERTY(FIntProperty, SubSlotIndex);
+	P_GET_UBOOL(bAsync);
+	P_GET_PROPERTY(FStrProperty, QueryString);
 
-		if (bApplyOnGameThread)
-		{
-			AsyncTask(ENamedThreads::GameThread, MoveTemp(ApplyResults));
-		}
-		else
-		{
-			ApplyResults();
-		}
-	};
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FArrayProperty>(nullptr);
+	FProperty* DataProp = Stack.MostRecentProperty;
+	void* DataPtr = Stack.MostRecentPropertyAddress;
 
-	TArray<const FStructProperty*> DummyStructProps;
-	const bool bCanBackground = DataProp && !DataProp->ContainsObjectReference(DummyStructProps, EPropertyObjectReferenceType::Strong);
+	P_GET_PROPERTY(FDelegateProperty, OnComplete);
+	P_GET_UBOOL(bUseWriteAheadLog);
+	P_GET_PROPERTY(FIntProperty, QueuePriority);
+	P_GET_PROPERTY(FIntProperty, MaxParallelThreads);
+	P_GET_PROPERTY(FStrProperty, EncryptionKey);
+	P_GET_ENUM(ETurboStructLiteEncryption, Encryption);
+	P_GET_ENUM(ETurboStructLiteBatchingSetting, CompressionBatching);
 
-	auto Task = [RunSelectLoad, bAsync, bCanBackground]() mutable
+	P_FINISH;
+
+	FTurboStructLiteLogicLoadComplete LoadDelegate;
+	if (OnComplete.IsBound())
 	{
-		if (bAsync)
-		{
-			if (bCanBackground)
-			{
-				Async(EAsyncExecution::ThreadPool, [RunSelectLoad]() mutable
-				{
-					TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadArrayLogic_AsyncTask"));
-					RunSelectLoad(true);
-				});
-			}
-			else
-			{
-				AsyncTask(ENamedThreads::GameThread, [RunSelectLoad]() mutable
-				{
-					TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadArrayLogic_AsyncTask"));
-					RunSelectLoad(true);
-				});
-			}
-			return;
-		}
-		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadArrayLogic_Sync"));
-		RunSelectLoad(false);
-	};
+		LoadDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
+	}
+
+auto EmitResult = [LoadDelegate, MainSlotName, SubSlotIndex](bool bSuccess, const FString& ErrorMessage, const FString& Metadata, const FDateTime& SaveDate, int32 SaveVersion, const FString& StatsText) mutable
+{
+	FTurboStructLiteLogicLoadComplete Local = LoadDelegate;
+	Local.ExecuteIfBound(bSuccess, ErrorMessage, Metadata, SaveDate, SaveVersion, StatsText);
+	UTurboStructLiteBPLibrary::EndMemoryOpMessage(MainSlotName, SubSlotIndex, false, true);
+};
+
+	const int32 SaveVersion = UTurboStructLiteBPLibrary::GetVersion();
+
+	if (!DataProp || !DataPtr)
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicLite: Invalid data type"), ELogVerbosity::Error);
+		EmitResult(false, TEXT("Type Error: Data must be an array"), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
+	FString TrimmedQuery = QueryString;
+	TrimmedQuery.TrimStartAndEndInline();
+	const bool bSelectMode = TrimmedQuery.StartsWith(TEXT("SELECT"), ESearchCase::IgnoreCase);
+	if (!bSelectMode && !CastField<FArrayProperty>(DataProp))
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicLite: Invalid data type"), ELogVerbosity::Error);
+		EmitResult(false, TEXT("Type Error: Data must be an array"), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
 
-	UTurboStructLiteBPLibrary::EnqueueTask(SlotCopy, MoveTemp(Task), ClampedPriority);
+if (MainSlotName.IsEmpty() || SubSlotIndex < -1)
+{
+	FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicLite: Invalid slot parameters"), ELogVerbosity::Error);
+	EmitResult(false, TEXT("IO Error: Invalid slot parameters"), FString(), FDateTime(0), SaveVersion, FString());
+	return;
+}
+
+UTurboStructLiteBPLibrary::BeginMemoryOpMessage(MainSlotName, SubSlotIndex, false, true);
+if (bSelectMode)
+{
+	EnqueueSelectLogicLoad(MainSlotName, SubSlotIndex, bAsync, QueryString, nullptr, TArray<FString>(), nullptr, DataProp, DataPtr, LoadDelegate, bUseWriteAheadLog, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), CompressionBatching, SaveVersion);
 	return;
 }
 
@@ -2095,6 +2566,10 @@ FString LocalError;
 								{
 									return false;
 								}
+								if (UTurboStructLiteBPLibrary::IsChunkedAesPayload(Entry.Data))
+								{
+									return UTurboStructLiteBPLibrary::DecryptChunkedBuffer(KeyToUse, Entry.Data, Entry.Compression, true, OutRawBytes);
+								}
 								if (!UTurboStructLiteBPLibrary::DecryptDataBuffer(ETurboStructLiteEncryption::AES, KeyToUse, Entry.Data))
 								{
 									return false;
@@ -2193,7 +2668,7 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 											else
 											{
 												LocalStats.Scanned = 1;
-												const bool bMatch = EvaluateLogicQueryNode(*Root, ElementValue.GetData(), nullptr, nullptr);
+												const bool bMatch = EvaluateLogicQuery(*Root, ElementValue.GetData(), nullptr, nullptr);
 												LocalStats.Matched = bMatch ? 1 : 0;
 												const int32 ValueSize = DataProp->GetSize();
 												LocalValue.SetNumUninitialized(ValueSize);
@@ -2527,7 +3002,178 @@ return UTurboStructLiteBPLibrary::DecompressBuffer(Entry.Compression, Entry.Data
 		RunLogicLoad(false);
 	};
 
-	UTurboStructLiteBPLibrary::EnqueueTask(SlotCopy, MoveTemp(Task), ClampedPriority);
+	UTurboStructLiteBPLibrary::EnqueueTask(SlotCopy, MoveTemp(Task), ClampedPriority, TFunction<void()>(), true);
+}
+
+void UTurboStructLiteQueryLibrary::EnqueueSelectLogicLoad(const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FString& QueryString, const TSharedPtr<const FTurboStructLiteQueryPlan>& PreparedPlan, const TArray<FString>& Parameters, FTurboStructLiteQueryCursor* CursorPtr, FProperty* DataProp, void* DataPtr, const FTurboStructLiteLogicLoadComplete& LoadDelegate, bool bUseWriteAheadLog, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, ETurboStructLiteBatchingSetting CompressionBatching, int32 SaveVersion)
+{
+	const ETurboStructLiteEncryption ResolvedEncryption = SelectedEncryption == ETurboStructLiteEncryption::ProjectDefault ? UTurboStructLiteBPLibrary::GetActiveEncryptionMode() : SelectedEncryption;
+	const int32 ClampedPriority = FMath::Clamp(QueuePriority, TurboStructLiteQueryQueuePriorityMin, TurboStructLiteQueryQueuePriorityMax);
+	const int32 ClampedParallel = FMath::Clamp(MaxParallelThreads, 1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	FString WALPath;
+	if (bUseWriteAheadLog)
+	{
+		const FString LoadOpLabel = FString::Printf(TEXT("LoadArrayLogic_Enc%d"), static_cast<int32>(ResolvedEncryption));
+		WALPath = UTurboStructLiteBPLibrary::GenerateWALPath(MainSlotName, SubSlotIndex, LoadOpLabel);
+		UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, FString::Printf(TEXT("Queued LoadArrayLogic Slot=%s SubSlot=%d Async=%s Encryption=%d Queue=%d Threads=%d Batching=%d"), *MainSlotName, SubSlotIndex, bAsync ? TEXT("true") : TEXT("false"), static_cast<int32>(ResolvedEncryption), ClampedPriority, ClampedParallel, static_cast<int32>(CompressionBatching)));
+		UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, FString::Printf(TEXT("Query=%s"), *QueryString));
+	}
+
+	const FString SlotCopy = MainSlotName;
+	const FString EncryptionKeyCopy = EncryptionKey;
+	const FString QueryCopy = QueryString;
+	const TArray<FString> ParametersCopy = Parameters;
+	// A page reads its continuation at queue time; the cursor itself is only advanced on the game thread.
+	TSharedPtr<FTurboStructLiteQueryPageState> PageState;
+	if (CursorPtr)
+	{
+		PageState = MakeShared<FTurboStructLiteQueryPageState>();
+		PageState->ResumeAfterSubSlot = CursorPtr->LastSubSlot;
+		PageState->PageSize = CursorPtr->PageSize;
+	}
+
+	auto RunSelectLoad = [SlotCopy, SubSlotIndex, QueryCopy, PreparedPlan, ParametersCopy, PageState, CursorPtr, DataProp, DataPtr, LoadDelegate, bUseWriteAheadLog, WALPath, EncryptionKeyCopy, SelectedEncryption, ClampedParallel, SaveVersion](bool bApplyOnGameThread) mutable
+	{
+		int64 ExpectedBytes = 0;
+		if (UTurboStructLiteBPLibrary::GetExpectedRawSize(SlotCopy, SubSlotIndex, ExpectedBytes))
+		{
+			UTurboStructLiteBPLibrary::UpdateMemoryPressureWarning(SlotCopy, SubSlotIndex, ExpectedBytes, false, true);
+		}
+		bool bSuccess = false;
+		FString ErrorMessage;
+		FString Metadata;
+		FDateTime SaveDate;
+		FString StatsText;
+		TArray<uint8> CombinedValue;
+		if (ExecuteSelectQueryToValue(SlotCopy, SubSlotIndex, QueryCopy, PreparedPlan, ParametersCopy, PageState.Get(), EncryptionKeyCopy, SelectedEncryption, ClampedParallel, bUseWriteAheadLog, WALPath, DataProp, CombinedValue, Metadata, SaveDate, StatsText, ErrorMessage))
+		{
+			bSuccess = true;
+		}
+		if (bUseWriteAheadLog && !ErrorMessage.IsEmpty())
+		{
+			UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, ErrorMessage);
+		}
+		auto ApplyResults = [SlotCopy, PageState, CursorPtr, DataProp, DataPtr, LoadDelegate, bUseWriteAheadLog, WALPath, bSuccess, ErrorMessage, Metadata, SaveDate, SaveVersion, StatsText, CombinedValue = MoveTemp(CombinedValue)]() mutable
+		{
+			if (!UTurboStructLiteBPLibrary::HasActiveGameWorld())
+			{
+				if (bUseWriteAheadLog)
+				{
+					UTurboStructLiteBPLibrary::DeleteWALFile(WALPath);
+				}
+				UTurboStructLiteBPLibrary::FinishQueuedLoad(SlotCopy);
+				return;
+			}
+			if (!DataProp || !DataPtr)
+			{
+				if (bUseWriteAheadLog)
+				{
+					UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, TEXT("LoadArrayLogic skipped: invalid target pointer"));
+				}
+				FTurboStructLiteLogicLoadComplete Local = LoadDelegate;
+				Local.ExecuteIfBound(false, TEXT("Type Error: Invalid target pointer"), FString(), FDateTime(0), SaveVersion, FString());
+				UTurboStructLiteBPLibrary::FinishQueuedLoad(SlotCopy);
+				return;
+			}
+			bool bApplied = false;
+			if (bSuccess && CombinedValue.Num() > 0)
+			{
+				bool bSwapped = false;
+				if (CastField<FArrayProperty>(DataProp))
+				{
+					FScriptArray* DestArray = static_cast<FScriptArray*>(DataPtr);
+					FScriptArray* SrcArray = reinterpret_cast<FScriptArray*>(CombinedValue.GetData());
+					FMemory::Memswap(DestArray, SrcArray, sizeof(FScriptArray));
+					bSwapped = true;
+				}
+				else if (CastField<FMapProperty>(DataProp))
+				{
+					FScriptMap* DestMap = static_cast<FScriptMap*>(DataPtr);
+					FScriptMap* SrcMap = reinterpret_cast<FScriptMap*>(CombinedValue.GetData());
+					FMemory::Memswap(DestMap, SrcMap, sizeof(FScriptMap));
+					bSwapped = true;
+				}
+				else if (CastField<FSetProperty>(DataProp))
+				{
+					FScriptSet* DestSet = static_cast<FScriptSet*>(DataPtr);
+					FScriptSet* SrcSet = reinterpret_cast<FScriptSet*>(CombinedValue.GetData());
+					FMemory::Memswap(DestSet, SrcSet, sizeof(FScriptSet));
+					bSwapped = true;
+				}
+				else if (CastField<FStructProperty>(DataProp))
+				{
+					FMemory::Memswap(DataPtr, CombinedValue.GetData(), DataProp->GetSize());
+					bSwapped = true;
+				}
+				if (!bSwapped)
+				{
+					DataProp->CopyCompleteValue(DataPtr, CombinedValue.GetData());
+				}
+				DataProp->DestroyValue(CombinedValue.GetData());
+				bApplied = true;
+			}
+			else if (CombinedValue.Num() > 0 && DataProp)
+			{
+				DataProp->DestroyValue(CombinedValue.GetData());
+			}
+			if (bApplied && bSuccess && CursorPtr && PageState.IsValid())
+			{
+				CursorPtr->LastSubSlot = PageState->LastSubSlot;
+				CursorPtr->bFinished = PageState->bFinished;
+			}
+			if (bUseWriteAheadLog)
+			{
+				UTurboStructLiteBPLibrary::WriteWALEntry(WALPath, bApplied && bSuccess ? TEXT("LoadArrayLogic completed") : TEXT("LoadArrayLogic failed"));
+				if (bApplied && bSuccess)
+				{
+					UTurboStructLiteBPLibrary::DeleteWALFile(WALPath);
+				}
+			}
+			FTurboStructLiteLogicLoadComplete Local = LoadDelegate;
+			Local.ExecuteIfBound(bApplied && bSuccess, ErrorMessage, Metadata, SaveDate, SaveVersion, StatsText);
+			UTurboStructLiteBPLibrary::FinishQueuedLoad(SlotCopy);
+		};
+
+		if (bApplyOnGameThread)
+		{
+			AsyncTask(ENamedThreads::GameThread, MoveTemp(ApplyResults));
+		}
+		else
+		{
+			ApplyResults();
+		}
+	};
+
+	TArray<const FStructProperty*> DummyStructProps;
+	const bool bCanBackground = DataProp && !DataProp->ContainsObjectReference(DummyStructProps, EPropertyObjectReferenceType::Strong);
+
+	auto Task = [RunSelectLoad, bAsync, bCanBackground]() mutable
+	{
+		if (bAsync)
+		{
+			if (bCanBackground)
+			{
+				Async(EAsyncExecution::ThreadPool, [RunSelectLoad]() mutable
+				{
+					TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadArrayLogic_AsyncTask"));
+					RunSelectLoad(true);
+				});
+			}
+			else
+			{
+				AsyncTask(ENamedThreads::GameThread, [RunSelectLoad]() mutable
+				{
+					TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadArrayLogic_AsyncTask"));
+					RunSelectLoad(true);
+				});
+			}
+			return;
+		}
+		TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_LoadArrayLogic_Sync"));
+		RunSelectLoad(false);
+	};
+
+	UTurboStructLiteBPLibrary::EnqueueTask(SlotCopy, MoveTemp(Task), ClampedPriority, TFunction<void()>(), true);
 }
 
 
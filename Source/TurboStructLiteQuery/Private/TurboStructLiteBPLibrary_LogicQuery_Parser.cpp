@@ -91,6 +91,23 @@ bool UTurboStructLiteQueryLibrary::ResolveContextStructFromSlot(const FString& S
 			return false;
 		}
 	}
+	// The stored type only changes when the slot file is rewritten, so reuse the last answer while size and timestamp match.
+	const FString SavePath = UTurboStructLiteBPLibrary::BuildSavePath(SlotName);
+	const int64 SlotFileSize = IFileManager::Get().FileSize(*SavePath);
+	const FDateTime SlotTimestamp = IFileManager::Get().GetTimeStamp(*SavePath);
+	const FString CacheKey = FString::Printf(TEXT("%s|%d"), *SlotName, UseSubSlot);
+	{
+		FScopeLock Lock(&ContextStructCacheMutex);
+		if (const FTurboStructLiteContextStructCacheEntry* Cached = ContextStructCache.Find(CacheKey))
+		{
+			UStruct* CachedStruct = Cached->Struct.Get();
+			if (CachedStruct && Cached->FileSize == SlotFileSize && Cached->Timestamp == SlotTimestamp)
+			{
+				OutStruct = CachedStruct;
+				return true;
+			}
+		}
+	}
 	TArray<uint8> RawBytes;
 	if (!UTurboStructLiteBPLibrary::LoadEntry(SlotName, UseSubSlot, EncryptionKey, SelectedEncryption, RawBytes, false, FString()))
 	{
@@ -109,22 +126,31 @@ bool UTurboStructLiteQueryLibrary::ResolveContextStructFromSlot(const FString& S
 		OutErrorMessage = FString::Printf(TEXT("Type Error: Struct '%s' not found"), *RootType);
 		return false;
 	}
+	if (SlotFileSize >= 0)
+	{
+		FScopeLock Lock(&ContextStructCacheMutex);
+		FTurboStructLiteContextStructCacheEntry& Entry = ContextStructCache.FindOrAdd(CacheKey);
+		Entry.FileSize = SlotFileSize;
+		Entry.Timestamp = SlotTimestamp;
+		Entry.Struct = Struct;
+	}
 	OutStruct = Struct;
 	return true;
 }
 
-bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQueryString, const TArray<FString>& InSelectFields, FString& OutQueryString, TArray<FString>& OutSelectFields, int32& OutLimit, int32& OutOffset, FString& OutOrderByField, bool& bOutOrderDescending, TArray<ETurboStructLiteAggregateOp>& OutAggregateOps, TArray<FString>& OutAggregateFields, TArray<FName>& OutAggregateColumns, FString& OutErrorMessage)
+bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQueryString, const TArray<FString>& InSelectFields, FString& OutQueryString, TArray<FString>& OutSelectFields, int32& OutLimit, int32& OutOffset, TArray<FString>& OutOrderByFields, TArray<bool>& OutOrderDescending, TArray<ETurboStructLiteAggregateOp>& OutAggregateOps, TArray<FString>& OutAggregateFields, TArray<FName>& OutAggregateColumns, TArray<FString>& OutGroupByFields, FString& OutErrorMessage)
 {
 	OutErrorMessage.Reset();
 	OutQueryString = InQueryString;
 	OutSelectFields = InSelectFields;
 	OutLimit = 0;
 	OutOffset = 0;
-	OutOrderByField.Reset();
-	bOutOrderDescending = false;
+	OutOrderByFields.Reset();
+	OutOrderDescending.Reset();
 	OutAggregateOps.Reset();
 	OutAggregateFields.Reset();
 	OutAggregateColumns.Reset();
+	OutGroupByFields.Reset();
 
 	const int32 Length = InQueryString.Len();
 	int32 StartIndex = 0;
@@ -189,6 +215,16 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 			}
 			return false;
 		}
+		if (Type == ETurboStructLiteQueryTokenType::Group)
+		{
+			const int32 NextIndex = TokenIndex + 1;
+			if (Tokens.IsValidIndex(NextIndex) && Tokens[NextIndex].Type == ETurboStructLiteQueryTokenType::By)
+			{
+				OutClauseType = Type;
+				return true;
+			}
+			return false;
+		}
 		if (Type == ETurboStructLiteQueryTokenType::Limit || Type == ETurboStructLiteQueryTokenType::Offset)
 		{
 			const int32 NextIndex = TokenIndex + 1;
@@ -207,7 +243,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		return false;
 	};
 
-	auto FindNextClause = [&](int32 SearchStart, bool bAllowWhere, bool bAllowFrom, bool bAllowOrder, bool bAllowLimit, bool bAllowOffset, int32& OutIndex, ETurboStructLiteQueryTokenType& OutClauseType) -> bool
+	auto FindNextClause = [&](int32 SearchStart, bool bAllowWhere, bool bAllowFrom, bool bAllowGroup, bool bAllowOrder, bool bAllowLimit, bool bAllowOffset, int32& OutIndex, ETurboStructLiteQueryTokenType& OutClauseType) -> bool
 	{
 		OutIndex = INDEX_NONE;
 		OutClauseType = ETurboStructLiteQueryTokenType::EndOfInput;
@@ -243,6 +279,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 			}
 			if ((ClauseType == ETurboStructLiteQueryTokenType::Where && bAllowWhere) ||
 				(ClauseType == ETurboStructLiteQueryTokenType::From && bAllowFrom) ||
+				(ClauseType == ETurboStructLiteQueryTokenType::Group && bAllowGroup) ||
 				(ClauseType == ETurboStructLiteQueryTokenType::Order && bAllowOrder) ||
 				(ClauseType == ETurboStructLiteQueryTokenType::Limit && bAllowLimit) ||
 				(ClauseType == ETurboStructLiteQueryTokenType::Offset && bAllowOffset))
@@ -297,7 +334,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		return Text;
 	};
 
-	auto ParseOrderBy = [&](const FString& Text) -> bool
+	auto ParseOrderTerm = [&](const FString& Text) -> bool
 	{
 		FString Trimmed = Text;
 		Trimmed.TrimStartAndEndInline();
@@ -362,29 +399,75 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 				Tail = Trimmed.Mid(SpaceIndex);
 			}
 		}
-		OutOrderByField = NormalizeIdentifier(FieldToken);
-		if (OutOrderByField.IsEmpty())
+		const FString OrderField = NormalizeIdentifier(FieldToken);
+		if (OrderField.IsEmpty())
 		{
 			OutErrorMessage = TEXT("Query Error: ORDER BY has invalid syntax");
 			return false;
 		}
+		bool bDescending = false;
 		Tail.TrimStartAndEndInline();
 		if (!Tail.IsEmpty())
 		{
 			const FString Dir = Tail.ToUpper();
 			if (Dir == TEXT("DESC"))
 			{
-				bOutOrderDescending = true;
+				bDescending = true;
 			}
-			else if (Dir == TEXT("ASC"))
+			else if (Dir != TEXT("ASC"))
 			{
-				bOutOrderDescending = false;
+				OutErrorMessage = TEXT("Query Error: ORDER BY direction must be ASC or DESC");
+				return false;
 			}
-			else
+		}
+		OutOrderByFields.Add(OrderField);
+		OutOrderDescending.Add(bDescending);
+		return true;
+	};
+
+	auto ParseOrderBy = [&](const FString& Text) -> bool
+	{
+		// Terms are split on commas outside quoted field names.
+		TCHAR Quote = 0;
+		bool bEscape = false;
+		int32 TermStart = 0;
+		for (int32 CharIndex = 0; CharIndex <= Text.Len(); ++CharIndex)
+		{
+			if (CharIndex < Text.Len())
+			{
+				const TCHAR Current = Text[CharIndex];
+				if (bEscape)
+				{
+					bEscape = false;
+					continue;
+				}
+				if (Quote != 0)
+				{
+					if (Current == '\\')
+					{
+						bEscape = true;
+					}
+					else if (Current == Quote)
+					{
+						Quote = 0;
+					}
+					continue;
+				}
+				if (Current == '"' || Current == '\'')
+				{
+					Quote = Current;
+					continue;
+				}
+				if (Current != ',')
+				{
+					continue;
+				}
+			}
+			if (!ParseOrderTerm(Text.Mid(TermStart, CharIndex - TermStart)))
 			{
-				OutErrorMessage = TEXT("Query Error: ORDER BY direction must be ASC or DESC");
 				return false;
 			}
+			TermStart = CharIndex + 1;
 		}
 		return true;
 	};
@@ -408,6 +491,11 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		if (UpperFunc == TEXT("COUNT"))
 		{
 			OutOp = ETurboStructLiteAggregateOp::Count;
+			if (OutInner.Len() > 9 && OutInner.Left(8).Equals(TEXT("DISTINCT"), ESearchCase::IgnoreCase) && FChar::IsWhitespace(OutInner[8]))
+			{
+				OutOp = ETurboStructLiteAggregateOp::CountDistinct;
+				OutInner = NormalizeIdentifier(OutInner.Mid(9));
+			}
 			return true;
 		}
 		if (UpperFunc == TEXT("SUM"))
@@ -420,16 +508,26 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 			OutOp = ETurboStructLiteAggregateOp::Avg;
 			return true;
 		}
+		if (UpperFunc == TEXT("MIN"))
+		{
+			OutOp = ETurboStructLiteAggregateOp::Min;
+			return true;
+		}
+		if (UpperFunc == TEXT("MAX"))
+		{
+			OutOp = ETurboStructLiteAggregateOp::Max;
+			return true;
+		}
 		return false;
 	};
 
+	bool bSelectAll = false;
+	bool bHasPlain = false;
+	bool bHasAggregate = false;
 	auto ParseFieldsList = [&](const FString& FieldsPart) -> bool
 	{
 		TArray<FString> RawFields;
 		FieldsPart.ParseIntoArray(RawFields, TEXT(","), false);
-		bool bSelectAll = false;
-		bool bHasPlain = false;
-		bool bHasAggregate = false;
 		OutSelectFields.Reset();
 		OutAggregateOps.Reset();
 		OutAggregateFields.Reset();
@@ -448,6 +546,24 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 				bSelectAll = true;
 				continue;
 			}
+			// An aggregate may be renamed with AS so grouped rows can land on struct fields.
+			FString Alias;
+			const int32 CloseIndex = Field.Find(TEXT(")"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+			if (CloseIndex != INDEX_NONE && CloseIndex < Field.Len() - 1)
+			{
+				FString Tail = Field.Mid(CloseIndex + 1);
+				Tail.TrimStartInline();
+				if (Tail.Len() > 3 && Tail.Left(2).Equals(TEXT("AS"), ESearchCase::IgnoreCase) && FChar::IsWhitespace(Tail[2]))
+				{
+					Alias = NormalizeIdentifier(Tail.Mid(3));
+					if (Alias.IsEmpty())
+					{
+						OutErrorMessage = TEXT("Query Error: AS requires a name");
+						return false;
+					}
+					Field = Field.Left(CloseIndex + 1);
+				}
+			}
 			ETurboStructLiteAggregateOp Op = ETurboStructLiteAggregateOp::Count;
 			FString Inner;
 			if (ParseAggregateToken(Field, Op, Inner))
@@ -457,12 +573,12 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 				{
 					if (!Inner.IsEmpty() && Inner != TEXT("*"))
 					{
-						OutErrorMessage = TEXT("Query Error: COUNT only supports *");
+						OutErrorMessage = TEXT("Query Error: COUNT only supports * or DISTINCT field");
 						return false;
 					}
 					OutAggregateOps.Add(Op);
 					OutAggregateFields.Add(TEXT(""));
-					OutAggregateColumns.Add(FName(TEXT("COUNT")));
+					OutAggregateColumns.Add(FName(Alias.IsEmpty() ? TEXT("COUNT") : *Alias));
 				}
 				else
 				{
@@ -473,8 +589,26 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 					}
 					OutAggregateOps.Add(Op);
 					OutAggregateFields.Add(Inner);
-					const TCHAR* OpName = Op == ETurboStructLiteAggregateOp::Sum ? TEXT("SUM") : TEXT("AVG");
-					const FString Column = FString::Printf(TEXT("%s(%s)"), OpName, *Inner);
+					FString Column = Alias;
+					if (Column.IsEmpty())
+					{
+						const TCHAR* OpName = TEXT("AVG");
+						switch (Op)
+						{
+						case ETurboStructLiteAggregateOp::Sum:
+							OpName = TEXT("SUM");
+							break;
+						case ETurboStructLiteAggregateOp::Min:
+							OpName = TEXT("MIN");
+							break;
+						case ETurboStructLiteAggregateOp::Max:
+							OpName = TEXT("MAX");
+							break;
+						default:
+							break;
+						}
+						Column = Op == ETurboStructLiteAggregateOp::CountDistinct ? FString::Printf(TEXT("COUNT(DISTINCT %s)"), *Inner) : FString::Printf(TEXT("%s(%s)"), OpName, *Inner);
+					}
 					OutAggregateColumns.Add(FName(*Column));
 				}
 				continue;
@@ -488,11 +622,6 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 			OutErrorMessage = TEXT("Query Error: SELECT * cannot be combined with aggregates");
 			return false;
 		}
-		if (bHasAggregate && bHasPlain)
-		{
-			OutErrorMessage = TEXT("Query Error: Aggregates cannot be mixed with fields");
-			return false;
-		}
 		if (bSelectAll)
 		{
 			OutSelectFields.Reset();
@@ -505,6 +634,38 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		return true;
 	};
 
+	// Plain fields may sit next to aggregates only when GROUP BY lists them; checked once all clauses are read.
+	auto ValidateGrouping = [&](bool bParsed) -> bool
+	{
+		if (!bParsed)
+		{
+			return false;
+		}
+		if (OutGroupByFields.Num() == 0)
+		{
+			if (bHasAggregate && bHasPlain)
+			{
+				OutErrorMessage = TEXT("Query Error: Aggregates cannot be mixed with fields");
+				return false;
+			}
+			return true;
+		}
+		if (bSelectAll || (!bHasAggregate && !bHasPlain))
+		{
+			OutErrorMessage = TEXT("Query Error: GROUP BY requires a field list without *");
+			return false;
+		}
+		for (const FString& Field : OutSelectFields)
+		{
+			if (!OutGroupByFields.Contains(Field))
+			{
+				OutErrorMessage = TEXT("Query Error: Selected fields must appear in GROUP BY");
+				return false;
+			}
+		}
+		return true;
+	};
+
 	auto ParseWhereClause = [&](int32 WhereTokenIndex, int32& OutNextIndex) -> bool
 	{
 		const int32 WhereStartIndex = WhereTokenIndex + 1;
@@ -515,7 +676,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		}
 		int32 ClauseIndex = INDEX_NONE;
 		ETurboStructLiteQueryTokenType ClauseType = ETurboStructLiteQueryTokenType::EndOfInput;
-		if (!FindNextClause(WhereStartIndex, false, false, true, true, true, ClauseIndex, ClauseType))
+		if (!FindNextClause(WhereStartIndex, false, false, true, true, true, true, ClauseIndex, ClauseType))
 		{
 			return false;
 		}
@@ -534,6 +695,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 
 	auto ParseTailClauses = [&](int32 TailStartIndex) -> bool
 	{
+		bool bHasGroup = false;
 		bool bHasOrder = false;
 		bool bHasLimit = false;
 		bool bHasOffset = false;
@@ -545,6 +707,47 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 			{
 				return true;
 			}
+			if (Type == ETurboStructLiteQueryTokenType::Group)
+			{
+				if (bHasGroup || bHasOrder || bHasLimit || bHasOffset)
+				{
+					OutErrorMessage = TEXT("Query Error: GROUP BY has invalid syntax");
+					return false;
+				}
+				const int32 GroupExprStartIndex = LocalIndex + 2;
+				int32 ClauseIndex = INDEX_NONE;
+				ETurboStructLiteQueryTokenType ClauseType = ETurboStructLiteQueryTokenType::EndOfInput;
+				if (!FindNextClause(GroupExprStartIndex, false, false, false, true, true, true, ClauseIndex, ClauseType))
+				{
+					return false;
+				}
+				const int32 StartPos = GetTokenPos(GroupExprStartIndex);
+				const int32 EndPos = ClauseIndex == INDEX_NONE ? Length : GetTokenPos(ClauseIndex);
+				TArray<FString> RawGroupFields;
+				InQueryString.Mid(StartPos, EndPos - StartPos).ParseIntoArray(RawGroupFields, TEXT(","), false);
+				for (const FString& RawGroupField : RawGroupFields)
+				{
+					const FString GroupField = NormalizeIdentifier(RawGroupField);
+					if (GroupField.IsEmpty())
+					{
+						OutErrorMessage = TEXT("Query Error: GROUP BY requires a field");
+						return false;
+					}
+					OutGroupByFields.AddUnique(GroupField);
+				}
+				if (OutGroupByFields.Num() == 0)
+				{
+					OutErrorMessage = TEXT("Query Error: GROUP BY requires a field");
+					return false;
+				}
+				bHasGroup = true;
+				if (ClauseIndex == INDEX_NONE)
+				{
+					return true;
+				}
+				LocalIndex = ClauseIndex;
+				continue;
+			}
 			if (Type == ETurboStructLiteQueryTokenType::Order)
 			{
 				if (bHasOrder)
@@ -560,7 +763,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 				const int32 OrderExprStartIndex = LocalIndex + 2;
 				int32 ClauseIndex = INDEX_NONE;
 				ETurboStructLiteQueryTokenType ClauseType = ETurboStructLiteQueryTokenType::EndOfInput;
-				if (!FindNextClause(OrderExprStartIndex, false, false, false, true, true, ClauseIndex, ClauseType))
+				if (!FindNextClause(OrderExprStartIndex, false, false, false, false, true, true, ClauseIndex, ClauseType))
 				{
 					return false;
 				}
@@ -644,9 +847,9 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		}
 		if (NextIndex == INDEX_NONE || NextIndex >= Tokens.Num())
 		{
-			return true;
+			return ValidateGrouping(true);
 		}
-		return ParseTailClauses(NextIndex);
+		return ValidateGrouping(ParseTailClauses(NextIndex));
 	}
 
 	const int32 FieldsStartIndex = Index;
@@ -657,7 +860,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 	}
 	int32 ClauseIndex = INDEX_NONE;
 	ETurboStructLiteQueryTokenType ClauseType = ETurboStructLiteQueryTokenType::EndOfInput;
-	if (!FindNextClause(FieldsStartIndex, true, true, true, true, true, ClauseIndex, ClauseType))
+	if (!FindNextClause(FieldsStartIndex, true, true, true, true, true, true, ClauseIndex, ClauseType))
 	{
 		return false;
 	}
@@ -678,7 +881,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 	if (ClauseIndex == INDEX_NONE)
 	{
 		OutQueryString = TEXT("true");
-		return true;
+		return ValidateGrouping(true);
 	}
 
 	Index = ClauseIndex;
@@ -692,7 +895,7 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		}
 		int32 NameClauseIndex = INDEX_NONE;
 		ETurboStructLiteQueryTokenType NameClauseType = ETurboStructLiteQueryTokenType::EndOfInput;
-		if (!FindNextClause(NameStartIndex, true, false, true, true, true, NameClauseIndex, NameClauseType))
+		if (!FindNextClause(NameStartIndex, true, false, true, true, true, true, NameClauseIndex, NameClauseType))
 		{
 			return false;
 		}
@@ -716,17 +919,17 @@ bool UTurboStructLiteQueryLibrary::ParseSelectQueryString(const FString& InQuery
 		}
 		if (NextIndex == INDEX_NONE || NextIndex >= Tokens.Num())
 		{
-			return true;
+			return ValidateGrouping(true);
 		}
-		return ParseTailClauses(NextIndex);
+		return ValidateGrouping(ParseTailClauses(NextIndex));
 	}
 
 	OutQueryString = TEXT("true");
 	if (Index >= Tokens.Num())
 	{
-		return true;
+		return ValidateGrouping(true);
 	}
-	return ParseTailClauses(Index);
+	return ValidateGrouping(ParseTailClauses(Index));
 }
 
 bool UTurboStructLiteQueryLibrary::TokenizeLogicQuery(const FString& QueryString, TArray<FTurboStructLiteQueryToken>& OutTokens, FString& OutErrorMessage, int32& OutErrorPos, bool bAllowSqlKeywords)
@@ -785,6 +988,12 @@ bool UTurboStructLiteQueryLibrary::TokenizeLogicQuery(const FString& QueryString
 			Index++;
 			continue;
 		}
+		if (Ch == '?')
+		{
+			AddToken(ETurboStructLiteQueryTokenType::Parameter, TEXT("?"), Position);
+			Index++;
+			continue;
+		}
 		if (Ch == '&' && Index + 1 < Length && QueryString[Index + 1] == '&')
 		{
 			AddToken(ETurboStructLiteQueryTokenType::And, TEXT("&&"), Position);
@@ -966,6 +1175,11 @@ bool UTurboStructLiteQueryLibrary::TokenizeLogicQuery(const FString& QueryString
 					AddToken(ETurboStructLiteQueryTokenType::Order, Ident, Position);
 					continue;
 				}
+				if (UpperIdent == TurboStructLiteQueryKey_Group)
+				{
+					AddToken(ETurboStructLiteQueryTokenType::Group, Ident, Position);
+					continue;
+				}
 				if (UpperIdent == TurboStructLiteQueryKey_By)
 				{
 					AddToken(ETurboStructLiteQueryTokenType::By, Ident, Position);
@@ -1023,6 +1237,7 @@ bool UTurboStructLiteQueryLibrary::ParseLogicQuery(const TArray<FTurboStructLite
 		MaxDepth = TurboStructLiteQueryMinRecursionDepth;
 	}
 	int32 CurrentDepth = 0;
+	int32 ParameterCount = 0;
 
 	auto Peek = [&]() -> const FTurboStructLiteQueryToken&
 	{
@@ -1261,6 +1476,10 @@ case ETurboStructLiteQueryTokenType::String:
 				Literal.Type = ETurboStructLiteQueryLiteralType::String;
 				Literal.StringValue = LiteralToken.Text;
 				break;
+			case ETurboStructLiteQueryTokenType::Parameter:
+				Literal.Type = ETurboStructLiteQueryLiteralType::Parameter;
+				Literal.IntValue = ParameterCount++;
+				break;
 			default:
 				return MakeError(TEXT("Expected literal value"), LiteralToken.Position);
 		}
@@ -1325,12 +1544,13 @@ DEFINE_FUNCTION(UTurboStructLiteQueryLibrary::execTurboStructLiteValidateQuery)
 	TArray<FString> ParsedSelectFields;
 	int32 ParsedLimit = 0;
 	int32 ParsedOffset = 0;
-	FString ParsedOrderBy;
-	bool bParsedOrderDesc = false;
+	TArray<FString> ParsedOrderBy;
+	TArray<bool> ParsedOrderDesc;
 	TArray<ETurboStructLiteAggregateOp> ParsedAggregateOps;
 	TArray<FString> ParsedAggregateFields;
 	TArray<FName> ParsedAggregateColumns;
-	if (!ParseSelectQueryString(QueryString, EmptySelectFields, ParsedQueryString, ParsedSelectFields, ParsedLimit, ParsedOffset, ParsedOrderBy, bParsedOrderDesc, ParsedAggregateOps, ParsedAggregateFields, ParsedAggregateColumns, LocalError))
+	TArray<FString> ParsedGroupBy;
+	if (!ParseSelectQueryString(QueryString, EmptySelectFields, ParsedQueryString, ParsedSelectFields, ParsedLimit, ParsedOffset, ParsedOrderBy, ParsedOrderDesc, ParsedAggregateOps, ParsedAggregateFields, ParsedAggregateColumns, ParsedGroupBy, LocalError))
 	{
 		ErrorMessage = LocalError;
 		return;
@@ -1351,7 +1571,7 @@ DEFINE_FUNCTION(UTurboStructLiteQueryLibrary::execTurboStructLiteValidateQuery)
 		return;
 	}
 
-	if (!BindLogicQuery(Root, QueryContext, LocalError, ErrorPos))
+	if (!BindLogicQuery(Root, QueryContext, LocalError, ErrorPos, true))
 	{
 		ErrorMessage = LocalError;
 		return;
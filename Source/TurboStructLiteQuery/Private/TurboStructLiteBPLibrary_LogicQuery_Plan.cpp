@@ -0,0 +1,494 @@
+#include "TurboStructLiteQueryLibrary.h"
+#include "TurboStructLiteBPLibrary.h"
+#include "TurboStructLite.h"
+#include "TurboStructLiteConstantsQuery.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/CriticalSection.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "UObject/Stack.h"
+#include "UObject/UnrealType.h"
+#include "TurboStructLiteDebugMacros.h"
+
+FCriticalSection UTurboStructLiteQueryLibrary::QueryPlanCacheMutex;
+TMap<FString, FTurboStructLiteQueryPlanCacheEntry> UTurboStructLiteQueryLibrary::QueryPlanCache;
+uint64 UTurboStructLiteQueryLibrary::QueryPlanCacheTick = 0;
+FCriticalSection UTurboStructLiteQueryLibrary::ContextStructCacheMutex;
+TMap<FString, FTurboStructLiteContextStructCacheEntry> UTurboStructLiteQueryLibrary::ContextStructCache;
+
+bool UTurboStructLiteQueryLibrary::BuildQueryPlan(const FString& QueryString, UStruct* ContextStruct, TSharedPtr<const FTurboStructLiteQueryPlan>& OutPlan, FString& OutErrorMessage)
+{
+	OutPlan.Reset();
+	OutErrorMessage.Reset();
+	if (!ContextStruct)
+	{
+		OutErrorMessage = TEXT("Type Error: Invalid query context");
+		return false;
+	}
+	UScriptStruct* ScriptStruct = Cast<UScriptStruct>(ContextStruct);
+	if (!ScriptStruct)
+	{
+		OutErrorMessage = TEXT("Type Error: Context struct is invalid");
+		return false;
+	}
+
+	TSharedPtr<FTurboStructLiteQueryPlan> Plan = MakeShared<FTurboStructLiteQueryPlan>();
+	Plan->QueryString = QueryString;
+	Plan->ContextStruct = ContextStruct;
+	Plan->LayoutStamp = ContextStruct->ChildProperties;
+	Plan->StructSize = ContextStruct->GetStructureSize();
+	Plan->ContextStructProp = MakeShared<FStructProperty>(FFieldVariant(), NAME_None, RF_NoFlags);
+	Plan->ContextStructProp->Struct = ScriptStruct;
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+	Plan->ContextStructProp->SetElementSize(ScriptStruct->GetStructureSize());
+#else
+	Plan->ContextStructProp->ElementSize = ScriptStruct->GetStructureSize();
+#endif
+
+	TArray<FString> EmptySelectFields;
+	if (!ParseSelectQueryString(QueryString, EmptySelectFields, Plan->ParsedQueryString, Plan->ParsedSelectFields, Plan->ParsedLimit, Plan->ParsedOffset, Plan->ParsedOrderBy, Plan->ParsedOrderDesc, Plan->ParsedAggregateOps, Plan->ParsedAggregateFields, Plan->ParsedAggregateColumns, Plan->ParsedGroupBy, OutErrorMessage))
+	{
+		return false;
+	}
+	Plan->bHasGroupBy = Plan->ParsedGroupBy.Num() > 0;
+	Plan->bHasAggregates = Plan->ParsedAggregateOps.Num() > 0 || Plan->bHasGroupBy;
+	Plan->bHasOrderBy = !Plan->ParsedOrderBy.IsEmpty();
+	FString TrimmedQuery = Plan->ParsedQueryString;
+	TrimmedQuery.TrimStartAndEndInline();
+	Plan->bQueryIsTrue = TrimmedQuery.Equals(TEXT("true"), ESearchCase::IgnoreCase);
+	Plan->bAggregateCountOnly = Plan->bHasAggregates && !Plan->bHasGroupBy;
+	if (Plan->bAggregateCountOnly)
+	{
+		for (const ETurboStructLiteAggregateOp Op : Plan->ParsedAggregateOps)
+		{
+			if (Op != ETurboStructLiteAggregateOp::Count)
+			{
+				Plan->bAggregateCountOnly = false;
+				break;
+			}
+		}
+	}
+	if (!BuildLogicQueryContext(Plan->ContextStructProp.Get(), Plan->QueryContext, OutErrorMessage))
+	{
+		return false;
+	}
+	TArray<FTurboStructLiteQueryToken> Tokens;
+	int32 ErrorPos = 0;
+	if (!TokenizeLogicQuery(Plan->ParsedQueryString, Tokens, OutErrorMessage, ErrorPos))
+	{
+		return false;
+	}
+	if (!ParseLogicQuery(Tokens, Plan->Root, OutErrorMessage, ErrorPos))
+	{
+		return false;
+	}
+	if (!BindLogicQuery(Plan->Root, Plan->QueryContext, OutErrorMessage, ErrorPos, true))
+	{
+		return false;
+	}
+
+	TFunction<void(const TSharedPtr<FTurboStructLiteQueryNode>&)> CountParameters;
+	CountParameters = [&](const TSharedPtr<FTurboStructLiteQueryNode>& Node)
+	{
+		if (!Node.IsValid())
+		{
+			return;
+		}
+		if (Node->Type == ETurboStructLiteQueryNodeType::Comparison && Node->Comparison.Rhs.Type == ETurboStructLiteQueryLiteralType::Parameter)
+		{
+			Plan->ParameterCount = FMath::Max(Plan->ParameterCount, static_cast<int32>(Node->Comparison.Rhs.IntValue) + 1);
+		}
+		CountParameters(Node->Left);
+		CountParameters(Node->Right);
+	};
+	CountParameters(Plan->Root);
+	if (Plan->ParameterCount > 0)
+	{
+		// Placeholders compile to meaningless constants; each execution compiles its own bound copy instead.
+		Plan->Root->Program.Reset();
+	}
+
+	if (Plan->ParsedSelectFields.IsEmpty() && !Plan->bHasAggregates)
+	{
+		if (Plan->QueryContext.RootStruct)
+		{
+			for (TFieldIterator<FProperty> It(Plan->QueryContext.RootStruct); It; ++It)
+			{
+				Plan->ParsedSelectFields.Add(It->GetName());
+			}
+		}
+	}
+	if (!Plan->bHasAggregates)
+	{
+		if (!BuildSelectFieldInfos(Plan->ParsedSelectFields, Plan->QueryContext.RootStruct, Plan->SelectFieldInfos, OutErrorMessage))
+		{
+			return false;
+		}
+		if (Plan->SelectFieldInfos.Num() == 0)
+		{
+			OutErrorMessage = TEXT("Type Error: No valid select fields");
+			return false;
+		}
+	}
+	// Aggregate queries sort their output rows, so their ORDER BY terms are resolved against output columns below.
+	if (!Plan->bHasAggregates)
+	{
+		for (const FString& OrderField : Plan->ParsedOrderBy)
+		{
+			TArray<FString> OrderFields;
+			OrderFields.Add(OrderField);
+			TArray<FTurboStructLiteSelectFieldInfo> OrderFieldInfos;
+			if (!BuildSelectFieldInfos(OrderFields, Plan->QueryContext.RootStruct, OrderFieldInfos, OutErrorMessage))
+			{
+				return false;
+			}
+			if (OrderFieldInfos.Num() == 0)
+			{
+				OutErrorMessage = TEXT("Type Error: Invalid ORDER BY field");
+				return false;
+			}
+			const FProperty* OrderLeaf = OrderFieldInfos[0].LeafProperty;
+			const bool bStringOrder = !OrderFieldInfos[0].bCountOnly && (CastField<FStrProperty>(OrderLeaf) || CastField<FNameProperty>(OrderLeaf) || CastField<FTextProperty>(OrderLeaf));
+			Plan->OrderIsString.Add(bStringOrder);
+			Plan->OrderFieldInfos.Add(MoveTemp(OrderFieldInfos[0]));
+		}
+	}
+	else
+	{
+		TArray<FString> AggregatePaths;
+		for (int32 Index = 0; Index < Plan->ParsedAggregateOps.Num(); ++Index)
+		{
+			if (Plan->ParsedAggregateOps[Index] != ETurboStructLiteAggregateOp::Count)
+			{
+				const FString& FieldPath = Plan->ParsedAggregateFields[Index];
+				if (!FieldPath.IsEmpty())
+				{
+					AggregatePaths.AddUnique(FieldPath);
+				}
+			}
+		}
+		if (AggregatePaths.Num() > 0)
+		{
+			if (!BuildSelectFieldInfos(AggregatePaths, Plan->QueryContext.RootStruct, Plan->AggregateFieldInfos, OutErrorMessage))
+			{
+				return false;
+			}
+		}
+		TMap<FName, int32> AggregateIndexMap;
+		for (int32 Index = 0; Index < Plan->AggregateFieldInfos.Num(); ++Index)
+		{
+			AggregateIndexMap.Add(Plan->AggregateFieldInfos[Index].ColumnName, Index);
+		}
+		Plan->AggregateFieldIndices.Init(INDEX_NONE, Plan->ParsedAggregateOps.Num());
+		for (int32 Index = 0; Index < Plan->ParsedAggregateOps.Num(); ++Index)
+		{
+			if (Plan->ParsedAggregateOps[Index] != ETurboStructLiteAggregateOp::Count)
+			{
+				const FName FieldName = FName(*Plan->ParsedAggregateFields[Index]);
+				const int32* FoundIndex = AggregateIndexMap.Find(FieldName);
+				if (!FoundIndex)
+				{
+					OutErrorMessage = TEXT("Type Error: Invalid aggregate field");
+					return false;
+				}
+				Plan->AggregateFieldIndices[Index] = *FoundIndex;
+			}
+		}
+		if (Plan->bHasGroupBy)
+		{
+			if (!BuildSelectFieldInfos(Plan->ParsedGroupBy, Plan->QueryContext.RootStruct, Plan->GroupFieldInfos, OutErrorMessage))
+			{
+				return false;
+			}
+			for (const FTurboStructLiteSelectFieldInfo& GroupInfo : Plan->GroupFieldInfos)
+			{
+				const FProperty* GroupLeaf = GroupInfo.LeafProperty;
+				const FNumericProperty* GroupNumeric = CastField<FNumericProperty>(GroupLeaf);
+				const bool bGroupable = GroupInfo.bCountOnly || CastField<FEnumProperty>(GroupLeaf) || (GroupNumeric && GroupNumeric->IsInteger()) || CastField<FBoolProperty>(GroupLeaf) || CastField<FNameProperty>(GroupLeaf) || CastField<FStrProperty>(GroupLeaf) || CastField<FTextProperty>(GroupLeaf);
+				if (!bGroupable)
+				{
+					OutErrorMessage = TEXT("Type Error: GROUP BY field must be enum, name, integer, string or bool");
+					return false;
+				}
+			}
+		}
+		// Output columns are the group keys followed by one column per distinct aggregate name.
+		TArray<FName> OutputNames;
+		for (const FTurboStructLiteSelectFieldInfo& GroupInfo : Plan->GroupFieldInfos)
+		{
+			OutputNames.Add(GroupInfo.ColumnName);
+		}
+		const int32 GroupColumnCount = OutputNames.Num();
+		for (const FName ColumnName : Plan->ParsedAggregateColumns)
+		{
+			int32 ColumnIndex = INDEX_NONE;
+			for (int32 ExistingIndex = GroupColumnCount; ExistingIndex < OutputNames.Num(); ++ExistingIndex)
+			{
+				if (OutputNames[ExistingIndex] == ColumnName)
+				{
+					ColumnIndex = ExistingIndex;
+					break;
+				}
+			}
+			if (ColumnIndex == INDEX_NONE)
+			{
+				ColumnIndex = OutputNames.Add(ColumnName);
+			}
+			Plan->AggregateOutputColumns.Add(ColumnIndex);
+		}
+		for (const FString& OrderField : Plan->ParsedOrderBy)
+		{
+			const int32 ColumnIndex = OutputNames.IndexOfByKey(FName(*OrderField));
+			if (ColumnIndex == INDEX_NONE)
+			{
+				OutErrorMessage = TEXT("Type Error: ORDER BY must name a GROUP BY field or aggregate column");
+				return false;
+			}
+			const FProperty* OrderLeaf = Plan->GroupFieldInfos.IsValidIndex(ColumnIndex) && !Plan->GroupFieldInfos[ColumnIndex].bCountOnly ? Plan->GroupFieldInfos[ColumnIndex].LeafProperty : nullptr;
+			Plan->OrderIsString.Add(CastField<FStrProperty>(OrderLeaf) || CastField<FNameProperty>(OrderLeaf) || CastField<FTextProperty>(OrderLeaf));
+			Plan->AggregateOrderColumns.Add(ColumnIndex);
+		}
+	}
+	OutPlan = Plan;
+	return true;
+}
+
+bool UTurboStructLiteQueryLibrary::IsQueryPlanCurrent(const FTurboStructLiteQueryPlan& Plan, const UStruct* ContextStruct)
+{
+	const UStruct* PlanStruct = Plan.ContextStruct.Get();
+	if (!PlanStruct || (ContextStruct && PlanStruct != ContextStruct))
+	{
+		return false;
+	}
+	return PlanStruct->ChildProperties == Plan.LayoutStamp && PlanStruct->GetStructureSize() == Plan.StructSize;
+}
+
+bool UTurboStructLiteQueryLibrary::GetQueryPlan(const FString& QueryString, UStruct* ContextStruct, TSharedPtr<const FTurboStructLiteQueryPlan>& OutPlan, FString& OutErrorMessage)
+{
+	OutPlan.Reset();
+	if (!ContextStruct)
+	{
+		OutErrorMessage = TEXT("Type Error: Invalid query context");
+		return false;
+	}
+	const FString CacheKey = FString::Printf(TEXT("%s|%s"), *ContextStruct->GetPathName(), *QueryString);
+	{
+		FScopeLock Lock(&QueryPlanCacheMutex);
+		if (FTurboStructLiteQueryPlanCacheEntry* Entry = QueryPlanCache.Find(CacheKey))
+		{
+			if (Entry->Plan.IsValid() && IsQueryPlanCurrent(*Entry->Plan, ContextStruct))
+			{
+				Entry->LastUsed = ++QueryPlanCacheTick;
+				OutPlan = Entry->Plan;
+				return true;
+			}
+			QueryPlanCache.Remove(CacheKey);
+		}
+	}
+
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan;
+	if (!BuildQueryPlan(QueryString, ContextStruct, Plan, OutErrorMessage))
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&QueryPlanCacheMutex);
+	if (!QueryPlanCache.Contains(CacheKey) && QueryPlanCache.Num() >= TurboStructLiteQueryPlanCacheCapacity)
+	{
+		const FString* OldestKey = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<FString, FTurboStructLiteQueryPlanCacheEntry>& Pair : QueryPlanCache)
+		{
+			if (Pair.Value.LastUsed < OldestUse)
+			{
+				OldestUse = Pair.Value.LastUsed;
+				OldestKey = &Pair.Key;
+			}
+		}
+		if (OldestKey)
+		{
+			const FString EvictKey = *OldestKey;
+			QueryPlanCache.Remove(EvictKey);
+		}
+	}
+	FTurboStructLiteQueryPlanCacheEntry& Entry = QueryPlanCache.FindOrAdd(CacheKey);
+	Entry.Plan = Plan;
+	Entry.LastUsed = ++QueryPlanCacheTick;
+	OutPlan = Plan;
+	return true;
+}
+
+void UTurboStructLiteQueryLibrary::FlushQueryPlanCache()
+{
+	{
+		FScopeLock Lock(&QueryPlanCacheMutex);
+		QueryPlanCache.Reset();
+	}
+	FScopeLock Lock(&ContextStructCacheMutex);
+	ContextStructCache.Reset();
+}
+
+bool UTurboStructLiteQueryLibrary::BindQueryParameters(const FTurboStructLiteQueryPlan& Plan, const TArray<FString>& Parameters, TSharedPtr<FTurboStructLiteQueryNode>& OutRoot, FString& OutErrorMessage)
+{
+	OutRoot.Reset();
+	if (Parameters.Num() != Plan.ParameterCount)
+	{
+		OutErrorMessage = FString::Printf(TEXT("Binder Error: Query expects %d parameter(s), got %d"), Plan.ParameterCount, Parameters.Num());
+		return false;
+	}
+	if (Plan.ParameterCount == 0)
+	{
+		OutRoot = Plan.Root;
+		return true;
+	}
+
+	bool bValuesValid = true;
+	TFunction<TSharedPtr<FTurboStructLiteQueryNode>(const TSharedPtr<FTurboStructLiteQueryNode>&)> CloneNode;
+	CloneNode = [&](const TSharedPtr<FTurboStructLiteQueryNode>& Source) -> TSharedPtr<FTurboStructLiteQueryNode>
+	{
+		if (!Source.IsValid())
+		{
+			return nullptr;
+		}
+		TSharedPtr<FTurboStructLiteQueryNode> Copy = MakeShared<FTurboStructLiteQueryNode>();
+		Copy->Type = Source->Type;
+		Copy->Comparison = Source->Comparison;
+		Copy->Left = CloneNode(Source->Left);
+		Copy->Right = CloneNode(Source->Right);
+		FTurboStructLiteQueryComparison& Comparison = Copy->Comparison;
+		if (Copy->Type != ETurboStructLiteQueryNodeType::Comparison || Comparison.Rhs.Type != ETurboStructLiteQueryLiteralType::Parameter)
+		{
+			return Copy;
+		}
+
+		// Hand the binder the literal shape it would have parsed from text, so the usual conversions and type errors apply.
+		const FString& Value = Parameters[static_cast<int32>(Comparison.Rhs.IntValue)];
+		const FProperty* Target = Comparison.Lhs.bIsContainer ? Comparison.Lhs.ContainerElementProperty : Comparison.Lhs.LeafProperty;
+		FTurboStructLiteQueryLiteral Literal;
+		int64 IntValue = 0;
+		if (CastField<FBoolProperty>(Target))
+		{
+			Literal.Type = ETurboStructLiteQueryLiteralType::Boolean;
+			if (Value.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Value == TEXT("1"))
+			{
+				Literal.BoolValue = true;
+			}
+			else if (!Value.Equals(TEXT("false"), ESearchCase::IgnoreCase) && Value != TEXT("0"))
+			{
+				OutErrorMessage = FString::Printf(TEXT("Type Error (col=%d): Expected boolean parameter"), Comparison.LiteralPosition);
+				bValuesValid = false;
+			}
+		}
+		else if (!CastField<FStrProperty>(Target) && !CastField<FNameProperty>(Target) && !Value.Contains(TEXT(".")) && LexTryParseString(IntValue, *Value))
+		{
+			Literal.Type = ETurboStructLiteQueryLiteralType::Integer;
+			Literal.IntValue = IntValue;
+		}
+		else
+		{
+			Literal.Type = ETurboStructLiteQueryLiteralType::String;
+			Literal.StringValue = Value;
+		}
+		Comparison.Rhs = MoveTemp(Literal);
+		return Copy;
+	};
+
+	TSharedPtr<FTurboStructLiteQueryNode> Root = CloneNode(Plan.Root);
+	if (!bValuesValid)
+	{
+		return false;
+	}
+	int32 ErrorPos = 0;
+	if (!BindLogicQuery(Root, Plan.QueryContext, OutErrorMessage, ErrorPos))
+	{
+		return false;
+	}
+	OutRoot = Root;
+	return true;
+}
+
+bool UTurboStructLiteQueryLibrary::TurboStructLitePrepareQuery(const FString& MainSlotName, int32 SubSlotIndex, const FString& QueryString, FTurboStructLitePreparedQuery& OutPreparedQuery, FString& OutErrorMessage, const FString& EncryptionKey, ETurboStructLiteEncryption Encryption)
+{
+	TURBOSTRUCTLITE_TRACE_SCOPE(TEXT("TurboStructLite_PrepareQuery"));
+	OutPreparedQuery = FTurboStructLitePreparedQuery();
+	OutErrorMessage.Reset();
+	if (MainSlotName.IsEmpty() || SubSlotIndex < -1)
+	{
+		OutErrorMessage = TEXT("IO Error: Invalid slot parameters");
+		return false;
+	}
+	FString TrimmedQuery = QueryString;
+	TrimmedQuery.TrimStartAndEndInline();
+	if (!TrimmedQuery.StartsWith(TEXT("SELECT"), ESearchCase::IgnoreCase))
+	{
+		OutErrorMessage = TEXT("Syntax Error: Prepared queries must be SELECT statements");
+		return false;
+	}
+	UStruct* ContextStruct = nullptr;
+	if (!ResolveContextStructFromSlot(MainSlotName, SubSlotIndex, EncryptionKey, Encryption, ContextStruct, OutErrorMessage))
+	{
+		return false;
+	}
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan;
+	if (!GetQueryPlan(QueryString, ContextStruct, Plan, OutErrorMessage))
+	{
+		return false;
+	}
+	OutPreparedQuery.SlotName = MainSlotName;
+	OutPreparedQuery.SubSlotIndex = SubSlotIndex;
+	OutPreparedQuery.QueryString = QueryString;
+	OutPreparedQuery.ParameterCount = Plan->ParameterCount;
+	OutPreparedQuery.bIsValid = true;
+	OutPreparedQuery.Plan = Plan;
+	return true;
+}
+
+DEFINE_FUNCTION(UTurboStructLiteQueryLibrary::execTurboStructLoadArrayLogicPreparedLite)
+{
+	P_GET_STRUCT_REF(FTurboStructLitePreparedQuery, PreparedQuery);
+	P_GET_TARRAY_REF(FString, Parameters);
+	P_GET_UBOOL(bAsync);
+
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FArrayProperty>(nullptr);
+	FProperty* DataProp = Stack.MostRecentProperty;
+	void* DataPtr = Stack.MostRecentPropertyAddress;
+
+	P_GET_PROPERTY(FDelegateProperty, OnComplete);
+	P_GET_UBOOL(bUseWriteAheadLog);
+	P_GET_PROPERTY(FIntProperty, QueuePriority);
+	P_GET_PROPERTY(FIntProperty, MaxParallelThreads);
+	P_GET_PROPERTY(FStrProperty, EncryptionKey);
+	P_GET_ENUM(ETurboStructLiteEncryption, Encryption);
+	P_GET_ENUM(ETurboStructLiteBatchingSetting, CompressionBatching);
+
+	P_FINISH;
+
+	FTurboStructLiteLogicLoadComplete LoadDelegate;
+	if (OnComplete.IsBound())
+	{
+		LoadDelegate.BindUFunction(OnComplete.GetUObject(), OnComplete.GetFunctionName());
+	}
+
+	const int32 SaveVersion = UTurboStructLiteBPLibrary::GetVersion();
+	if (!DataProp || !DataPtr)
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicPreparedLite: Invalid data type"), ELogVerbosity::Error);
+		LoadDelegate.ExecuteIfBound(false, TEXT("Type Error: Data must be an array"), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
+	if (!PreparedQuery.bIsValid || PreparedQuery.SlotName.IsEmpty())
+	{
+		FFrame::KismetExecutionMessage(TEXT("TurboStructLoadArrayLogicPreparedLite: Query is not prepared"), ELogVerbosity::Error);
+		LoadDelegate.ExecuteIfBound(false, TEXT("Binder Error: Query is not prepared"), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
+	if (Parameters.Num() != PreparedQuery.ParameterCount)
+	{
+		LoadDelegate.ExecuteIfBound(false, FString::Printf(TEXT("Binder Error: Query expects %d parameter(s), got %d"), PreparedQuery.ParameterCount, Parameters.Num()), FString(), FDateTime(0), SaveVersion, FString());
+		return;
+	}
+
+	UTurboStructLiteBPLibrary::BeginMemoryOpMessage(PreparedQuery.SlotName, PreparedQuery.SubSlotIndex, false, true);
+	EnqueueSelectLogicLoad(PreparedQuery.SlotName, PreparedQuery.SubSlotIndex, bAsync, PreparedQuery.QueryString, PreparedQuery.Plan, Parameters, nullptr, DataProp, DataPtr, LoadDelegate, bUseWriteAheadLog, QueuePriority, MaxParallelThreads, EncryptionKey, static_cast<ETurboStructLiteEncryption>(Encryption), CompressionBatching, SaveVersion);
+}
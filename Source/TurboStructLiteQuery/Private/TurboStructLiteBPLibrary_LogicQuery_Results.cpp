@@ -0,0 +1,372 @@
+#include "TurboStructLiteQueryLibrary.h"
+#include "TurboStructLiteBPLibrary.h"
+#include "TurboStructLite.h"
+
+void UTurboStructLiteQueryLibrary::InitResultBuffer(const TArray<FTurboStructLiteSelectFieldInfo>& Fields, FTurboStructLiteResultBuffer& OutBuffer)
+{
+	OutBuffer = FTurboStructLiteResultBuffer();
+	OutBuffer.Columns.SetNum(Fields.Num());
+	for (int32 ColumnIndex = 0; ColumnIndex < Fields.Num(); ++ColumnIndex)
+	{
+		const FTurboStructLiteSelectFieldInfo& FieldInfo = Fields[ColumnIndex];
+		FTurboStructLiteResultColumn& Column = OutBuffer.Columns[ColumnIndex];
+		Column.ColumnName = FieldInfo.ColumnName;
+		const FProperty* Leaf = FieldInfo.LeafProperty;
+		if (FieldInfo.bCountOnly)
+		{
+			Column.Type = ETurboStructLiteVariantType::Int;
+		}
+		else if (CastField<FBoolProperty>(Leaf))
+		{
+			Column.Type = ETurboStructLiteVariantType::Bool;
+		}
+		else if (const FNumericProperty* NumProp = CastField<FNumericProperty>(Leaf))
+		{
+			Column.Type = NumProp->IsInteger() ? ETurboStructLiteVariantType::Int : ETurboStructLiteVariantType::Float;
+		}
+		else if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Leaf))
+		{
+			Column.Type = ETurboStructLiteVariantType::Int;
+			Column.Enum = EnumProp->GetEnum();
+		}
+		else if (CastField<FNameProperty>(Leaf))
+		{
+			Column.Type = ETurboStructLiteVariantType::Name;
+		}
+		else if (CastField<FStrProperty>(Leaf) || CastField<FTextProperty>(Leaf))
+		{
+			Column.Type = ETurboStructLiteVariantType::String;
+		}
+		else
+		{
+			Column.Type = ETurboStructLiteVariantType::Struct;
+		}
+	}
+}
+
+int32 UTurboStructLiteQueryLibrary::AddResultRow(FTurboStructLiteResultBuffer& Buffer)
+{
+	for (FTurboStructLiteResultColumn& Column : Buffer.Columns)
+	{
+		switch (Column.Type)
+		{
+		case ETurboStructLiteVariantType::Int:
+		case ETurboStructLiteVariantType::Bool:
+			Column.Ints.Add(0);
+			break;
+		case ETurboStructLiteVariantType::Float:
+			Column.Floats.Add(0.0);
+			break;
+		case ETurboStructLiteVariantType::Name:
+			Column.Names.AddDefaulted();
+			break;
+		default:
+			Column.StringOffsets.Add(0);
+			Column.StringLengths.Add(0);
+			break;
+		}
+	}
+	return Buffer.NumRows++;
+}
+
+bool UTurboStructLiteQueryLibrary::WriteResultCell(FTurboStructLiteResultBuffer& Buffer, int32 ColumnIndex, int32 RowIndex, const FTurboStructLiteSelectFieldInfo& FieldInfo, uint8* FieldPtr)
+{
+	if (!Buffer.Columns.IsValidIndex(ColumnIndex) || RowIndex < 0 || RowIndex >= Buffer.NumRows || !FieldPtr)
+	{
+		return false;
+	}
+	FTurboStructLiteResultColumn& Column = Buffer.Columns[ColumnIndex];
+	const FProperty* Leaf = FieldInfo.LeafProperty;
+	auto StoreString = [&Buffer, &Column, RowIndex](const FString& Value)
+	{
+		Column.StringOffsets[RowIndex] = Buffer.StringArena.Num();
+		Column.StringLengths[RowIndex] = Value.Len();
+		Buffer.StringArena.Append(*Value, Value.Len());
+	};
+	if (FieldInfo.bCountOnly)
+	{
+		const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Leaf);
+		if (!ArrayProp)
+		{
+			return false;
+		}
+		FScriptArrayHelper Helper(ArrayProp, FieldPtr);
+		Column.Ints[RowIndex] = Helper.Num();
+		return true;
+	}
+	switch (Column.Type)
+	{
+	case ETurboStructLiteVariantType::Bool:
+		if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Leaf))
+		{
+			Column.Ints[RowIndex] = BoolProp->GetPropertyValue(FieldPtr) ? 1 : 0;
+			return true;
+		}
+		return false;
+	case ETurboStructLiteVariantType::Int:
+		if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Leaf))
+		{
+			Column.Ints[RowIndex] = EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(FieldPtr);
+			return true;
+		}
+		if (const FNumericProperty* NumProp = CastField<FNumericProperty>(Leaf))
+		{
+			Column.Ints[RowIndex] = NumProp->GetSignedIntPropertyValue(FieldPtr);
+			return true;
+		}
+		return false;
+	case ETurboStructLiteVariantType::Float:
+		if (const FNumericProperty* NumProp = CastField<FNumericProperty>(Leaf))
+		{
+			Column.Floats[RowIndex] = NumProp->GetFloatingPointPropertyValue(FieldPtr);
+			return true;
+		}
+		return false;
+	case ETurboStructLiteVariantType::Name:
+		if (const FNameProperty* NameProp = CastField<FNameProperty>(Leaf))
+		{
+			Column.Names[RowIndex] = NameProp->GetPropertyValue(FieldPtr);
+			return true;
+		}
+		return false;
+	case ETurboStructLiteVariantType::String:
+		if (const FStrProperty* StrProp = CastField<FStrProperty>(Leaf))
+		{
+			const FString* Value = StrProp->GetPropertyValuePtr(FieldPtr);
+			if (!Value)
+			{
+				return false;
+			}
+			StoreString(*Value);
+			return true;
+		}
+		if (const FTextProperty* TextProp = CastField<FTextProperty>(Leaf))
+		{
+			StoreString(TextProp->GetPropertyValue(FieldPtr).ToString());
+			return true;
+		}
+		return false;
+	default:
+		break;
+	}
+	if (!Leaf)
+	{
+		return false;
+	}
+	FString Exported;
+	Leaf->ExportTextItem_Direct(Exported, FieldPtr, nullptr, nullptr, PPF_None);
+	StoreString(Exported);
+	return true;
+}
+
+bool UTurboStructLiteQueryLibrary::AppendResultRows(const FTurboStructLiteResultBuffer& Source, const TArray<int32>& RowIndices, FTurboStructLiteResultBuffer& Dest)
+{
+	if (Dest.Columns.Num() == 0 && Dest.NumRows == 0)
+	{
+		Dest.Columns.SetNum(Source.Columns.Num());
+		for (int32 ColumnIndex = 0; ColumnIndex < Source.Columns.Num(); ++ColumnIndex)
+		{
+			Dest.Columns[ColumnIndex].ColumnName = Source.Columns[ColumnIndex].ColumnName;
+			Dest.Columns[ColumnIndex].Type = Source.Columns[ColumnIndex].Type;
+			Dest.Columns[ColumnIndex].Enum = Source.Columns[ColumnIndex].Enum;
+		}
+	}
+	if (Dest.Columns.Num() != Source.Columns.Num())
+	{
+		return false;
+	}
+	for (const int32 RowIndex : RowIndices)
+	{
+		if (RowIndex < 0 || RowIndex >= Source.NumRows)
+		{
+			return false;
+		}
+	}
+	for (int32 ColumnIndex = 0; ColumnIndex < Source.Columns.Num(); ++ColumnIndex)
+	{
+		const FTurboStructLiteResultColumn& From = Source.Columns[ColumnIndex];
+		FTurboStructLiteResultColumn& To = Dest.Columns[ColumnIndex];
+		switch (From.Type)
+		{
+		case ETurboStructLiteVariantType::Int:
+		case ETurboStructLiteVariantType::Bool:
+			To.Ints.Reserve(To.Ints.Num() + RowIndices.Num());
+			for (const int32 RowIndex : RowIndices)
+			{
+				To.Ints.Add(From.Ints[RowIndex]);
+			}
+			break;
+		case ETurboStructLiteVariantType::Float:
+			To.Floats.Reserve(To.Floats.Num() + RowIndices.Num());
+			for (const int32 RowIndex : RowIndices)
+			{
+				To.Floats.Add(From.Floats[RowIndex]);
+			}
+			break;
+		case ETurboStructLiteVariantType::Name:
+			To.Names.Reserve(To.Names.Num() + RowIndices.Num());
+			for (const int32 RowIndex : RowIndices)
+			{
+				To.Names.Add(From.Names[RowIndex]);
+			}
+			break;
+		default:
+			To.StringOffsets.Reserve(To.StringOffsets.Num() + RowIndices.Num());
+			To.StringLengths.Reserve(To.StringLengths.Num() + RowIndices.Num());
+			for (const int32 RowIndex : RowIndices)
+			{
+				const int32 Length = From.StringLengths[RowIndex];
+				To.StringOffsets.Add(Dest.StringArena.Num());
+				To.StringLengths.Add(Length);
+				Dest.StringArena.Append(Source.StringArena.GetData() + From.StringOffsets[RowIndex], Length);
+			}
+			break;
+		}
+	}
+	Dest.NumRows += RowIndices.Num();
+	return true;
+}
+
+bool UTurboStructLiteQueryLibrary::BuildVariantFromResult(const FTurboStructLiteResultBuffer& Results, int32 ColumnIndex, int32 RowIndex, FTurboStructLiteVariant& OutVariant)
+{
+	OutVariant = FTurboStructLiteVariant();
+	if (!Results.Columns.IsValidIndex(ColumnIndex) || RowIndex < 0 || RowIndex >= Results.NumRows)
+	{
+		return false;
+	}
+	const FTurboStructLiteResultColumn& Column = Results.Columns[ColumnIndex];
+	OutVariant.Type = Column.Type;
+	switch (Column.Type)
+	{
+	case ETurboStructLiteVariantType::Bool:
+		OutVariant.BoolValue = Column.Ints[RowIndex] != 0;
+		OutVariant.StringValue = OutVariant.BoolValue ? TEXT("true") : TEXT("false");
+		return true;
+	case ETurboStructLiteVariantType::Int:
+		OutVariant.IntValue = Column.Ints[RowIndex];
+		OutVariant.FloatValue = static_cast<double>(OutVariant.IntValue);
+		if (Column.Enum)
+		{
+			OutVariant.StringValue = Column.Enum->GetNameStringByValue(OutVariant.IntValue);
+			OutVariant.NameValue = FName(*OutVariant.StringValue);
+		}
+		else
+		{
+			OutVariant.StringValue = LexToString(OutVariant.IntValue);
+		}
+		return true;
+	case ETurboStructLiteVariantType::Float:
+		OutVariant.FloatValue = Column.Floats[RowIndex];
+		OutVariant.IntValue = static_cast<int64>(OutVariant.FloatValue);
+		OutVariant.StringValue = LexToString(OutVariant.FloatValue);
+		return true;
+	case ETurboStructLiteVariantType::Name:
+		OutVariant.NameValue = Column.Names[RowIndex];
+		OutVariant.StringValue = OutVariant.NameValue.ToString();
+		return true;
+	default:
+		OutVariant.StringValue = FString(FStringView(Results.StringArena.GetData() + Column.StringOffsets[RowIndex], Column.StringLengths[RowIndex]));
+		return true;
+	}
+}
+
+void UTurboStructLiteQueryLibrary::ResolveResultColumnTargets(const FTurboStructLiteResultBuffer& Results, UStruct* Struct, TArray<TArray<FProperty*>>& OutChains)
+{
+	OutChains.Reset();
+	OutChains.SetNum(Results.Columns.Num());
+	auto FindPropertyByName = [&](UStruct* InStruct, const FString& Segment) -> FProperty*
+	{
+		if (!InStruct)
+		{
+			return nullptr;
+		}
+		FProperty* Found = FindFProperty<FProperty>(InStruct, *Segment);
+		if (Found)
+		{
+			return Found;
+		}
+		FProperty* Match = nullptr;
+		for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+		{
+			FProperty* Prop = *It;
+			const FString DisplayName = Prop->GetDisplayNameText().ToString();
+			if (DisplayName.Equals(Segment, ESearchCase::IgnoreCase))
+			{
+				if (Match)
+				{
+					return nullptr;
+				}
+				Match = Prop;
+			}
+		}
+		return Match;
+	};
+	for (int32 ColumnIndex = 0; ColumnIndex < Results.Columns.Num(); ++ColumnIndex)
+	{
+		FString ColumnName = Results.Columns[ColumnIndex].ColumnName.ToString();
+		ColumnName.TrimStartAndEndInline();
+		if (ColumnName.IsEmpty())
+		{
+			continue;
+		}
+		TArray<FString> Segments;
+		ColumnName.ParseIntoArray(Segments, TEXT("."), true);
+		UStruct* CurrentStruct = Struct;
+		TArray<FProperty*> Chain;
+		for (int32 Index = 0; Index < Segments.Num(); ++Index)
+		{
+			FProperty* Found = FindPropertyByName(CurrentStruct, Segments[Index]);
+			if (!Found)
+			{
+				Chain.Reset();
+				break;
+			}
+			Chain.Add(Found);
+			if (Index < Segments.Num() - 1)
+			{
+				FStructProperty* NextStruct = CastField<FStructProperty>(Found);
+				if (!NextStruct)
+				{
+					Chain.Reset();
+					break;
+				}
+				CurrentStruct = NextStruct->Struct;
+			}
+		}
+		OutChains[ColumnIndex] = MoveTemp(Chain);
+	}
+}
+
+bool UTurboStructLiteQueryLibrary::ApplyResultRowToStruct(const FTurboStructLiteResultBuffer& Results, int32 RowIndex, const TArray<TArray<FProperty*>>& ColumnTargets, void* StructPtr, FString& OutErrorMessage)
+{
+	OutErrorMessage.Reset();
+	if (!StructPtr)
+	{
+		OutErrorMessage = TEXT("Type Error: Invalid struct output");
+		return false;
+	}
+	FTurboStructLiteVariant Variant;
+	for (int32 ColumnIndex = 0; ColumnIndex < Results.Columns.Num() && ColumnIndex < ColumnTargets.Num(); ++ColumnIndex)
+	{
+		const TArray<FProperty*>& Chain = ColumnTargets[ColumnIndex];
+		if (Chain.Num() == 0)
+		{
+			continue;
+		}
+		uint8* CurrentPtr = static_cast<uint8*>(StructPtr);
+		for (FProperty* Prop : Chain)
+		{
+			CurrentPtr = Prop->ContainerPtrToValuePtr<uint8>(CurrentPtr);
+		}
+		if (!CurrentPtr)
+		{
+			continue;
+		}
+		if (!BuildVariantFromResult(Results, ColumnIndex, RowIndex, Variant) || !UTurboStructLiteBPLibrary::TryApplyVariantToProperty(Chain.Last(), CurrentPtr, Variant))
+		{
+			OutErrorMessage = TEXT("Type Error: Failed to apply query result");
+			return false;
+		}
+	}
+	return true;
+}
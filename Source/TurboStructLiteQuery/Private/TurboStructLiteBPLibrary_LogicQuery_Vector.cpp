@@ -0,0 +1,318 @@
+#include "TurboStructLiteQueryLibrary.h"
+#include "TurboStructLiteConstantsQuery.h"
+#include "Math/VectorRegister.h"
+#include "Math/NumericLimits.h"
+
+bool UTurboStructLiteQueryLibrary::BuildVectorPredicate(const FTurboStructLiteQueryNode& Root, FTurboStructLiteVectorPredicate& OutPredicate)
+{
+	OutPredicate.Steps.Reset();
+	if (!Root.Program.IsValid())
+	{
+		return false;
+	}
+
+	// The compiled program already resolved offsets and literal types; reuse it per comparison node.
+	TMap<const FTurboStructLiteQueryNode*, const FTurboStructLiteQueryInstruction*> NodeInstructions;
+	for (const FTurboStructLiteQueryInstruction& Instruction : Root.Program->Instructions)
+	{
+		if (Instruction.Node)
+		{
+			NodeInstructions.Add(Instruction.Node, &Instruction);
+		}
+	}
+
+	TFunction<bool(const FTurboStructLiteQueryNode&)> EmitNode;
+	EmitNode = [&](const FTurboStructLiteQueryNode& Node) -> bool
+	{
+		switch (Node.Type)
+		{
+			case ETurboStructLiteQueryNodeType::And:
+			case ETurboStructLiteQueryNodeType::Or:
+			{
+				if (!Node.Left.IsValid() || !Node.Right.IsValid() || !EmitNode(*Node.Left) || !EmitNode(*Node.Right))
+				{
+					return false;
+				}
+				OutPredicate.Steps.AddDefaulted_GetRef().Type = Node.Type == ETurboStructLiteQueryNodeType::And ? ETurboStructLiteVectorStepType::And : ETurboStructLiteVectorStepType::Or;
+				return true;
+			}
+			case ETurboStructLiteQueryNodeType::Not:
+			{
+				if (!Node.Left.IsValid() || !EmitNode(*Node.Left))
+				{
+					return false;
+				}
+				OutPredicate.Steps.AddDefaulted_GetRef().Type = ETurboStructLiteVectorStepType::Not;
+				return true;
+			}
+			case ETurboStructLiteQueryNodeType::Comparison:
+			{
+				const FTurboStructLiteQueryInstruction* const* Found = NodeInstructions.Find(&Node);
+				if (!Found)
+				{
+					return false;
+				}
+				const FTurboStructLiteQueryInstruction& Instruction = **Found;
+				FTurboStructLiteVectorStep& Step = OutPredicate.Steps.AddDefaulted_GetRef();
+				if (Instruction.OpCode == ETurboStructLiteQueryOpCode::Constant)
+				{
+					Step.Type = ETurboStructLiteVectorStepType::Constant;
+					Step.IntValue = Instruction.IntValue;
+					return true;
+				}
+				if (Instruction.Root != ETurboStructLiteQueryValueRoot::Root)
+				{
+					return false;
+				}
+				switch (Instruction.OpCode)
+				{
+					case ETurboStructLiteQueryOpCode::CmpInt8:
+					case ETurboStructLiteQueryOpCode::CmpUInt8:
+					case ETurboStructLiteQueryOpCode::CmpInt16:
+					case ETurboStructLiteQueryOpCode::CmpUInt16:
+					case ETurboStructLiteQueryOpCode::CmpUInt32:
+					case ETurboStructLiteQueryOpCode::CmpInt64:
+					case ETurboStructLiteQueryOpCode::CmpDouble:
+					case ETurboStructLiteQueryOpCode::CmpBool:
+						break;
+					case ETurboStructLiteQueryOpCode::CmpInt32:
+						Step.bUseVector = Instruction.IntValue >= MIN_int32 && Instruction.IntValue <= MAX_int32;
+						break;
+					case ETurboStructLiteQueryOpCode::CmpFloat:
+						// Float lanes only give the scalar (double) answer when the literal survives the round trip.
+						Step.bUseVector = static_cast<double>(static_cast<float>(Instruction.FloatValue)) == Instruction.FloatValue;
+						break;
+					default:
+						return false;
+				}
+				Step.Type = ETurboStructLiteVectorStepType::Compare;
+				Step.OpCode = Instruction.OpCode;
+				Step.Op = Instruction.Op;
+				Step.Offset = Instruction.Offset;
+				Step.BoolMask = Instruction.BoolMask;
+				Step.IntValue = Instruction.IntValue;
+				Step.FloatValue = Instruction.FloatValue;
+				return true;
+			}
+			default:
+				return false;
+		}
+	};
+
+	if (!EmitNode(Root))
+	{
+		OutPredicate.Steps.Reset();
+		return false;
+	}
+	return true;
+}
+
+void UTurboStructLiteQueryLibrary::EvaluateVectorPredicate(const FTurboStructLiteVectorPredicate& Predicate, const uint8* BasePtr, int32 Stride, int32 Count, uint64* OutSelection)
+{
+	auto CompareInt = [](ETurboStructLiteQueryCompareOp Op, int64 Value, int64 Literal) -> bool
+	{
+		switch (Op)
+		{
+			case ETurboStructLiteQueryCompareOp::Equal:
+				return Value == Literal;
+			case ETurboStructLiteQueryCompareOp::NotEqual:
+				return Value != Literal;
+			case ETurboStructLiteQueryCompareOp::Greater:
+				return Value > Literal;
+			case ETurboStructLiteQueryCompareOp::Less:
+				return Value < Literal;
+			case ETurboStructLiteQueryCompareOp::GreaterEqual:
+				return Value >= Literal;
+			case ETurboStructLiteQueryCompareOp::LessEqual:
+				return Value <= Literal;
+			default:
+				return false;
+		}
+	};
+
+	auto CompareFloat = [](ETurboStructLiteQueryCompareOp Op, double Value, double Literal) -> bool
+	{
+		switch (Op)
+		{
+			case ETurboStructLiteQueryCompareOp::Equal:
+				return Value == Literal;
+			case ETurboStructLiteQueryCompareOp::NotEqual:
+				return Value != Literal;
+			case ETurboStructLiteQueryCompareOp::Greater:
+				return Value > Literal;
+			case ETurboStructLiteQueryCompareOp::Less:
+				return Value < Literal;
+			case ETurboStructLiteQueryCompareOp::GreaterEqual:
+				return Value >= Literal;
+			case ETurboStructLiteQueryCompareOp::LessEqual:
+				return Value <= Literal;
+			default:
+				return false;
+		}
+	};
+
+	auto EvaluateLane = [&](const FTurboStructLiteVectorStep& Step, const uint8* Ptr) -> bool
+	{
+		switch (Step.OpCode)
+		{
+			case ETurboStructLiteQueryOpCode::CmpInt8:
+				return CompareInt(Step.Op, *reinterpret_cast<const int8*>(Ptr), Step.IntValue);
+			case ETurboStructLiteQueryOpCode::CmpUInt8:
+				return CompareInt(Step.Op, *Ptr, Step.IntValue);
+			case ETurboStructLiteQueryOpCode::CmpInt16:
+				return CompareInt(Step.Op, *reinterpret_cast<const int16*>(Ptr), Step.IntValue);
+			case ETurboStructLiteQueryOpCode::CmpUInt16:
+				return CompareInt(Step.Op, *reinterpret_cast<const uint16*>(Ptr), Step.IntValue);
+			case ETurboStructLiteQueryOpCode::CmpInt32:
+				return CompareInt(Step.Op, *reinterpret_cast<const int32*>(Ptr), Step.IntValue);
+			case ETurboStructLiteQueryOpCode::CmpUInt32:
+				return CompareInt(Step.Op, *reinterpret_cast<const uint32*>(Ptr), Step.IntValue);
+			case ETurboStructLiteQueryOpCode::CmpInt64:
+				return CompareInt(Step.Op, *reinterpret_cast<const int64*>(Ptr), Step.IntValue);
+			case ETurboStructLiteQueryOpCode::CmpFloat:
+				return CompareFloat(Step.Op, *reinterpret_cast<const float*>(Ptr), Step.FloatValue);
+			case ETurboStructLiteQueryOpCode::CmpDouble:
+				return CompareFloat(Step.Op, *reinterpret_cast<const double*>(Ptr), Step.FloatValue);
+			case ETurboStructLiteQueryOpCode::CmpBool:
+			{
+				const int64 Value = (*Ptr & Step.BoolMask) != 0 ? 1 : 0;
+				return Step.Op == ETurboStructLiteQueryCompareOp::Equal ? Value == Step.IntValue : Value != Step.IntValue;
+			}
+			default:
+				return false;
+		}
+	};
+
+	// Four lanes per compare; elements are strided, so lanes are gathered into an aligned block first.
+	auto CompareInt32Lanes = [](ETurboStructLiteQueryCompareOp Op, const uint8* Ptr, int32 LaneStride, const VectorRegister4Int& Literal) -> uint64
+	{
+		alignas(16) int32 Lanes[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			FMemory::Memcpy(&Lanes[Lane], Ptr + static_cast<SIZE_T>(Lane) * LaneStride, sizeof(int32));
+		}
+		const VectorRegister4Int Values = VectorIntLoadAligned(Lanes);
+		VectorRegister4Int Result;
+		switch (Op)
+		{
+			case ETurboStructLiteQueryCompareOp::Equal:
+				Result = VectorIntCompareEQ(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::NotEqual:
+				Result = VectorIntCompareNEQ(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::Greater:
+				Result = VectorIntCompareGT(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::Less:
+				Result = VectorIntCompareLT(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::GreaterEqual:
+				Result = VectorIntCompareGE(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::LessEqual:
+				Result = VectorIntCompareLE(Values, Literal);
+				break;
+			default:
+				return 0;
+		}
+		return static_cast<uint64>(VectorMaskBits(VectorCastIntToFloat(Result)));
+	};
+
+	auto CompareFloatLanes = [](ETurboStructLiteQueryCompareOp Op, const uint8* Ptr, int32 LaneStride, const VectorRegister4Float& Literal) -> uint64
+	{
+		alignas(16) float Lanes[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			FMemory::Memcpy(&Lanes[Lane], Ptr + static_cast<SIZE_T>(Lane) * LaneStride, sizeof(float));
+		}
+		const VectorRegister4Float Values = VectorLoadAligned(Lanes);
+		VectorRegister4Float Result;
+		switch (Op)
+		{
+			case ETurboStructLiteQueryCompareOp::Equal:
+				Result = VectorCompareEQ(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::NotEqual:
+				Result = VectorCompareNE(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::Greater:
+				Result = VectorCompareGT(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::Less:
+				Result = VectorCompareLT(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::GreaterEqual:
+				Result = VectorCompareGE(Values, Literal);
+				break;
+			case ETurboStructLiteQueryCompareOp::LessEqual:
+				Result = VectorCompareLE(Values, Literal);
+				break;
+			default:
+				return 0;
+		}
+		return static_cast<uint64>(VectorMaskBits(Result));
+	};
+
+	TArray<uint64, TInlineAllocator<16>> Stack;
+	const int32 WordCount = FMath::DivideAndRoundUp(Count, TurboStructLiteQueryVectorBlockSize);
+	for (int32 Word = 0; Word < WordCount; ++Word)
+	{
+		const int32 BlockStart = Word * TurboStructLiteQueryVectorBlockSize;
+		const int32 BlockCount = FMath::Min(TurboStructLiteQueryVectorBlockSize, Count - BlockStart);
+		const uint64 ValidMask = BlockCount == TurboStructLiteQueryVectorBlockSize ? MAX_uint64 : ((static_cast<uint64>(1) << BlockCount) - 1);
+		const uint8* BlockPtr = BasePtr + static_cast<SIZE_T>(BlockStart) * Stride;
+		Stack.Reset();
+		for (const FTurboStructLiteVectorStep& Step : Predicate.Steps)
+		{
+			switch (Step.Type)
+			{
+				case ETurboStructLiteVectorStepType::Constant:
+					Stack.Add(Step.IntValue != 0 ? ValidMask : 0);
+					break;
+				case ETurboStructLiteVectorStepType::Not:
+					Stack.Last() = ~Stack.Last() & ValidMask;
+					break;
+				case ETurboStructLiteVectorStepType::And:
+				case ETurboStructLiteVectorStepType::Or:
+				{
+					const uint64 Right = Stack.Pop();
+					Stack.Last() = Step.Type == ETurboStructLiteVectorStepType::And ? (Stack.Last() & Right) : (Stack.Last() | Right);
+					break;
+				}
+				case ETurboStructLiteVectorStepType::Compare:
+				{
+					const uint8* FieldPtr = BlockPtr + Step.Offset;
+					uint64 Mask = 0;
+					int32 Lane = 0;
+					if (Step.bUseVector && Step.OpCode == ETurboStructLiteQueryOpCode::CmpInt32)
+					{
+						const VectorRegister4Int Literal = VectorIntSet1(static_cast<int32>(Step.IntValue));
+						for (; Lane + 4 <= BlockCount; Lane += 4)
+						{
+							Mask |= CompareInt32Lanes(Step.Op, FieldPtr + static_cast<SIZE_T>(Lane) * Stride, Stride, Literal) << Lane;
+						}
+					}
+					else if (Step.bUseVector && Step.OpCode == ETurboStructLiteQueryOpCode::CmpFloat)
+					{
+						const VectorRegister4Float Literal = VectorSetFloat1(static_cast<float>(Step.FloatValue));
+						for (; Lane + 4 <= BlockCount; Lane += 4)
+						{
+							Mask |= CompareFloatLanes(Step.Op, FieldPtr + static_cast<SIZE_T>(Lane) * Stride, Stride, Literal) << Lane;
+						}
+					}
+					for (; Lane < BlockCount; ++Lane)
+					{
+						Mask |= static_cast<uint64>(EvaluateLane(Step, FieldPtr + static_cast<SIZE_T>(Lane) * Stride)) << Lane;
+					}
+					Stack.Add(Mask);
+					break;
+				}
+				default:
+					Stack.Add(0);
+					break;
+			}
+		}
+		OutSelection[Word] = Stack.Num() > 0 ? Stack.Last() : 0;
+	}
+}
@@ -1,13 +1,26 @@
 #include "TurboStructLiteQuery.h"
+#include "TurboStructLiteQueryLibrary.h"
+#include "UObject/UObjectGlobals.h"
 
 void FTurboStructLiteQueryModule::StartupModule()
 {
+	// Cached query plans hold bound property pointers, so drop them whenever structs are reinstanced or code reloads.
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([](const TMap<UObject*, UObject*>&)
+	{
+		UTurboStructLiteQueryLibrary::FlushQueryPlanCache();
+	});
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+	{
+		UTurboStructLiteQueryLibrary::FlushQueryPlanCache();
+	});
 }
 
 void FTurboStructLiteQueryModule::ShutdownModule()
 {
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	UTurboStructLiteQueryLibrary::FlushQueryPlanCache();
 }
 
 IMPLEMENT_MODULE(FTurboStructLiteQueryModule, TurboStructLiteQuery)
 
-
@@ -12,6 +12,12 @@ inline constexpr int32 TurboStructLiteQueryQueuePriorityMax = 100;
 inline constexpr int32 TurboStructLiteQueryDefaultMaxRecursionDepth = 100;
 // Minimum allowed recursion depth clamp.
 inline constexpr int32 TurboStructLiteQueryMinRecursionDepth = 1;
+// Maximum number of prepared query plans kept in the LRU plan cache.
+inline constexpr int32 TurboStructLiteQueryPlanCacheCapacity = 64;
+// Minimum array length before filters switch to the batched selection-bitmap predicate path.
+inline constexpr int32 TurboStructLiteQueryVectorMinElements = 64;
+// Elements evaluated per selection-bitmap word.
+inline constexpr int32 TurboStructLiteQueryVectorBlockSize = 64;
 // SQL keyword: SELECT.
 inline const FString TurboStructLiteQueryKey_Select = TEXT("SELECT");
 // SQL keyword: FROM.
@@ -20,6 +26,8 @@ inline const FString TurboStructLiteQueryKey_From = TEXT("FROM");
 inline const FString TurboStructLiteQueryKey_Where = TEXT("WHERE");
 // SQL keyword: ORDER.
 inline const FString TurboStructLiteQueryKey_Order = TEXT("ORDER");
+// SQL keyword: GROUP.
+inline const FString TurboStructLiteQueryKey_Group = TEXT("GROUP");
 // SQL keyword: BY.
 inline const FString TurboStructLiteQueryKey_By = TEXT("BY");
 // SQL keyword: LIMIT.
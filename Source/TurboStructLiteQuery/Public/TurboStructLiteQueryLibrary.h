@@ -26,14 +26,39 @@ class TURBOSTRUCTLITEQUERY_API UTurboStructLiteQueryLibrary : public UBlueprintF
 {
 	GENERATED_BODY()
 
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FTurboStructLiteSecondaryIndexQueryTest;
+#endif
+
 public:
 	// Load an array using a logic query (async).
 	UFUNCTION(BlueprintCallable, CustomThunk, Category = "TurboStructLite Logic Query", meta = (ArrayParm = "Data", ArrayTypeDependentParams = "Data", AutoCreateRefTerm = "QueryString,bUseWriteAheadLog,OnComplete,QueuePriority,MaxParallelThreads,EncryptionKey,CompressionBatching", AdvancedDisplay = "bUseWriteAheadLog,QueuePriority,MaxParallelThreads,EncryptionKey,Encryption,CompressionBatching", CPP_Default_SubSlotIndex = "-1"))
 	static void TurboStructLoadArrayLogicLite(const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FString& QueryString, UPARAM(ref) TArray<int32>& Data, const FTurboStructLiteLogicLoadComplete& OnComplete, bool bUseWriteAheadLog = false, int32 QueuePriority = 10, int32 MaxParallelThreads = 4, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault, ETurboStructLiteBatchingSetting CompressionBatching = ETurboStructLiteBatchingSetting::ProjectDefault);
 
+	// Parse and bind a SELECT query once for a slot's stored type; '?' placeholders are filled per execution.
+	UFUNCTION(BlueprintCallable, Category = "TurboStructLite Logic Query", meta = (AutoCreateRefTerm = "EncryptionKey", AdvancedDisplay = "EncryptionKey,Encryption", CPP_Default_SubSlotIndex = "-1"))
+	static bool TurboStructLitePrepareQuery(const FString& MainSlotName, int32 SubSlotIndex, const FString& QueryString, FTurboStructLitePreparedQuery& OutPreparedQuery, FString& OutErrorMessage, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault);
+
+	// Load an array using a prepared query and its parameter values (async).
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "TurboStructLite Logic Query", meta = (ArrayParm = "Data", ArrayTypeDependentParams = "Data", AutoCreateRefTerm = "Parameters,bUseWriteAheadLog,OnComplete,QueuePriority,MaxParallelThreads,EncryptionKey,CompressionBatching", AdvancedDisplay = "bUseWriteAheadLog,QueuePriority,MaxParallelThreads,EncryptionKey,Encryption,CompressionBatching"))
+	static void TurboStructLoadArrayLogicPreparedLite(const FTurboStructLitePreparedQuery& PreparedQuery, const TArray<FString>& Parameters, bool bAsync, UPARAM(ref) TArray<int32>& Data, const FTurboStructLiteLogicLoadComplete& OnComplete, bool bUseWriteAheadLog = false, int32 QueuePriority = 10, int32 MaxParallelThreads = 4, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault, ETurboStructLiteBatchingSetting CompressionBatching = ETurboStructLiteBatchingSetting::ProjectDefault);
+
+	// Open a paged cursor over a SELECT query; each fetch returns up to PageSize rows in subslot order.
+	UFUNCTION(BlueprintCallable, Category = "TurboStructLite Logic Query", meta = (AutoCreateRefTerm = "EncryptionKey", AdvancedDisplay = "EncryptionKey,Encryption", CPP_Default_SubSlotIndex = "-1", CPP_Default_PageSize = "100"))
+	static bool TurboStructLiteOpenQueryCursor(const FString& MainSlotName, int32 SubSlotIndex, const FString& QueryString, int32 PageSize, FTurboStructLiteQueryCursor& OutCursor, FString& OutErrorMessage, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault);
+
+	// Load the next page of a cursor into an array and advance the cursor once the page is applied (async).
+	UFUNCTION(BlueprintCallable, CustomThunk, Category = "TurboStructLite Logic Query", meta = (ArrayParm = "Data", ArrayTypeDependentParams = "Data", AutoCreateRefTerm = "bUseWriteAheadLog,OnComplete,QueuePriority,MaxParallelThreads,EncryptionKey,CompressionBatching", AdvancedDisplay = "bUseWriteAheadLog,QueuePriority,MaxParallelThreads,EncryptionKey,Encryption,CompressionBatching"))
+	static void TurboStructLiteFetchQueryPage(UPARAM(ref) FTurboStructLiteQueryCursor& Cursor, bool bAsync, UPARAM(ref) TArray<int32>& Data, const FTurboStructLiteLogicLoadComplete& OnComplete, bool bUseWriteAheadLog = false, int32 QueuePriority = 10, int32 MaxParallelThreads = 4, const FString& EncryptionKey = TEXT(""), ETurboStructLiteEncryption Encryption = ETurboStructLiteEncryption::ProjectDefault, ETurboStructLiteBatchingSetting CompressionBatching = ETurboStructLiteBatchingSetting::ProjectDefault);
+
+	// Drop every cached query plan and slot type lookup (called when structs are reinstanced or reloaded).
+	static void FlushQueryPlanCache();
+
 private:
 	// === Custom thunks ===
 	DECLARE_FUNCTION(execTurboStructLoadArrayLogicLite);
+	DECLARE_FUNCTION(execTurboStructLoadArrayLogicPreparedLite);
+	DECLARE_FUNCTION(execTurboStructLiteFetchQueryPage);
 	DECLARE_FUNCTION(execTurboStructLiteValidateQuery);
 
 	// Category: Logic Query.
@@ -43,15 +68,25 @@ private:
 	// Resolve the first available subslot for a slot.
 	static bool ResolveLogicSubSlot(const FString& SlotName, int32& OutSubSlotIndex, FString& OutErrorMessage);
 	// Parse SELECT/WHERE syntax into query text, fields, and SQL clauses.
-	static bool ParseSelectQueryString(const FString& InQueryString, const TArray<FString>& InSelectFields, FString& OutQueryString, TArray<FString>& OutSelectFields, int32& OutLimit, int32& OutOffset, FString& OutOrderByField, bool& bOutOrderDescending, TArray<ETurboStructLiteAggregateOp>& OutAggregateOps, TArray<FString>& OutAggregateFields, TArray<FName>& OutAggregateColumns, FString& OutErrorMessage);
+	static bool ParseSelectQueryString(const FString& InQueryString, const TArray<FString>& InSelectFields, FString& OutQueryString, TArray<FString>& OutSelectFields, int32& OutLimit, int32& OutOffset, TArray<FString>& OutOrderByFields, TArray<bool>& OutOrderDescending, TArray<ETurboStructLiteAggregateOp>& OutAggregateOps, TArray<FString>& OutAggregateFields, TArray<FName>& OutAggregateColumns, TArray<FString>& OutGroupByFields, FString& OutErrorMessage);
 	// Build a logic query context from a struct type.
 	static bool BuildLogicQueryContextFromStruct(UStruct* RootStruct, FTurboStructLiteLogicQueryContext& OutContext, FString& OutErrorMessage);
 	// Resolve a context struct from a slot's metadata.
 	static bool ResolveContextStructFromSlot(const FString& SlotName, int32 SubSlotIndex, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, UStruct*& OutStruct, FString& OutErrorMessage);
 	// Find a struct by normalized type name.
 	static UStruct* FindStructByTypeName(const FString& TypeName);
+	// Parse, bind and resolve fields for a SELECT query against a struct type.
+	static bool BuildQueryPlan(const FString& QueryString, UStruct* ContextStruct, TSharedPtr<const FTurboStructLiteQueryPlan>& OutPlan, FString& OutErrorMessage);
+	// True while the plan's struct is alive, matches ContextStruct (when given) and keeps the layout it was built against.
+	static bool IsQueryPlanCurrent(const FTurboStructLiteQueryPlan& Plan, const UStruct* ContextStruct);
+	// Fetch a plan from the LRU cache, building and inserting it on a miss.
+	static bool GetQueryPlan(const FString& QueryString, UStruct* ContextStruct, TSharedPtr<const FTurboStructLiteQueryPlan>& OutPlan, FString& OutErrorMessage);
+	// Clone a plan's AST with parameter values substituted for '?' placeholders and bind it.
+	static bool BindQueryParameters(const FTurboStructLiteQueryPlan& Plan, const TArray<FString>& Parameters, TSharedPtr<FTurboStructLiteQueryNode>& OutRoot, FString& OutErrorMessage);
+	// Queue a SELECT load shared by the query-string, prepared-query and cursor thunks; CursorPtr is advanced when a page is applied.
+	static void EnqueueSelectLogicLoad(const FString& MainSlotName, int32 SubSlotIndex, bool bAsync, const FString& QueryString, const TSharedPtr<const FTurboStructLiteQueryPlan>& PreparedPlan, const TArray<FString>& Parameters, FTurboStructLiteQueryCursor* CursorPtr, FProperty* DataProp, void* DataPtr, const FTurboStructLiteLogicLoadComplete& LoadDelegate, bool bUseWriteAheadLog, int32 QueuePriority, int32 MaxParallelThreads, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, ETurboStructLiteBatchingSetting CompressionBatching, int32 SaveVersion);
 	// Execute a SELECT/aggregate query and return rows.
-	static bool ExecuteSelectQuery(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, UStruct* ContextStruct, bool& bOutHasAggregates, TArray<FTurboStructLiteRow>& OutRows, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage);
+	static bool ExecuteSelectQuery(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const TSharedPtr<const FTurboStructLiteQueryPlan>& PreparedPlan, const TArray<FString>& Parameters, FTurboStructLiteQueryPageState* Page, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, UStruct* ContextStruct, bool& bOutHasAggregates, FTurboStructLiteResultBuffer& OutResults, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage);
 	// Category: Logic Query.
 	// Prepare a query execution context.
 	static bool PrepareSelectQueryExecution(FTurboStructLiteQueryExecutionContext& Context);
@@ -62,31 +97,75 @@ private:
 	// Finalize results for a prepared query context.
 	static bool FinalizeSelectQueryResults(FTurboStructLiteQueryExecutionContext& Context);
 	// Execute a SELECT/aggregate query and build an output value buffer.
-	static bool ExecuteSelectQueryToValue(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, FProperty* OutputProp, TArray<uint8>& OutValue, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage);
+	static bool ExecuteSelectQueryToValue(const FString& SlotName, int32 SubSlotIndex, const FString& QueryString, const TSharedPtr<const FTurboStructLiteQueryPlan>& PreparedPlan, const TArray<FString>& Parameters, FTurboStructLiteQueryPageState* Page, const FString& EncryptionKey, ETurboStructLiteEncryption SelectedEncryption, int32 MaxParallelThreads, bool bUseWriteAheadLog, const FString& WALPath, FProperty* OutputProp, TArray<uint8>& OutValue, FString& OutMetadata, FDateTime& OutSaveDate, FString& OutStatsText, FString& OutErrorMessage);
 	// Apply aggregate results to an output property.
-	static bool ApplyAggregateToOutput(const TArray<FTurboStructLiteRow>& Rows, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage);
+	static bool ApplyAggregateToOutput(const FTurboStructLiteResultBuffer& Results, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage);
 	// Apply row results to an output property.
-	static bool ApplyRowsToOutput(const TArray<FTurboStructLiteRow>& Rows, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage);
-	// Apply a row to a struct instance.
-	static bool ApplyRowToStruct(const FTurboStructLiteRow& Row, UStruct* Struct, void* StructPtr, FString& OutErrorMessage);
+	static bool ApplyRowsToOutput(const FTurboStructLiteResultBuffer& Results, FProperty* OutputProp, void* OutputPtr, FString& OutErrorMessage);
+	// Resolve, once per output struct type, the property chain each result column writes to (empty when the struct has no such field).
+	static void ResolveResultColumnTargets(const FTurboStructLiteResultBuffer& Results, UStruct* Struct, TArray<TArray<FProperty*>>& OutChains);
+	// Apply one result row to a struct instance using pre-resolved column targets.
+	static bool ApplyResultRowToStruct(const FTurboStructLiteResultBuffer& Results, int32 RowIndex, const TArray<TArray<FProperty*>>& ColumnTargets, void* StructPtr, FString& OutErrorMessage);
+	// Set up an empty columnar result buffer with one typed column per selected field.
+	static void InitResultBuffer(const TArray<FTurboStructLiteSelectFieldInfo>& Fields, FTurboStructLiteResultBuffer& OutBuffer);
+	// Append a zeroed row to a result buffer and return its index.
+	static int32 AddResultRow(FTurboStructLiteResultBuffer& Buffer);
+	// Store a field value into one cell of a result buffer.
+	static bool WriteResultCell(FTurboStructLiteResultBuffer& Buffer, int32 ColumnIndex, int32 RowIndex, const FTurboStructLiteSelectFieldInfo& FieldInfo, uint8* FieldPtr);
+	// Append the given rows of one result buffer to another with the same columns.
+	static bool AppendResultRows(const FTurboStructLiteResultBuffer& Source, const TArray<int32>& RowIndices, FTurboStructLiteResultBuffer& Dest);
+	// Convert one result cell into the variant the output writers consume.
+	static bool BuildVariantFromResult(const FTurboStructLiteResultBuffer& Results, int32 ColumnIndex, int32 RowIndex, FTurboStructLiteVariant& OutVariant);
 	// Build a logic query context from a property.
 	static bool BuildLogicQueryContext(FProperty* DataProp, FTurboStructLiteLogicQueryContext& OutContext, FString& OutErrorMessage);
 	// Tokenize a logic query string with optional SQL keyword support.
 	static bool TokenizeLogicQuery(const FString& QueryString, TArray<FTurboStructLiteQueryToken>& OutTokens, FString& OutErrorMessage, int32& OutErrorPos, bool bAllowSqlKeywords = false);
 	// Parse a logic query into an AST.
 	static bool ParseLogicQuery(const TArray<FTurboStructLiteQueryToken>& Tokens, TSharedPtr<FTurboStructLiteQueryNode>& OutRoot, FString& OutErrorMessage, int32& OutErrorPos);
-	// Bind a logic query AST to a context.
-	static bool BindLogicQuery(TSharedPtr<FTurboStructLiteQueryNode>& Root, const FTurboStructLiteLogicQueryContext& Context, FString& OutErrorMessage, int32& OutErrorPos);
+	// Bind a logic query AST to a context; '?' placeholders are only accepted when bAllowParameters is set.
+	static bool BindLogicQuery(TSharedPtr<FTurboStructLiteQueryNode>& Root, const FTurboStructLiteLogicQueryContext& Context, FString& OutErrorMessage, int32& OutErrorPos, bool bAllowParameters = false);
+	// Compile a bound logic query AST into a flat instruction program.
+	static bool CompileLogicQuery(const FTurboStructLiteQueryNode& Root, FTurboStructLiteQueryProgram& OutProgram);
+	// Evaluate a logic query, using the compiled program when available.
+	static bool EvaluateLogicQuery(const FTurboStructLiteQueryNode& Root, const uint8* RootPtr, const uint8* KeyPtr, const uint8* ValuePtr);
+	// Evaluate a compiled logic query program.
+	static bool EvaluateLogicQueryProgram(const FTurboStructLiteQueryProgram& Program, const uint8* RootPtr, const uint8* KeyPtr, const uint8* ValuePtr);
 	// Evaluate a logic query AST.
 	static bool EvaluateLogicQueryNode(const FTurboStructLiteQueryNode& Root, const uint8* RootPtr, const uint8* KeyPtr, const uint8* ValuePtr);
 	// Collect bound properties from a logic query AST.
 	static void CollectQueryBoundProperties(const TSharedPtr<FTurboStructLiteQueryNode>& Root, TArray<const FTurboStructLiteQueryBoundProperty*>& OutProperties);
 	// Build select field infos from field paths.
 	static bool BuildSelectFieldInfos(const TArray<FString>& SelectFields, const UStruct* RootStruct, TArray<FTurboStructLiteSelectFieldInfo>& OutFields, FString& OutErrorMessage);
+	// Flatten a compiled query into vector predicate steps; false when any comparison is not a fixed-offset numeric or bool field.
+	static bool BuildVectorPredicate(const FTurboStructLiteQueryNode& Root, FTurboStructLiteVectorPredicate& OutPredicate);
+	// Evaluate a vector predicate over Count strided elements, writing one selection bit per element into OutSelection.
+	static void EvaluateVectorPredicate(const FTurboStructLiteVectorPredicate& Predicate, const uint8* BasePtr, int32 Stride, int32 Count, uint64* OutSelection);
 	// Apply a logic query over loaded data.
 	static bool ApplyLogicFilter(FProperty* DataProp, const TSharedPtr<FTurboStructLiteQueryNode>& Root, const TArray<uint8>& SourceValueBuffer, TArray<uint8>& OutValueBuffer, FTurboStructLiteLogicQueryStats& OutStats, FString& OutErrorMessage);
 	// Deserialize bytes into a value buffer for processing.
 	static bool DeserializeLogicValue(FProperty* DataProp, const TArray<uint8>& RawBytes, int32 MaxThreads, TArray<uint8>& OutValueBuffer, FString& OutErrorMessage);
+	// Deserialize only the given property chains of a struct value, falling back to a full load when metadata does not line up.
+	static bool DeserializeLogicValueProjected(FStructProperty* StructProp, const TArray<uint8>& RawBytes, const TArray<TArray<FProperty*>>& Chains, int32 MaxThreads, TArray<uint8>& OutValueBuffer, FString& OutErrorMessage);
+	// Collect the property chains a select query reads and decide whether projection pays off.
+	static void BuildQueryProjection(FTurboStructLiteQueryExecutionContext& Context);
+	// Narrow a whole-slot select to the subslots a fresh secondary index allows for its indexed conjuncts.
+	static void BuildIndexCandidates(FTurboStructLiteQueryExecutionContext& Context);
+	// Drop subslots whose zone maps show a top-level AND term cannot match, without reading their payloads.
+	static void PruneSubSlotsByZoneMap(FTurboStructLiteQueryExecutionContext& Context);
+	// Find a group by key, appending empty aggregate states for it when it is new.
+	static int32 FindOrAddAggregateGroup(FTurboStructLiteAggregateTable& Table, const FString& GroupKey, int32 NumOps, bool& bOutAdded);
+	// Fold one task's group table into another, keeping first-seen group order.
+	static void MergeAggregateTable(const FTurboStructLiteAggregateTable& Source, int32 NumOps, FTurboStructLiteAggregateTable& Dest);
+	// Turn the merged group table into result rows (group columns, then aggregates) and their sort keys.
+	static void BuildAggregateResults(FTurboStructLiteQueryExecutionContext& Context);
+	// True when sort key A orders before B under the query's ORDER BY columns.
+	static bool SortKeyLess(const FTurboStructLiteQueryExecutionContext& Context, const FTurboStructLiteSortKey& A, const FTurboStructLiteSortKey& B);
 	// Format logic query stats output.
 	static FString FormatLogicStats(const FTurboStructLiteLogicQueryStats& Stats);
+
+	static FCriticalSection QueryPlanCacheMutex;
+	static TMap<FString, FTurboStructLiteQueryPlanCacheEntry> QueryPlanCache;
+	static uint64 QueryPlanCacheTick;
+	static FCriticalSection ContextStructCacheMutex;
+	static TMap<FString, FTurboStructLiteContextStructCacheEntry> ContextStructCache;
 };
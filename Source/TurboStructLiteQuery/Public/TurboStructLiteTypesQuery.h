@@ -5,6 +5,7 @@
 #include "TurboStructLiteTypesQuery.generated.h"
 
 class FStructProperty;
+class UEnum;
 
 UENUM(BlueprintType)
 enum class ETurboStructLiteQueryExec : uint8
@@ -46,7 +47,9 @@ enum class ETurboStructLiteQueryTokenType : uint8
 	Limit,
 	Offset,
 	Asc,
-	Desc
+	Desc,
+	Parameter,
+	Group
 };
 
 enum class ETurboStructLiteQueryNodeType : uint8
@@ -75,7 +78,9 @@ enum class ETurboStructLiteQueryLiteralType : uint8
 	Integer,
 	Float,
 	String,
-	Name
+	Name,
+	// Placeholder ('?') bound per execution; IntValue holds the parameter index.
+	Parameter
 };
 
 enum class ETurboStructLiteQueryValueRoot : uint8
@@ -85,6 +90,30 @@ enum class ETurboStructLiteQueryValueRoot : uint8
 	MapValue
 };
 
+enum class ETurboStructLiteQueryOpCode : uint8
+{
+	CmpInt8,
+	CmpUInt8,
+	CmpInt16,
+	CmpUInt16,
+	CmpInt32,
+	CmpUInt32,
+	CmpInt64,
+	CmpFloat,
+	CmpDouble,
+	CmpBool,
+	CmpStrEq,
+	CmpStrNe,
+	CmpStrContains,
+	CmpNameEq,
+	CmpNameNe,
+	EvalNode,
+	Constant,
+	Not,
+	JumpIfFalse,
+	JumpIfTrue
+};
+
 struct FTurboStructLiteQueryToken
 {
 	ETurboStructLiteQueryTokenType Type = ETurboStructLiteQueryTokenType::EndOfInput;
@@ -124,12 +153,63 @@ struct FTurboStructLiteQueryComparison
 	int32 LiteralPosition = 0;
 };
 
+struct FTurboStructLiteQueryNode;
+
+struct FTurboStructLiteQueryInstruction
+{
+	ETurboStructLiteQueryOpCode OpCode = ETurboStructLiteQueryOpCode::Constant;
+	ETurboStructLiteQueryCompareOp Op = ETurboStructLiteQueryCompareOp::Equal;
+	ETurboStructLiteQueryValueRoot Root = ETurboStructLiteQueryValueRoot::Root;
+	uint8 BoolMask = 0;
+	int32 Offset = 0;
+	int32 JumpTarget = INDEX_NONE;
+	int64 IntValue = 0;
+	double FloatValue = 0.0;
+	FString StringValue;
+	FName NameValue;
+	const FTurboStructLiteQueryNode* Node = nullptr;
+};
+
+struct FTurboStructLiteQueryProgram
+{
+	TArray<FTurboStructLiteQueryInstruction> Instructions;
+};
+
 struct FTurboStructLiteQueryNode
 {
 	ETurboStructLiteQueryNodeType Type = ETurboStructLiteQueryNodeType::Comparison;
 	FTurboStructLiteQueryComparison Comparison;
 	TSharedPtr<FTurboStructLiteQueryNode> Left;
 	TSharedPtr<FTurboStructLiteQueryNode> Right;
+	TSharedPtr<FTurboStructLiteQueryProgram> Program;
+};
+
+enum class ETurboStructLiteVectorStepType : uint8
+{
+	Compare,
+	Constant,
+	And,
+	Or,
+	Not
+};
+
+struct FTurboStructLiteVectorStep
+{
+	ETurboStructLiteVectorStepType Type = ETurboStructLiteVectorStepType::Constant;
+	ETurboStructLiteQueryOpCode OpCode = ETurboStructLiteQueryOpCode::Constant;
+	ETurboStructLiteQueryCompareOp Op = ETurboStructLiteQueryCompareOp::Equal;
+	int32 Offset = 0;
+	uint8 BoolMask = 0;
+	int64 IntValue = 0;
+	double FloatValue = 0.0;
+	// Compared four lanes at a time with vector registers; other steps run a scalar loop over the block.
+	bool bUseVector = false;
+};
+
+struct FTurboStructLiteVectorPredicate
+{
+	// Postfix steps over fixed-offset numeric fields; each step yields one selection bit per element in a block.
+	TArray<FTurboStructLiteVectorStep> Steps;
 };
 
 struct alignas(64) FTurboStructLiteThreadResultBucket
@@ -157,7 +237,10 @@ enum class ETurboStructLiteAggregateOp : uint8
 {
 	Count,
 	Sum,
-	Avg
+	Avg,
+	Min,
+	Max,
+	CountDistinct
 };
 
 USTRUCT(BlueprintType)
@@ -178,6 +261,175 @@ struct FTurboStructLiteSelectFieldInfo
 	bool bCountOnly = false;
 };
 
+struct FTurboStructLiteResultColumn
+{
+	FName ColumnName;
+	// Variant type this column converts to; Int and Bool fill Ints, Float fills Floats, Name fills Names, String and Struct use the string arena.
+	ETurboStructLiteVariantType Type = ETurboStructLiteVariantType::Empty;
+	const UEnum* Enum = nullptr;
+	TArray<int64> Ints;
+	TArray<double> Floats;
+	TArray<FName> Names;
+	TArray<int32> StringOffsets;
+	TArray<int32> StringLengths;
+};
+
+struct FTurboStructLiteResultBuffer
+{
+	// One typed array per selected column; rows are converted to variants only when written to the output.
+	TArray<FTurboStructLiteResultColumn> Columns;
+	TArray<TCHAR> StringArena;
+	int32 NumRows = 0;
+};
+
+struct FTurboStructLiteSortKey
+{
+	// ORDER BY columns in order; numeric columns fill Numbers, string columns fill Strings.
+	TArray<double, TInlineAllocator<2>> Numbers;
+	TArray<FString> Strings;
+	// Scan position, used as the final tie-breaker so results do not depend on task timing.
+	int32 Sequence = 0;
+};
+
+struct FTurboStructLiteTopKEntry
+{
+	FTurboStructLiteSortKey Key;
+	// Row in the owning task's result buffer; reused when the entry is evicted.
+	int32 RowIndex = INDEX_NONE;
+};
+
+struct FTurboStructLiteAggregateState
+{
+	// Count is rows for COUNT(*) and accumulated values for every other op.
+	int64 Count = 0;
+	double Sum = 0.0;
+	double Min = TNumericLimits<double>::Max();
+	double Max = -TNumericLimits<double>::Max();
+	TSet<FString> DistinctValues;
+};
+
+struct FTurboStructLiteAggregateTable
+{
+	// One row in Keys per group, in first-seen order; States holds one entry per aggregate op for each group.
+	TMap<FString, int32> GroupIndexByKey;
+	TArray<FString> GroupKeys;
+	FTurboStructLiteResultBuffer Keys;
+	TArray<FTurboStructLiteAggregateState> States;
+};
+
+struct FTurboStructLiteQueryPlan
+{
+	// Everything a SELECT needs that depends only on the query text and the context struct, built once and shared read-only between executions.
+	FString QueryString;
+	TWeakObjectPtr<UStruct> ContextStruct;
+	// Recompiled structs rebuild their property list, so a different first field marks the plan as stale.
+	const FField* LayoutStamp = nullptr;
+	int32 StructSize = 0;
+	TSharedPtr<FStructProperty> ContextStructProp;
+	FString ParsedQueryString;
+	TArray<FString> ParsedSelectFields;
+	int32 ParsedLimit = 0;
+	int32 ParsedOffset = 0;
+	TArray<FString> ParsedOrderBy;
+	TArray<bool> ParsedOrderDesc;
+	TArray<ETurboStructLiteAggregateOp> ParsedAggregateOps;
+	TArray<FString> ParsedAggregateFields;
+	TArray<FName> ParsedAggregateColumns;
+	TArray<FString> ParsedGroupBy;
+	bool bHasAggregates = false;
+	bool bHasGroupBy = false;
+	bool bHasOrderBy = false;
+	bool bQueryIsTrue = false;
+	bool bAggregateCountOnly = false;
+	FTurboStructLiteLogicQueryContext QueryContext;
+	TSharedPtr<FTurboStructLiteQueryNode> Root;
+	int32 ParameterCount = 0;
+	TArray<FTurboStructLiteSelectFieldInfo> SelectFieldInfos;
+	TArray<FTurboStructLiteSelectFieldInfo> OrderFieldInfos;
+	TArray<bool> OrderIsString;
+	TArray<FTurboStructLiteSelectFieldInfo> AggregateFieldInfos;
+	TArray<int32> AggregateFieldIndices;
+	TArray<FTurboStructLiteSelectFieldInfo> GroupFieldInfos;
+	// Output column of each aggregate op (group columns come first), and of each ORDER BY term for aggregate queries.
+	TArray<int32> AggregateOutputColumns;
+	TArray<int32> AggregateOrderColumns;
+};
+
+struct FTurboStructLiteQueryPlanCacheEntry
+{
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan;
+	uint64 LastUsed = 0;
+};
+
+struct FTurboStructLiteContextStructCacheEntry
+{
+	int64 FileSize = -1;
+	FDateTime Timestamp;
+	TWeakObjectPtr<UStruct> Struct;
+};
+
+USTRUCT(BlueprintType)
+struct TURBOSTRUCTLITEQUERY_API FTurboStructLitePreparedQuery
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	FString SlotName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	int32 SubSlotIndex = -1;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	FString QueryString;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	int32 ParameterCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	bool bIsValid = false;
+
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan;
+};
+
+USTRUCT(BlueprintType)
+struct TURBOSTRUCTLITEQUERY_API FTurboStructLiteQueryCursor
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	FString SlotName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	int32 SubSlotIndex = -1;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	FString QueryString;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	int32 PageSize = 0;
+
+	// Continuation token: the next page scans subslots after this one (-1 before the first page).
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	int32 LastSubSlot = -1;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	bool bFinished = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "TurboStructLite")
+	bool bIsValid = false;
+
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan;
+};
+
+struct FTurboStructLiteQueryPageState
+{
+	// Input: resume after this subslot and stop after PageSize matches. Output: where the page stopped.
+	int32 ResumeAfterSubSlot = INDEX_NONE;
+	int32 PageSize = 0;
+	int32 LastSubSlot = INDEX_NONE;
+	bool bFinished = false;
+};
+
 struct FTurboStructLiteQueryExecutionContext
 {
 	const FString* SlotName = nullptr;
@@ -191,8 +443,12 @@ struct FTurboStructLiteQueryExecutionContext
 	UStruct* ContextStruct = nullptr;
 	FStructProperty* ContextStructProp = nullptr;
 
+	TSharedPtr<const FTurboStructLiteQueryPlan> Plan;
+	const TArray<FString>* Parameters = nullptr;
+	FTurboStructLiteQueryPageState* Page = nullptr;
+
 	bool* bOutHasAggregates = nullptr;
-	TArray<FTurboStructLiteRow>* OutRows = nullptr;
+	FTurboStructLiteResultBuffer* OutResults = nullptr;
 	FString* OutMetadata = nullptr;
 	FDateTime* OutSaveDate = nullptr;
 	FString* OutStatsText = nullptr;
@@ -202,41 +458,51 @@ struct FTurboStructLiteQueryExecutionContext
 	TArray<FString> ParsedSelectFields;
 	int32 ParsedLimit = 0;
 	int32 ParsedOffset = 0;
-	FString ParsedOrderBy;
-	bool bParsedOrderDesc = false;
+	TArray<FString> ParsedOrderBy;
+	TArray<bool> ParsedOrderDesc;
 	TArray<ETurboStructLiteAggregateOp> ParsedAggregateOps;
 	TArray<FString> ParsedAggregateFields;
 	TArray<FName> ParsedAggregateColumns;
+	TArray<FString> ParsedGroupBy;
 
 	bool bHasAggregates = false;
+	bool bHasGroupBy = false;
 	bool bHasOrderBy = false;
 	bool bQueryIsTrue = false;
 	bool bAggregateCountOnly = false;
 
 	FTurboStructLiteLogicQueryContext QueryContext;
-	TArray<FTurboStructLiteQueryToken> Tokens;
-	int32 ErrorPos = 0;
 	TSharedPtr<FTurboStructLiteQueryNode> Root;
 
 	TArray<FTurboStructLiteSelectFieldInfo> SelectFieldInfos;
-	FTurboStructLiteSelectFieldInfo OrderFieldInfo;
+	TArray<FTurboStructLiteSelectFieldInfo> OrderFieldInfos;
+	TArray<bool> OrderIsString;
 	TArray<FTurboStructLiteSelectFieldInfo> AggregateFieldInfos;
 	TArray<int32> AggregateFieldIndices;
+	TArray<FTurboStructLiteSelectFieldInfo> GroupFieldInfos;
+	TArray<int32> AggregateOutputColumns;
+	TArray<int32> AggregateOrderColumns;
+	TArray<TArray<FProperty*>> ProjectionChains;
+	bool bUseProjection = false;
+	TSet<int32> IndexCandidates;
+	bool bUseIndexCandidates = false;
 
 	int32 ClampedParallel = 1;
 	double StartSeconds = 0.0;
 	FTurboStructLiteLogicQueryStats Stats;
-	TArray<FTurboStructLiteRow> Results;
-	TArray<double> SortKeys;
-	TArray<int64> AggregateCounts;
-	TArray<double> AggregateSums;
+	FTurboStructLiteResultBuffer Results;
+	TArray<FTurboStructLiteSortKey> SortKeys;
+	FTurboStructLiteAggregateTable Aggregates;
 	bool bHasLimit = false;
 	bool bHasOffset = false;
 	bool bForceSingleThread = false;
 	bool bAllowEarlyExit = false;
+	bool bUseTopK = false;
+	int32 TopKCount = 0;
 	int32 MaxMatchIndex = 0;
 	bool bOffsetAppliedInLoop = false;
 	bool bLimitAppliedInLoop = false;
 	int64 FastCountValue = 0;
+	int32 PageStopIndex = INDEX_NONE;
 	TArray<int32> SubSlots;
 };